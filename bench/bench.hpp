@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include "simd.hpp"
+
+// Timing shared by the simdbench targets: the best of several runs, so that interrupts and frequency ramps
+// after a cold start do not count
+
+namespace simdbench {
+
+	constexpr int repetitions = 15;
+
+	// Nanoseconds per element (or per operation) of f, which handles count of them per call
+	template < class F >
+	double measure(std::size_t count, F f) {
+		double best = 1e30;
+		for(int i = 0; i < repetitions; ++i) {
+			const auto start = std::chrono::steady_clock::now();
+			f();
+			const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+			best = std::min(best, elapsed.count() / static_cast<double>(count));
+		}
+		return best;
+	}
+
+	inline const char *compile_version() {
+		return simd::version_name(simd::sse_compile_version());
+	}
+
+	// First line of the plain text benchmarks, results of different builds are only comparable with it
+	inline void print_banner() {
+		std::printf("SIMD compile version: %s\n", compile_version());
+	}
+
+} // namespace simdbench
@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "simd.hpp"
+#include "bench.hpp"
+
+// Random gathers from tables between the size of the L1 cache and well beyond the last level cache,
+// scalar loads against simd::gather (hardware gather where the compile version has one)
+
+namespace {
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	constexpr std::size_t float_width = 16;
+	constexpr std::size_t double_width = 8;
+#elif SIMD_SUPPORTS(SIMD_AVX)
+	constexpr std::size_t float_width = 8;
+	constexpr std::size_t double_width = 4;
+#else // SIMD_SUPPORTS(SIMD_AVX512F)
+	constexpr std::size_t float_width = 4;
+	constexpr std::size_t double_width = 2;
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+	constexpr std::size_t count = 1u << 16;
+
+	template < class T, std::size_t W >
+	void bench(std::size_t table_size) {
+		using I = simd::vector<std::int32_t, W>;
+		std::mt19937 rng(1234);
+		std::uniform_int_distribution<std::int32_t> dist(0, static_cast<std::int32_t>(table_size - 1));
+		std::vector<T> table(table_size), out(count);
+		std::vector<std::int32_t> index(count);
+		for(std::size_t i = 0; i < table_size; ++i)
+			table[i] = static_cast<T>(i);
+		for(std::int32_t &i : index)
+			i = dist(rng);
+
+		const double scalar = simdbench::measure(count, [&] {
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = table[index[i]];
+		});
+		const T scalar_check = out[count / 2];
+		const double gathered = simdbench::measure(count, [&] {
+			for(std::size_t i = 0; i < count; i += W)
+				simd::gather(table.data(), I(index.data() + i)).store(out.data() + i);
+		});
+
+		std::printf("%-8s table: %8zu KiB  scalar: %7.3f ns  gather: %7.3f ns  speedup: %5.2fx  (%g / %g)\n", sizeof(T) == 4 ? "float" : "double",
+					table_size * sizeof(T) / 1024, scalar, gathered, scalar / gathered, static_cast<double>(scalar_check),
+					static_cast<double>(out[count / 2]));
+	}
+
+	template < class T, std::size_t W >
+	void bench_all() {
+		// 16 KiB up to 256 MiB of doubles
+		for(std::size_t size = 1u << 11; size <= (1u << 25); size <<= 2)
+			bench<T, W>(size);
+	}
+
+} // namespace
+
+int main() {
+	simdbench::print_banner();
+	bench_all<float, float_width>();
+	bench_all<double, double_width>();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "simd.hpp"
+#include "bench.hpp"
+
+// Throughput of the vectorized transcendentals against the standard library applied lane by lane
+
+namespace {
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	using float_vector = simd::float32x16;
+	using double_vector = simd::float64x8;
+#elif SIMD_SUPPORTS(SIMD_AVX)
+	using float_vector = simd::float32x8;
+	using double_vector = simd::float64x4;
+#else // SIMD_SUPPORTS(SIMD_AVX512F)
+	using float_vector = simd::float32x4;
+	using double_vector = simd::float64x2;
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+	constexpr std::size_t count = 1u << 16;
+
+	template < class V, class SimdF, class StdF >
+	void bench(const char *name, typename V::type lo, typename V::type hi, SimdF simd_f, StdF std_f) {
+		using T = typename V::type;
+		std::mt19937 rng(1234);
+		std::uniform_real_distribution<T> dist(lo, hi);
+		std::vector<T> in(count), out(count);
+		for(T &v : in)
+			v = dist(rng);
+
+		const double scalar = simdbench::measure(count, [&] {
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = std_f(in[i]);
+		});
+		const T scalar_check = out[count / 2];
+		const double vectorized = simdbench::measure(count, [&] {
+			for(std::size_t i = 0; i < count; i += V::width)
+				simd_f(V(in.data() + i)).store(out.data() + i);
+		});
+
+		std::printf("%-12s %-8s  std: %7.3f ns  simd: %7.3f ns  speedup: %5.2fx  (%g / %g)\n", name, sizeof(T) == 4 ? "float" : "double",
+					scalar, vectorized, scalar / vectorized, static_cast<double>(scalar_check), static_cast<double>(out[count / 2]));
+	}
+
+	template < class V >
+	void bench_all() {
+		using T = typename V::type;
+		bench<V>("exp", T(-80), T(80), [](const V &v) { return exp(v); }, [](T v) { return std::exp(v); });
+		bench<V>("fast::exp", T(-80), T(80), [](const V &v) { return simd::fast::exp(v); }, [](T v) { return std::exp(v); });
+		bench<V>("log", T(1e-3), T(1e3), [](const V &v) { return log(v); }, [](T v) { return std::log(v); });
+		bench<V>("fast::log", T(1e-3), T(1e3), [](const V &v) { return simd::fast::log(v); }, [](T v) { return std::log(v); });
+		bench<V>("sin", T(-100), T(100), [](const V &v) { return sin(v); }, [](T v) { return std::sin(v); });
+		bench<V>("cos", T(-100), T(100), [](const V &v) { return cos(v); }, [](T v) { return std::cos(v); });
+		bench<V>("tan", T(-100), T(100), [](const V &v) { return tan(v); }, [](T v) { return std::tan(v); });
+		bench<V>("atan", T(-10), T(10), [](const V &v) { return atan(v); }, [](T v) { return std::atan(v); });
+		bench<V>("atan2", T(-10), T(10), [](const V &v) { return atan2(v, V(T(0.5))); }, [](T v) { return std::atan2(v, T(0.5)); });
+		bench<V>("pow", T(1e-2), T(1e2), [](const V &v) { return pow(v, V(T(1.7))); }, [](T v) { return std::pow(v, T(1.7)); });
+		bench<V>("erf", T(-4), T(4), [](const V &v) { return erf(v); }, [](T v) { return std::erf(v); });
+	}
+
+} // namespace
+
+int main() {
+	simdbench::print_banner();
+	bench_all<float_vector>();
+	bench_all<double_vector>();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "simd.hpp"
+#include "bench.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SIMDBENCH_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SIMDBENCH_TSC 1
+#endif
+
+// Throughput and latency of every operator on every vector type of the compile version, each next to
+// vector<T, 1> as the scalar baseline. Throughput runs independent chains of the operator, latency a single
+// dependent chain, both on registers with the operands cycling through small tables so the chains cannot be
+// folded: unary operators are applied to a ^ z and comparisons to select(b, z, a < b), with z zero at runtime.
+// Prints JSON, one file per instruction set level lets releases be compared:
+//   simdbench > AVX2.json
+
+namespace {
+
+	constexpr std::size_t steps = 1u << 14;
+	constexpr std::size_t chains = 8;
+	constexpr std::size_t operands = 16;
+
+	// Shift count, 0 at runtime but unknown to the compiler
+	volatile int shift_bits = 0;
+
+	std::uint64_t ticks() {
+#ifdef SIMDBENCH_TSC
+		return __rdtsc();
+#else // SIMDBENCH_TSC
+		return 0;
+#endif // SIMDBENCH_TSC
+	}
+
+	// Time stamp counter ticks per nanosecond, 0 without one. The counter runs at the nominal frequency, so
+	// the cycles below are reference cycles.
+	double ticks_per_ns() {
+		const auto start = std::chrono::steady_clock::now();
+		const std::uint64_t first = ticks();
+		while(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(50)) {
+		}
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		return static_cast<double>(ticks() - first) / elapsed.count();
+	}
+
+	struct timing {
+		double throughput_ns;
+		double latency_ns;
+	};
+
+	// Values that stay finite and normal through the chains: factors close to 1 and integers of magnitude 1
+	template < class V >
+	std::array<V, operands> make_operands() {
+		using T = typename V::type;
+		std::array<V, operands> res;
+		for(std::size_t k = 0; k < operands; ++k) {
+			std::array<T, V::width> lanes;
+			for(std::size_t i = 0; i < V::width; ++i) {
+				if constexpr(std::is_floating_point_v<T>)
+					lanes[i] = T(1) + static_cast<T>((k * V::width + i) % 7) / T(8192);
+				else
+					lanes[i] = (k + i) % 2 ? T(1) : T(-1);
+			}
+			res[k] = V(lanes);
+		}
+		return res;
+	}
+
+	template < class V >
+	std::array<V, operands> make_zeros() {
+		std::array<V, operands> res;
+		for(V &z : res)
+			z = V(static_cast<typename V::type>(shift_bits));
+		return res;
+	}
+
+	template < class V, class F, size_t... J >
+	SIMD_FORCEINLINE void step(std::array<V, chains> &acc, const V &b, const V &z, F f, std::index_sequence<J...>) {
+		((acc[J] = f(acc[J], b, z)), ...);
+	}
+
+	template < class V, class F >
+	timing time_operator(F f) {
+		using T = typename V::type;
+		const std::array<V, operands> b = make_operands<V>(), z = make_zeros<V>();
+		const V start(std::is_floating_point_v<T> ? T(1.5) : T(3));
+		V sink = start;
+
+		const double throughput = simdbench::measure(steps * chains, [&] {
+			std::array<V, chains> acc;
+			acc.fill(start);
+			for(std::size_t i = 0; i < steps; ++i)
+				step(acc, b[i % operands], z[i % operands], f, std::make_index_sequence<chains>());
+			for(const V &v : acc)
+				sink = sink ^ v;
+		});
+		const double latency = simdbench::measure(steps, [&] {
+			V x = start;
+			for(std::size_t i = 0; i < steps; ++i)
+				x = f(x, b[i % operands], z[i % operands]);
+			sink = sink ^ x;
+		});
+
+		// Keeps the results alive
+		volatile T keep = sink[0];
+		(void)keep;
+		return { throughput, latency };
+	}
+
+	template < class T >
+	const char *lane_name() {
+		if constexpr(std::is_same_v<T, float>)
+			return "float32";
+		else if constexpr(std::is_same_v<T, double>)
+			return "float64";
+		else if constexpr(std::is_same_v<T, std::int32_t>)
+			return "int32";
+		else
+			return "int64";
+	}
+
+	class report {
+	public:
+		explicit report(double ticks_per_ns) : m_ticks_per_ns(ticks_per_ns) {}
+
+		template < class T, size_t W, class F >
+		void run(const char *op, F f) {
+			const timing simd = time_operator<simd::vector<T, W>>(f);
+			const timing scalar = time_operator<simd::vector<T, 1>>(f);
+			std::printf("%s\n    { \"type\": \"%sx%zu\", \"op\": \"%s\", \"width\": %zu, "
+						"\"ns_per_op\": %.4f, \"ns_per_element\": %.4f, \"cycles_per_element\": %s, \"latency_ns\": %.4f, \"latency_cycles\": %s, "
+						"\"scalar_ns_per_element\": %.4f, \"scalar_latency_ns\": %.4f, \"speedup\": %.3f }",
+						m_first ? "" : ",", lane_name<T>(), W, op, W, simd.throughput_ns, simd.throughput_ns / W, cycles(simd.throughput_ns / W).c_str(),
+						simd.latency_ns, cycles(simd.latency_ns).c_str(), scalar.throughput_ns, scalar.latency_ns, scalar.throughput_ns * W / simd.throughput_ns);
+			std::fflush(stdout);
+			m_first = false;
+		}
+
+	private:
+		std::string cycles(double ns) const {
+			if(m_ticks_per_ns == 0.)
+				return "null";
+			char buf[32];
+			std::snprintf(buf, sizeof(buf), "%.4f", ns * m_ticks_per_ns);
+			return buf;
+		}
+
+		double m_ticks_per_ns;
+		bool m_first = true;
+	};
+
+	template < class F >
+	auto binary(F f) {
+		return [f](const auto &a, const auto &b, const auto &) { return f(a, b); };
+	}
+
+	template < class F >
+	auto unary(F f) {
+		return [f](const auto &a, const auto &, const auto &z) { return f(a ^ z); };
+	}
+
+	template < class F >
+	auto comparison(F f) {
+		return [f](const auto &a, const auto &b, const auto &z) {
+			using V = std::decay_t<decltype(a)>;
+			return select(b, z, simd::mask<typename V::type, V::width>(f(a, b)));
+		};
+	}
+
+	template < class T, size_t W >
+	void bench_type(report &out) {
+		out.run<T, W>("+", binary([](const auto &a, const auto &b) { return a + b; }));
+		out.run<T, W>("-", binary([](const auto &a, const auto &b) { return a - b; }));
+		out.run<T, W>("*", binary([](const auto &a, const auto &b) { return a * b; }));
+		out.run<T, W>("/", binary([](const auto &a, const auto &b) { return a / b; }));
+		out.run<T, W>("&", binary([](const auto &a, const auto &b) { return a & b; }));
+		out.run<T, W>("|", binary([](const auto &a, const auto &b) { return a | b; }));
+		out.run<T, W>("^", binary([](const auto &a, const auto &b) { return a ^ b; }));
+		out.run<T, W>("~", unary([](const auto &a) { return ~a; }));
+		out.run<T, W>("==", comparison([](const auto &a, const auto &b) { return a == b; }));
+		out.run<T, W>("!=", comparison([](const auto &a, const auto &b) { return a != b; }));
+		out.run<T, W>("<", comparison([](const auto &a, const auto &b) { return a < b; }));
+		out.run<T, W>("<=", comparison([](const auto &a, const auto &b) { return a <= b; }));
+		out.run<T, W>(">", comparison([](const auto &a, const auto &b) { return a > b; }));
+		out.run<T, W>(">=", comparison([](const auto &a, const auto &b) { return a >= b; }));
+		out.run<T, W>("min", binary([](const auto &a, const auto &b) { return min(a, b); }));
+		out.run<T, W>("max", binary([](const auto &a, const auto &b) { return max(a, b); }));
+		out.run<T, W>("abs", unary([](const auto &a) { return abs(a); }));
+		if constexpr(std::is_floating_point_v<T>) {
+			out.run<T, W>("fmadd", [](const auto &a, const auto &b, const auto &) { return fmadd(a, b, b); });
+			out.run<T, W>("sqrt", unary([](const auto &a) { return a.sqrt(); }));
+			out.run<T, W>("rsqrt", unary([](const auto &a) { return a.rsqrt(); }));
+			out.run<T, W>("floor", unary([](const auto &a) { return floor(a); }));
+			out.run<T, W>("ceil", unary([](const auto &a) { return ceil(a); }));
+		} else {
+			out.run<T, W>("<<", unary([](const auto &a) { return a << shift_bits; }));
+			out.run<T, W>(">>", unary([](const auto &a) { return a >> shift_bits; }));
+		}
+	}
+
+} // namespace
+
+int main() {
+	report out(ticks_per_ns());
+	std::printf("{\n  \"compile_version\": \"%s\",\n  \"runtime_version\": \"%s\",\n  \"results\": [", simdbench::compile_version(),
+				simd::version_name(simd::sse_runtime_version()));
+	bench_type<float, 4>(out);
+	bench_type<double, 2>(out);
+	bench_type<std::int32_t, 4>(out);
+	bench_type<std::int64_t, 2>(out);
+	bench_type<float, 8>(out);
+	bench_type<double, 4>(out);
+	bench_type<std::int32_t, 8>(out);
+	bench_type<std::int64_t, 4>(out);
+	bench_type<float, 16>(out);
+	bench_type<double, 8>(out);
+	bench_type<std::int32_t, 16>(out);
+	bench_type<std::int64_t, 8>(out);
+	std::printf("\n  ]\n}\n");
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "simd.hpp"
+#include "bench.hpp"
+
+// Out of place transposes of square matrices from a few KiB to well beyond the last level cache, a naive
+// loop against simd::transpose (tiles of in-register transposes)
+
+namespace {
+
+	template < class T >
+	void bench(std::size_t n) {
+		const std::size_t count = n * n;
+		simd::aligned_vector<T> in(count), out(count);
+		for(std::size_t i = 0; i < count; ++i)
+			in[i] = static_cast<T>(i);
+
+		const double naive = simdbench::measure(count, [&] {
+			for(std::size_t i = 0; i < n; ++i)
+				for(std::size_t j = 0; j < n; ++j)
+					out[j * n + i] = in[i * n + j];
+		});
+		const T naive_check = out[n + 2];
+		const double tiled = simdbench::measure(count, [&] { simd::transpose(in.data(), n, n, out.data()); });
+
+		std::printf("%-8s %5zu x %-5zu %9zu KiB  naive: %7.3f ns  simd: %7.3f ns  speedup: %5.2fx  (%g / %g)\n", sizeof(T) == 4 ? "float" : "double", n,
+					n, count * sizeof(T) / 1024, naive, tiled, naive / tiled, static_cast<double>(naive_check), static_cast<double>(out[n + 2]));
+	}
+
+	template < class T >
+	void bench_all() {
+		// Powers of 2 put the columns of the naive loop into the same cache sets, the others do not
+		for(std::size_t n : { 64u, 250u, 256u, 1000u, 1024u, 4000u, 4096u })
+			bench<T>(n);
+	}
+
+} // namespace
+
+int main() {
+	simdbench::print_banner();
+	bench_all<float>();
+	bench_all<double>();
+	return 0;
+}
\ No newline at end of file
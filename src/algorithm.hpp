@@ -0,0 +1,185 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include "composite.hpp"
+#include "masked.hpp"
+#include "reduce.hpp"
+
+// Loops over contiguous arrays with the widest native vector of the element type. Elements up to the first
+// aligned one and the remainder go through masked loads and stores (masked.hpp), the main loop is unrolled.
+// The functions are called with whole vectors, lanes outside the array are zero. Reduction operations are
+// also applied to narrower vectors when the accumulators are folded (reduce.hpp), so they have to be generic
+// lambdas, e.g. [](const auto &a, const auto &b) { return a + b; }, and like std::reduce they may be applied
+// in any order.
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	// Lanes of the widest native vector of T, 1 if there is none
+	template < class T >
+	constexpr size_t native_width = detail::native_part_width<T, 64 / sizeof(T)>::value;
+
+	namespace detail {
+
+		constexpr size_t unroll = 4;
+
+		// Calls f(0), ..., f(unroll - 1) without a loop, so accumulators indexed by the argument stay in registers
+		template < class F, size_t... K >
+		SIMD_FORCEINLINE void unrolled(F f, std::index_sequence<K...>) {
+			(f(K), ...);
+		}
+
+		template < class F >
+		SIMD_FORCEINLINE void unrolled(F f) {
+			detail::unrolled(f, std::make_index_sequence<unroll>());
+		}
+
+		// Elements before ptr + n is aligned for V, at most count; 0 if ptr cannot be aligned at all
+		template < class V, class T >
+		SIMD_FORCEINLINE size_t head_count(const T *ptr, size_t count) {
+			const size_t offset = reinterpret_cast<std::uintptr_t>(ptr) % alignof(V);
+			const size_t head = offset % sizeof(T) ? 0 : (alignof(V) - offset) % alignof(V) / sizeof(T);
+			return head < count ? head : count;
+		}
+
+		SIMD_FORCEINLINE size_t popcount(std::uint64_t bits) {
+#ifdef _MSC_VER
+			// __popcnt64 needs POPCNT, which the SSE levels do not imply
+			bits = bits - ((bits >> 1) & 0x5555555555555555ull);
+			bits = (bits & 0x3333333333333333ull) + ((bits >> 2) & 0x3333333333333333ull);
+			bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0full;
+			return static_cast<size_t>((bits * 0x0101010101010101ull) >> 56);
+#else // _MSC_VER
+			return static_cast<size_t>(__builtin_popcountll(bits));
+#endif // _MSC_VER
+		}
+
+		template < class T, size_t W >
+		size_t count_set_lanes(const mask<T, W> &m) {
+			if constexpr(W == 1 || has_native_vector<T, W>::value) {
+				return detail::popcount(static_cast<std::uint32_t>(m.get_mask())) / mask_lane_bits<T, W>;
+			} else {
+				size_t res = 0;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					res += detail::count_set_lanes(m.part(i));
+				return res;
+			}
+		}
+
+		template < size_t W, class U, class F, class... T >
+		void transform(U *out, size_t count, F f, const T *... in) {
+			size_t i = detail::head_count<vector<U, W>>(out, count);
+			if(i > 0)
+				simd::store(out, f(simd::load(in, mask<T, W>::first_n(i))...), mask<U, W>::first_n(i));
+			// Called with aligned_store{} once the head is done, without if out is not even aligned to its elements
+			const auto loop = [&](auto... aligned) {
+				for(; i + unroll * W <= count; i += unroll * W)
+					detail::unrolled([&](size_t k) { f(vector<T, W>(in + i + k * W)...).store(out + i + k * W, aligned...); });
+				for(; i + W <= count; i += W)
+					f(vector<T, W>(in + i)...).store(out + i, aligned...);
+			};
+			if(reinterpret_cast<std::uintptr_t>(out + i) % alignof(vector<U, W>) == 0)
+				loop(aligned_store{});
+			else
+				loop();
+			if(i < count)
+				simd::store(out + i, f(simd::load(in + i, mask<T, W>::first_n(count - i))...), mask<U, W>::first_n(count - i));
+		}
+
+		template < size_t W, class R, class Op, class F, class... T >
+		R transform_reduce(size_t count, R init, Op op, F f, const T *... in) {
+			using V = vector<R, W>;
+			const auto scalar_op = [&](R a, R b) { return op(vector<R, 1>(a), vector<R, 1>(b))[0]; };
+			if(count < W) {
+				alignas(64) R lanes[W];
+				f(simd::load(in, mask<T, W>::first_n(count))...).store(lanes);
+				for(size_t i = 0; i < count; ++i)
+					init = scalar_op(init, lanes[i]);
+				return init;
+			}
+
+			// The first vector starts the accumulator, so op needs no identity element
+			std::array<V, unroll> acc;
+			acc[0] = f(vector<T, W>(in)...);
+			size_t i = W;
+			if(const size_t head = detail::head_count<vector<R, W>>(std::get<0>(std::make_tuple(in...)) + W, count - W); head > 0) {
+				acc[0] = select(V(op(acc[0], f(simd::load(in + W, mask<T, W>::first_n(head))...))), acc[0], mask<R, W>::first_n(head));
+				i += head;
+			}
+			if(i + unroll * W <= count) {
+				// Independent accumulators hide the latency of op
+				detail::unrolled([&](size_t k) {
+					const V v = f(vector<T, W>(in + i + k * W)...);
+					acc[k] = k ? v : V(op(acc[0], v));
+				});
+				for(i += unroll * W; i + unroll * W <= count; i += unroll * W)
+					detail::unrolled([&](size_t k) { acc[k] = op(acc[k], f(vector<T, W>(in + i + k * W)...)); });
+				detail::unrolled([&](size_t k) {
+					if(k)
+						acc[0] = op(acc[0], acc[k]);
+				});
+			}
+			for(; i + W <= count; i += W)
+				acc[0] = op(acc[0], f(vector<T, W>(in + i)...));
+			if(i < count)
+				acc[0] = select(V(op(acc[0], f(simd::load(in + i, mask<T, W>::first_n(count - i))...))), acc[0], mask<R, W>::first_n(count - i));
+			return scalar_op(init, detail::reduce(acc[0], op));
+		}
+
+	} // namespace detail
+
+	// out[i] = f(in[i]) for count elements; out may be the same array as in
+	template < class T, class U, class F >
+	void transform(const T *in, size_t count, U *out, F f) {
+		detail::transform<native_width<T>>(out, count, f, in);
+	}
+
+	// out[i] = f(in1[i], in2[i])
+	template < class T, class U, class F >
+	void transform(const T *in1, const T *in2, size_t count, U *out, F f) {
+		detail::transform<native_width<T>>(out, count, f, in1, in2);
+	}
+
+	// Applies f to the vectors of data in place, f takes a reference and may modify it
+	template < class T, class F >
+	void for_each(T *data, size_t count, F f) {
+		detail::transform<native_width<T>>(data, count, [&](auto v) { f(v); return v; }, static_cast<const T *>(data));
+	}
+
+	// init combined with all elements through op
+	template < class T, class Op >
+	T reduce(const T *in, size_t count, T init, Op op) {
+		return detail::transform_reduce<native_width<T>>(count, init, op, [](const auto &v) { return v; }, in);
+	}
+
+	// init combined with f(in[i]) for all elements through op, f returns vectors of R
+	template < class T, class R, class Op, class F >
+	R transform_reduce(const T *in, size_t count, R init, Op op, F f) {
+		return detail::transform_reduce<native_width<T>>(count, init, op, f, in);
+	}
+
+	// init combined with f(in1[i], in2[i]), e.g. a dot product
+	template < class T, class R, class Op, class F >
+	R transform_reduce(const T *in1, const T *in2, size_t count, R init, Op op, F f) {
+		return detail::transform_reduce<native_width<T>>(count, init, op, f, in1, in2);
+	}
+
+	// Number of elements for which pred, a comparison of vectors, holds
+	template < class T, class P >
+	size_t count_if(const T *in, size_t count, P pred) {
+		constexpr size_t W = native_width<T>;
+		size_t res = 0, i = 0;
+		for(; i + W <= count; i += W)
+			res += detail::count_set_lanes(mask<T, W>(pred(vector<T, W>(in + i))));
+		if(i < count) {
+			const auto tail = mask<T, W>::first_n(count - i);
+			res += detail::count_set_lanes(mask<T, W>(pred(simd::load(in + i, tail))) & tail);
+		}
+		return res;
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <vector>
+
+// Allocator for memory that the aligned_load/aligned_store overloads can be used on. Allocations are rounded
+// up to a whole number of Align sized blocks and the padding is zeroed, so with the default of 64 bytes (one
+// cache line, an AVX-512 register) full vectors can be loaded and stored up to the end of the last block,
+// also past size() of an aligned_vector. Elements past size() are unspecified apart from that padding.
+
+namespace simd {
+
+	template < class T, size_t Align = 64 >
+	class aligned_allocator {
+	public:
+		using value_type = T;
+		static constexpr size_t alignment = Align > alignof(T) ? Align : alignof(T);
+		static_assert((alignment & (alignment - 1)) == 0, "Alignment must be a power of 2");
+
+		template < class U >
+		struct rebind {
+			using other = aligned_allocator<U, Align>;
+		};
+
+		aligned_allocator() noexcept = default;
+		template < class U >
+		aligned_allocator(const aligned_allocator<U, Align> &) noexcept {}
+
+		// Bytes allocated for count elements
+		static constexpr size_t padded_size(size_t count) {
+			return (count * sizeof(T) + alignment - 1) / alignment * alignment;
+		}
+
+		T *allocate(size_t count) {
+			if(count > (std::numeric_limits<size_t>::max() - alignment) / sizeof(T))
+				throw std::bad_array_new_length();
+			const size_t bytes = padded_size(count);
+			auto *mem = static_cast<char *>(::operator new(bytes, std::align_val_t(alignment)));
+			std::memset(mem + count * sizeof(T), 0, bytes - count * sizeof(T));
+			return reinterpret_cast<T *>(mem);
+		}
+
+		void deallocate(T *ptr, size_t) noexcept {
+			::operator delete(ptr, std::align_val_t(alignment));
+		}
+
+		template < class U >
+		friend bool operator==(const aligned_allocator &, const aligned_allocator<U, Align> &) noexcept {
+			return true;
+		}
+
+		template < class U >
+		friend bool operator!=(const aligned_allocator &, const aligned_allocator<U, Align> &) noexcept {
+			return false;
+		}
+	};
+
+	template < class T, size_t Align = 64 >
+	using aligned_vector = std::vector<T, aligned_allocator<T, Align>>;
+
+} // namespace simd
\ No newline at end of file
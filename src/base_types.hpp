@@ -6,6 +6,7 @@
 #include <iostream>
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 	template < class T, size_t W >
 	struct native_vector;
@@ -36,6 +37,42 @@ namespace simd {
 		static constexpr int required_version = SIMD_SSE2;
 		using native_type = __m128i;
 	};
+
+	template <>
+	struct native_vector<std::int8_t, 16> {
+		static constexpr int required_version = SIMD_SSE2;
+		using native_type = __m128i;
+	};
+
+	template <>
+	struct native_vector<std::int16_t, 8> {
+		static constexpr int required_version = SIMD_SSE2;
+		using native_type = __m128i;
+	};
+
+	template <>
+	struct native_vector<std::uint32_t, 4> {
+		static constexpr int required_version = SIMD_SSE2;
+		using native_type = __m128i;
+	};
+
+	template <>
+	struct native_vector<std::uint64_t, 2> {
+		static constexpr int required_version = SIMD_SSE2;
+		using native_type = __m128i;
+	};
+
+	template <>
+	struct native_vector<std::uint8_t, 16> {
+		static constexpr int required_version = SIMD_SSE2;
+		using native_type = __m128i;
+	};
+
+	template <>
+	struct native_vector<std::uint16_t, 8> {
+		static constexpr int required_version = SIMD_SSE2;
+		using native_type = __m128i;
+	};
 #endif // SIMD_SUPPORTS(SIMD_SSE2)
 
 #if SIMD_SUPPORTS(SIMD_AVX)
@@ -65,6 +102,73 @@ namespace simd {
 		static constexpr int required_version = SIMD_AVX2;
 		using native_type = __m256i;
 	};
+
+	template <>
+	struct native_vector<std::int8_t, 32> {
+		static constexpr int required_version = SIMD_AVX2;
+		using native_type = __m256i;
+	};
+
+	template <>
+	struct native_vector<std::int16_t, 16> {
+		static constexpr int required_version = SIMD_AVX2;
+		using native_type = __m256i;
+	};
+
+	template <>
+	struct native_vector<std::uint32_t, 8> {
+		static constexpr int required_version = SIMD_AVX2;
+		using native_type = __m256i;
+	};
+
+	template <>
+	struct native_vector<std::uint64_t, 4> {
+		static constexpr int required_version = SIMD_AVX2;
+		using native_type = __m256i;
+	};
+
+	template <>
+	struct native_vector<std::uint8_t, 32> {
+		static constexpr int required_version = SIMD_AVX2;
+		using native_type = __m256i;
+	};
+
+	template <>
+	struct native_vector<std::uint16_t, 16> {
+		static constexpr int required_version = SIMD_AVX2;
+		using native_type = __m256i;
+	};
 #endif // SIMD_SUPPORTS(SIMD_AVX2)
 
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	template <>
+	struct native_vector<float, 16> {
+		static constexpr int required_version = SIMD_AVX512F;
+		using native_type = __m512;
+		using mask_type = __mmask16;
+	};
+
+	template <>
+	struct native_vector<double, 8> {
+		static constexpr int required_version = SIMD_AVX512F;
+		using native_type = __m512d;
+		using mask_type = __mmask8;
+	};
+
+	template <>
+	struct native_vector<std::int32_t, 16> {
+		static constexpr int required_version = SIMD_AVX512F;
+		using native_type = __m512i;
+		using mask_type = __mmask16;
+	};
+
+	template <>
+	struct native_vector<std::int64_t, 8> {
+		static constexpr int required_version = SIMD_AVX512F;
+		using native_type = __m512i;
+		using mask_type = __mmask8;
+	};
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "narrow_float.hpp"
+#include "float32x4.hpp"
+#include "float32x8.hpp"
+#include "float32x16.hpp"
+
+// bfloat16 values in memory, the upper half of a float. load_bfloat16 widens W of them to vector<float, W>
+// with integer unpacks or shifts, store_bfloat16 narrows with round to nearest even. dot_bfloat16 multiplies
+// two bfloat16 arrays in float registers with fmadd, reading half the bytes of a float dot product.
+
+namespace simd {
+
+	// Only the bits like float16, the conversions are in SIMD_ISA_NAMESPACE
+	struct bfloat16 {
+		std::uint16_t bits;
+	};
+
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		// Conversions of a single value, the reference for the kernels below
+		inline std::uint16_t bf16_from_float(float f) {
+			std::uint32_t u;
+			std::memcpy(&u, &f, sizeof(u));
+			// NaN stays a quiet NaN instead of rounding to infinity
+			if((u & 0x7FFFFFFF) > 0x7F800000)
+				return static_cast<std::uint16_t>((u | 0x00400000) >> 16);
+			// Round to nearest even, carries go into the exponent, up to infinity
+			return static_cast<std::uint16_t>((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+		}
+
+		inline float bf16_to_float(std::uint16_t h) {
+			const std::uint32_t u = static_cast<std::uint32_t>(h) << 16;
+			float f;
+			std::memcpy(&f, &u, sizeof(f));
+			return f;
+		}
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+		// The four values in the lower 64 bits of h
+		SIMD_FORCEINLINE __m128 cvtpbh_ps(__m128i h) {
+			return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), h));
+		}
+
+		// Rounded floats with the result in the upper 16 bits, sign extended into the lower ones
+		SIMD_FORCEINLINE __m128i round_bf16(__m128 f) {
+			const auto u = _mm_castps_si128(f);
+			const auto odd = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(1));
+			const auto rounded = _mm_add_epi32(u, _mm_add_epi32(odd, _mm_set1_epi32(0x7FFF)));
+			const auto nan = _mm_cmpgt_epi32(_mm_and_si128(u, _mm_set1_epi32(INT32_MAX)), _mm_set1_epi32(0x7F800000));
+			const auto quiet = _mm_or_si128(u, _mm_set1_epi32(0x00400000));
+			return _mm_srai_epi32(_mm_or_si128(_mm_and_si128(nan, quiet), _mm_andnot_si128(nan, rounded)), 16);
+		}
+
+		// Four values in the lower 64 bits of the result
+		SIMD_FORCEINLINE __m128i cvtneps_pbh(__m128 f) {
+			const auto res = detail::round_bf16(f);
+			return _mm_packs_epi32(res, res);
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+		SIMD_FORCEINLINE __m256 cvtpbh_ps8(__m128i h) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			const auto zero = _mm_setzero_si128();
+			return _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(zero, h)), _mm_unpackhi_epi16(zero, h), 1));
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE __m128i cvtneps_pbh8(__m256 f) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			const auto u = _mm256_castps_si256(f);
+			const auto odd = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(1));
+			const auto rounded = _mm256_add_epi32(u, _mm256_add_epi32(odd, _mm256_set1_epi32(0x7FFF)));
+			const auto nan = _mm256_cmpgt_epi32(_mm256_and_si256(u, _mm256_set1_epi32(INT32_MAX)), _mm256_set1_epi32(0x7F800000));
+			const auto quiet = _mm256_or_si256(u, _mm256_set1_epi32(0x00400000));
+			const auto res = _mm256_srai_epi32(_mm256_blendv_epi8(rounded, quiet, nan), 16);
+			// The pack works within 128-bit lanes, the permute joins the two lower halves
+			return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packs_epi32(res, res), _MM_SHUFFLE(3, 1, 2, 0)));
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			return _mm_packs_epi32(detail::round_bf16(_mm256_castps256_ps128(f)), detail::round_bf16(_mm256_extractf128_ps(f, 1)));
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+		SIMD_FORCEINLINE __m256i cvtneps_pbh16(__m512 f) {
+			const auto u = _mm512_castps_si512(f);
+			const auto odd = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(1));
+			const auto rounded = _mm512_add_epi32(u, _mm512_add_epi32(odd, _mm512_set1_epi32(0x7FFF)));
+			const auto nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(u, _mm512_set1_epi32(INT32_MAX)), _mm512_set1_epi32(0x7F800000));
+			const auto res = _mm512_mask_or_epi32(rounded, nan, u, _mm512_set1_epi32(0x00400000));
+			return _mm512_cvtepi32_epi16(_mm512_srli_epi32(res, 16));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+	} // namespace detail
+
+	template < size_t W >
+	SIMD_FORCEINLINE vector<float, W> load_bfloat16(const bfloat16 *src);
+
+	template < size_t W >
+	SIMD_FORCEINLINE void store_bfloat16(bfloat16 *dst, const vector<float, W> &v);
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	template <>
+	SIMD_FORCEINLINE vector<float, 4> load_bfloat16<4>(const bfloat16 *src) {
+		return vector<float, 4>(detail::cvtpbh_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src))));
+	}
+
+	template <>
+	SIMD_FORCEINLINE void store_bfloat16<4>(bfloat16 *dst, const vector<float, 4> &v) {
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(dst), detail::cvtneps_pbh(v.native()));
+	}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+	template <>
+	SIMD_FORCEINLINE vector<float, 8> load_bfloat16<8>(const bfloat16 *src) {
+		return vector<float, 8>(detail::cvtpbh_ps8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src))));
+	}
+
+	template <>
+	SIMD_FORCEINLINE void store_bfloat16<8>(bfloat16 *dst, const vector<float, 8> &v) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst), detail::cvtneps_pbh8(v.native()));
+	}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	template <>
+	SIMD_FORCEINLINE vector<float, 16> load_bfloat16<16>(const bfloat16 *src) {
+		const auto h = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+		return vector<float, 16>(_mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(h), 16)));
+	}
+
+	template <>
+	SIMD_FORCEINLINE void store_bfloat16<16>(bfloat16 *dst, const vector<float, 16> &v) {
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), detail::cvtneps_pbh16(v.native()));
+	}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+	template < size_t W >
+	vector<float, W> load_bfloat16(const bfloat16 *src) {
+		return detail::narrow_float<bfloat16>::load<W>(
+			src, [](auto pw, const bfloat16 *p) { return load_bfloat16<decltype(pw)::value>(p); }, [](bfloat16 h) { return detail::bf16_to_float(h.bits); });
+	}
+
+	template < size_t W >
+	void store_bfloat16(bfloat16 *dst, const vector<float, W> &v) {
+		detail::narrow_float<bfloat16>::store(
+			dst, v, [](bfloat16 *p, const auto &part) { store_bfloat16(p, part); }, [](float f) { return bfloat16{ detail::bf16_from_float(f) }; });
+	}
+
+	inline void bfloat16_to_float(const bfloat16 *src, float *dst, size_t count) {
+		detail::narrow_float<bfloat16>::to_float(
+			src, dst, count, [](auto w, const bfloat16 *p) { return load_bfloat16<decltype(w)::value>(p); },
+			[](bfloat16 h) { return detail::bf16_to_float(h.bits); });
+	}
+
+	inline void float_to_bfloat16(const float *src, bfloat16 *dst, size_t count) {
+		detail::narrow_float<bfloat16>::from_float(
+			src, dst, count, [](bfloat16 *p, const auto &v) { store_bfloat16(p, v); }, [](float f) { return bfloat16{ detail::bf16_from_float(f) }; });
+	}
+
+	// Sum of a[i] * b[i] in float. Two accumulators keep two fmadd chains in flight, the products of two
+	// bfloat16 values are exact in float so only the order of the additions differs from a scalar loop.
+	inline float dot_bfloat16(const bfloat16 *a, const bfloat16 *b, size_t count) {
+		constexpr size_t W = detail::native_part_width<float, 16>::value;
+		vector<float, W> acc0(0.f), acc1(0.f);
+		size_t i = 0;
+		for(; i + 2 * W <= count; i += 2 * W) {
+			acc0 = fmadd(load_bfloat16<W>(a + i), load_bfloat16<W>(b + i), acc0);
+			acc1 = fmadd(load_bfloat16<W>(a + i + W), load_bfloat16<W>(b + i + W), acc1);
+		}
+		if(i + W <= count) {
+			acc0 = fmadd(load_bfloat16<W>(a + i), load_bfloat16<W>(b + i), acc0);
+			i += W;
+		}
+		float sum = (acc0 + acc1).hadd();
+		for(; i < count; ++i)
+			sum += detail::bf16_to_float(a[i].bits) * detail::bf16_to_float(b[i].bits);
+		return sum;
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,716 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "base_types.hpp"
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "util.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		template < class T, size_t W, class = void >
+		struct has_native_vector : std::false_type {};
+
+		// Detected through required_version, naming the intrinsic type would drop its alignment attributes
+		template < class T, size_t W >
+		struct has_native_vector<T, W, std::void_t<decltype(native_vector<T, W>::required_version)>> : std::true_type {};
+
+		template < class T, size_t W, class = void >
+		struct has_native_mask : std::false_type {};
+
+		template < class T, size_t W >
+		struct has_native_mask<T, W, std::void_t<typename native_vector<T, W>::mask_type>> : std::true_type {};
+
+		// Widest native register of T that evenly divides W, single scalar lanes (scalar.hpp) if there is none
+		template < class T, size_t W, size_t P = 64 / sizeof(T) >
+		struct native_part_width : std::conditional_t<(P <= W && W % P == 0 && has_native_vector<T, P>::value),
+													  std::integral_constant<size_t, P>, native_part_width<T, W, P / 2>> {};
+
+		template < class T, size_t W >
+		struct native_part_width<T, W, 1> : std::integral_constant<size_t, 1> {};
+
+		// Bits per lane in mask<T, W>::get_mask(); integer vector masks use the byte movemask
+		template < class T, size_t W >
+		constexpr size_t mask_lane_bits = (std::is_integral_v<T> && has_native_vector<T, W>::value && !has_native_mask<T, W>::value) ? sizeof(T) : 1;
+
+		// Whether lane i is set in the get_mask() bits of a native or scalar mask
+		template < class T, size_t W >
+		SIMD_FORCEINLINE bool lane_set(int bits, size_t i) {
+			return (bits >> (i * mask_lane_bits<T, W>)) & 1;
+		}
+
+		// Lane type of mul_even() and mul_odd(), keeping the signedness of the 32 bit lanes
+		template < class T >
+		using product_type = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+
+	} // namespace detail
+
+	// Vector made up of several native registers, used for every width without a dedicated
+	// specialization (e.g. float32x8 as two __m128 on SSE). Operations are applied part by part,
+	// which also gives independent dependency chains to hide instruction latencies. Without any
+	// suitable register the parts are single scalar lanes.
+	template < class T, size_t W >
+	class vector {
+	public:
+		using type = T;
+		static constexpr size_t width = W;
+		static constexpr size_t part_width = detail::native_part_width<T, W>::value;
+		static constexpr size_t part_count = W / part_width;
+		using part_type = vector<T, part_width>;
+		static constexpr int required_version = part_type::required_version;
+		static constexpr bool fused_multiply_add = is_fma_fused_v<part_type>;
+
+		SIMD_FORCEINLINE vector() : m_parts() {}
+		explicit SIMD_FORCEINLINE vector(type f);
+		template < class... Ts, std::enable_if_t<sizeof...(Ts) == W && (std::is_convertible_v<Ts, T> && ...), int> = 0 >
+		explicit SIMD_FORCEINLINE vector(Ts... vals) : vector(std::array<type, width>{ { static_cast<type>(vals)... } }) {}
+		explicit SIMD_FORCEINLINE vector(const std::array<type, width> &arr) : vector(arr.data()) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals);
+		explicit SIMD_FORCEINLINE vector(const type *vals, aligned_load);
+		template < class U >
+		explicit SIMD_FORCEINLINE vector(const vector<U, W> &v);
+		// Between different widths the low lanes are converted and the rest zeroed, as by the native conversions
+		template < class U, size_t V, std::enable_if_t<V != W, int> = 0 >
+		explicit SIMD_FORCEINLINE vector(const vector<U, V> &v);
+
+		SIMD_FORCEINLINE part_type &part(size_t index) {
+			assert(index < part_count);
+			return m_parts[index];
+		}
+
+		SIMD_FORCEINLINE const part_type &part(size_t index) const {
+			assert(index < part_count);
+			return m_parts[index];
+		}
+
+		SIMD_FORCEINLINE type &operator[](size_t index) {
+			assert(index < width);
+			return m_parts[index / part_width][index % part_width];
+		}
+
+		SIMD_FORCEINLINE const type &operator[](size_t index) const {
+			assert(index < width);
+			return m_parts[index / part_width][index % part_width];
+		}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<T, W> &operator+=(const vector<T, W> &v);
+		SIMD_FORCEINLINE vector<T, W> &operator-=(const vector<T, W> &v);
+		SIMD_FORCEINLINE vector<T, W> &operator*=(const vector<T, W> &v);
+		SIMD_FORCEINLINE vector<T, W> &operator/=(const vector<T, W> &v);
+		friend SIMD_FORCEINLINE vector<T, W> operator+(vector<T, W> v1, const vector<T, W> &v2) {
+			return (v1 += v2);
+		}
+		friend SIMD_FORCEINLINE vector<T, W> operator-(vector<T, W> v1, const vector<T, W> &v2) {
+			return (v1 -= v2);
+		}
+		friend SIMD_FORCEINLINE vector<T, W> operator*(vector<T, W> v1, const vector<T, W> &v2) {
+			return (v1 *= v2);
+		}
+		friend SIMD_FORCEINLINE vector<T, W> operator/(vector<T, W> v1, const vector<T, W> &v2) {
+			return (v1 /= v2);
+		}
+		// v1 * v2 + v3, v1 * v2 - v3, -(v1 * v2) + v3 and -(v1 * v2) - v3, see is_fma_fused
+		friend SIMD_FORCEINLINE vector<T, W> fmadd(const vector<T, W> &v1, const vector<T, W> &v2, const vector<T, W> &v3) {
+			return v1.apply(v2, v3, [](const part_type &a, const part_type &b, const part_type &c) { return fmadd(a, b, c); });
+		}
+		friend SIMD_FORCEINLINE vector<T, W> fmsub(const vector<T, W> &v1, const vector<T, W> &v2, const vector<T, W> &v3) {
+			return v1.apply(v2, v3, [](const part_type &a, const part_type &b, const part_type &c) { return fmsub(a, b, c); });
+		}
+		friend SIMD_FORCEINLINE vector<T, W> fnmadd(const vector<T, W> &v1, const vector<T, W> &v2, const vector<T, W> &v3) {
+			return v1.apply(v2, v3, [](const part_type &a, const part_type &b, const part_type &c) { return fnmadd(a, b, c); });
+		}
+		friend SIMD_FORCEINLINE vector<T, W> fnmsub(const vector<T, W> &v1, const vector<T, W> &v2, const vector<T, W> &v3) {
+			return v1.apply(v2, v3, [](const part_type &a, const part_type &b, const part_type &c) { return fnmsub(a, b, c); });
+		}
+		// High half of the double width products, integer lanes only
+		friend SIMD_FORCEINLINE vector<T, W> mulhi(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.apply(v2, [](const part_type &a, const part_type &b) { return mulhi(a, b); });
+		}
+		// Sums and differences clamped to the range of the lanes, 8 and 16 bit integer lanes only
+		friend SIMD_FORCEINLINE vector<T, W> add_sat(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.apply(v2, [](const part_type &a, const part_type &b) { return add_sat(a, b); });
+		}
+		friend SIMD_FORCEINLINE vector<T, W> sub_sat(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.apply(v2, [](const part_type &a, const part_type &b) { return sub_sat(a, b); });
+		}
+		// Full 64 bit products of the even and the odd lanes respectively, 32 bit integer lanes only
+		friend SIMD_FORCEINLINE vector<detail::product_type<T>, W / 2> mul_even(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.widening_mul(v2, 0);
+		}
+		friend SIMD_FORCEINLINE vector<detail::product_type<T>, W / 2> mul_odd(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.widening_mul(v2, 1);
+		}
+
+		SIMD_FORCEINLINE vector<T, W> &operator&=(const vector<T, W> &v);
+		SIMD_FORCEINLINE vector<T, W> &operator|=(const vector<T, W> &v);
+		SIMD_FORCEINLINE vector<T, W> &operator^=(const vector<T, W> &v);
+		friend SIMD_FORCEINLINE vector<T, W> operator~(const vector<T, W> &v) {
+			return v.apply([](const part_type &p) { return ~p; });
+		}
+		friend SIMD_FORCEINLINE vector<T, W> operator&(vector<T, W> v1, const vector<T, W> &v2) {
+			return v1 &= v2;
+		}
+		friend SIMD_FORCEINLINE vector<T, W> operator|(vector<T, W> v1, const vector<T, W> &v2) {
+			return v1 |= v2;
+		}
+		friend SIMD_FORCEINLINE vector<T, W> operator^(vector<T, W> v1, const vector<T, W> &v2) {
+			return v1 ^= v2;
+		}
+
+		friend SIMD_FORCEINLINE vector<T, W> operator<<(const vector<T, W> &v, int bits) {
+			return v.apply([bits](const part_type &p) { return p << bits; });
+		}
+		friend SIMD_FORCEINLINE vector<T, W> operator>>(const vector<T, W> &v, int bits) {
+			return v.apply([bits](const part_type &p) { return p >> bits; });
+		}
+
+		friend SIMD_FORCEINLINE mask<T, W> operator==(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.compare(v2, [](const part_type &a, const part_type &b) { return a == b; });
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator!=(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.compare(v2, [](const part_type &a, const part_type &b) { return a != b; });
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator>(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.compare(v2, [](const part_type &a, const part_type &b) { return a > b; });
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator>=(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.compare(v2, [](const part_type &a, const part_type &b) { return a >= b; });
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator<(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.compare(v2, [](const part_type &a, const part_type &b) { return a < b; });
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator<=(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.compare(v2, [](const part_type &a, const part_type &b) { return a <= b; });
+		}
+
+		// Same layout as the native instructions: pairs are added within each part
+		SIMD_FORCEINLINE vector<T, W> &hadd(const vector<T, W> &v);
+		SIMD_FORCEINLINE vector<T, W> &hsub(const vector<T, W> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		// Pairwise difference tree, i.e. ((A1-A2)-(A3-A4))-((A5-A6)-(A7-A8))-...
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<T, W> hadd(vector<T, W> v1, const vector<T, W> &v2) {
+			return v1.hadd(v2);
+		}
+		friend SIMD_FORCEINLINE vector<T, W> hsub(vector<T, W> v1, const vector<T, W> &v2) {
+			return v1.hsub(v2);
+		}
+
+		SIMD_FORCEINLINE vector<T, W> &abs();
+		friend SIMD_FORCEINLINE vector<T, W> abs(vector<T, W> v) {
+			return v.abs();
+		}
+		friend SIMD_FORCEINLINE vector<T, W> min(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.apply(v2, [](const part_type &a, const part_type &b) { return min(a, b); });
+		}
+		friend SIMD_FORCEINLINE vector<T, W> max(const vector<T, W> &v1, const vector<T, W> &v2) {
+			return v1.apply(v2, [](const part_type &a, const part_type &b) { return max(a, b); });
+		}
+		SIMD_FORCEINLINE vector<T, W> &ceil();
+		SIMD_FORCEINLINE vector<T, W> &floor();
+		SIMD_FORCEINLINE vector<T, W> &round(int mode);
+		friend SIMD_FORCEINLINE vector<T, W> ceil(vector<T, W> v) {
+			return v.ceil();
+		}
+		friend SIMD_FORCEINLINE vector<T, W> floor(vector<T, W> v) {
+			return v.floor();
+		}
+		friend SIMD_FORCEINLINE vector<T, W> round(vector<T, W> v, int mode) {
+			return v.round(mode);
+		}
+
+		SIMD_FORCEINLINE vector<T, W> sqrt() const;
+		SIMD_FORCEINLINE vector<T, W> rsqrt() const;
+
+		friend SIMD_FORCEINLINE vector<T, W> select(const vector<T, W> &v, const vector<T, W> &alt, const mask<T, W> &condition) {
+			vector<T, W> res;
+			for(size_t i = 0; i < part_count; ++i)
+				res.m_parts[i] = select(v.m_parts[i], alt.m_parts[i], condition.part(i));
+			return res;
+		}
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<T, W> &v) {
+			stream << '(';
+			for (size_t i = 0; i < v.width - 1; ++i) {
+				stream << +v[i] << ' ';
+			}
+			stream << +v[v.width - 1] << ')';
+			return stream;
+		}
+
+	private:
+		template < class F >
+		SIMD_FORCEINLINE vector<T, W> apply(F f) const;
+		template < class F >
+		SIMD_FORCEINLINE vector<T, W> apply(const vector<T, W> &v, F f) const;
+		template < class F >
+		SIMD_FORCEINLINE vector<T, W> apply(const vector<T, W> &v1, const vector<T, W> &v2, F f) const;
+		template < class F >
+		SIMD_FORCEINLINE mask<T, W> compare(const vector<T, W> &v, F f) const;
+		template < class F >
+		SIMD_FORCEINLINE vector<T, W> horizontal_scalar(const vector<T, W> &v, F f) const;
+		SIMD_FORCEINLINE vector<detail::product_type<T>, W / 2> widening_mul(const vector<T, W> &v, size_t offset) const;
+
+		std::array<part_type, part_count> m_parts;
+	};
+
+	template < class T, size_t W >
+	class mask {
+	public:
+		using type = T;
+		static constexpr size_t width = W;
+		static constexpr size_t part_width = vector<T, W>::part_width;
+		static constexpr size_t part_count = W / part_width;
+		using part_type = mask<T, part_width>;
+
+		SIMD_FORCEINLINE mask() : m_parts() {}
+		explicit SIMD_FORCEINLINE mask(bool b);
+		template < class... Ts, std::enable_if_t<sizeof...(Ts) == W && (std::is_same_v<Ts, bool> && ...), int> = 0 >
+		explicit SIMD_FORCEINLINE mask(Ts... bs) : mask(std::array<bool, width>{ { bs... } }) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width> &arr);
+		explicit SIMD_FORCEINLINE mask(const vector<T, W> &v);
+		// Lanes below count set, e.g. for the tail of a loop through load/store with a mask (masked.hpp)
+		static SIMD_FORCEINLINE mask<T, W> first_n(size_t count);
+
+		SIMD_FORCEINLINE part_type &part(size_t index) {
+			assert(index < part_count);
+			return m_parts[index];
+		}
+
+		SIMD_FORCEINLINE const part_type &part(size_t index) const {
+			assert(index < part_count);
+			return m_parts[index];
+		}
+
+		SIMD_FORCEINLINE bool operator[](size_t index) const {
+			assert(index < width);
+			constexpr size_t bits = detail::mask_lane_bits<T, part_width>;
+			return (m_parts[index / part_width].get_mask() >> (index % part_width * bits)) & 1;
+		}
+
+		friend SIMD_FORCEINLINE mask<T, W> operator==(const mask<T, W> &v1, const mask<T, W> &v2) {
+			mask<T, W> res;
+			for(size_t i = 0; i < part_count; ++i)
+				res.m_parts[i] = v1.m_parts[i] == v2.m_parts[i];
+			return res;
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator!=(const mask<T, W> &v1, const mask<T, W> &v2) {
+			mask<T, W> res;
+			for(size_t i = 0; i < part_count; ++i)
+				res.m_parts[i] = v1.m_parts[i] != v2.m_parts[i];
+			return res;
+		}
+
+		SIMD_FORCEINLINE mask<T, W> &operator&=(const mask<T, W> &v);
+		SIMD_FORCEINLINE mask<T, W> &operator|=(const mask<T, W> &v);
+		SIMD_FORCEINLINE mask<T, W> &operator^=(const mask<T, W> &v);
+
+		friend SIMD_FORCEINLINE mask<T, W> operator~(const mask<T, W> &v) {
+			mask<T, W> res;
+			for(size_t i = 0; i < part_count; ++i)
+				res.m_parts[i] = ~v.m_parts[i];
+			return res;
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator&(mask<T, W> v1, const mask<T, W> &v2) {
+			return v1 &= v2;
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator|(mask<T, W> v1, const mask<T, W> &v2) {
+			return v1 |= v2;
+		}
+		friend SIMD_FORCEINLINE mask<T, W> operator^(mask<T, W> v1, const mask<T, W> &v2) {
+			return v1 ^= v2;
+		}
+		friend SIMD_FORCEINLINE mask<T, W> andnot(const mask<T, W> &v1, const mask<T, W> &v2) {
+			mask<T, W> res;
+			for(size_t i = 0; i < part_count; ++i)
+				res.m_parts[i] = andnot(v1.m_parts[i], v2.m_parts[i]);
+			return res;
+		}
+
+		// Concatenation of the parts' masks, i.e. the same bits a native register of this width would yield
+		SIMD_FORCEINLINE std::uint64_t get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const mask<T, W> &m) {
+			stream << '(';
+			for (size_t i = 0; i < m.width - 1; ++i) {
+				stream << m[i] << ' ';
+			}
+			stream << m[m.width - 1] << ')';
+			return stream;
+		}
+
+	private:
+		std::array<part_type, part_count> m_parts;
+	};
+
+	template < class T, size_t W >
+	vector<T, W>::vector(type f) {
+		for(auto &p : m_parts)
+			p = part_type(f);
+	}
+
+	template < class T, size_t W >
+	vector<T, W>::vector(const type *vals) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] = part_type(vals + i * part_width);
+	}
+
+	template < class T, size_t W >
+	vector<T, W>::vector(const type *vals, aligned_load) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] = part_type(vals + i * part_width, aligned_load{});
+	}
+
+	template < class T, size_t W >
+	template < class U >
+	vector<T, W>::vector(const vector<U, W> &v) {
+		if constexpr(detail::native_part_width<U, W>::value == part_width && std::is_constructible_v<part_type, vector<U, part_width>>) {
+			for(size_t i = 0; i < part_count; ++i)
+				m_parts[i] = part_type(v.part(i));
+		} else {
+			std::array<type, width> arr;
+			for(size_t i = 0; i < width; ++i)
+				arr[i] = static_cast<type>(v[i]);
+			*this = vector<T, W>(arr);
+		}
+	}
+
+	template < class T, size_t W >
+	template < class U, size_t V, std::enable_if_t<V != W, int> >
+	vector<T, W>::vector(const vector<U, V> &v) {
+		std::array<type, width> arr{};
+		for(size_t i = 0; i < (V < W ? V : W); ++i)
+			arr[i] = static_cast<type>(v[i]);
+		*this = vector<T, W>(arr);
+	}
+
+	template < class T, size_t W >
+	void vector<T, W>::store(type *vals) const {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i].store(vals + i * part_width);
+	}
+
+	template < class T, size_t W >
+	void vector<T, W>::store(type *vals, aligned_store) const {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i].store(vals + i * part_width, aligned_store{});
+	}
+
+	template < class T, size_t W >
+	void vector<T, W>::stream(type *vals) const {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i].stream(vals + i * part_width);
+	}
+
+	template < class T, size_t W >
+	void vector<T, W>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		size_t i = 0;
+		for(; count >= part_width; ++i, count -= part_width)
+			m_parts[i].store(vals + i * part_width);
+		if(count > 0)
+			m_parts[i].store_n(vals + i * part_width, count);
+	}
+
+	template < class T, size_t W >
+	template < class F >
+	vector<T, W> vector<T, W>::apply(F f) const {
+		vector<T, W> res;
+		for(size_t i = 0; i < part_count; ++i)
+			res.m_parts[i] = f(m_parts[i]);
+		return res;
+	}
+
+	template < class T, size_t W >
+	template < class F >
+	vector<T, W> vector<T, W>::apply(const vector<T, W> &v, F f) const {
+		vector<T, W> res;
+		for(size_t i = 0; i < part_count; ++i)
+			res.m_parts[i] = f(m_parts[i], v.m_parts[i]);
+		return res;
+	}
+
+	template < class T, size_t W >
+	template < class F >
+	vector<T, W> vector<T, W>::apply(const vector<T, W> &v1, const vector<T, W> &v2, F f) const {
+		vector<T, W> res;
+		for(size_t i = 0; i < part_count; ++i)
+			res.m_parts[i] = f(m_parts[i], v1.m_parts[i], v2.m_parts[i]);
+		return res;
+	}
+
+	template < class T, size_t W >
+	template < class F >
+	mask<T, W> vector<T, W>::compare(const vector<T, W> &v, F f) const {
+		// 128/256 bit types compare into vectors, AVX-512 types into masks; the part mask accepts both
+		mask<T, W> res;
+		for(size_t i = 0; i < part_count; ++i)
+			res.part(i) = typename mask<T, W>::part_type(f(m_parts[i], v.m_parts[i]));
+		return res;
+	}
+
+	template < class T, size_t W >
+	vector<detail::product_type<T>, W / 2> vector<T, W>::widening_mul(const vector<T, W> &v, size_t offset) const {
+		static_assert(std::is_integral_v<T> && sizeof(T) == 4, "Widening multiplies require 32 bit integer lanes");
+		using P = detail::product_type<T>;
+		vector<P, W / 2> res;
+		if constexpr(part_width > 1 && detail::native_part_width<P, W / 2>::value == part_width / 2) {
+			// The 64 bit parts line up with the 32 bit ones
+			for(size_t i = 0; i < part_count; ++i)
+				res.part(i) = offset ? mul_odd(m_parts[i], v.m_parts[i]) : mul_even(m_parts[i], v.m_parts[i]);
+		} else {
+			for(size_t i = 0; i < W / 2; ++i)
+				res[i] = static_cast<P>((*this)[2 * i + offset]) * v[2 * i + offset];
+		}
+		return res;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::operator+=(const vector<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] += v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::operator-=(const vector<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] -= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::operator*=(const vector<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] *= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::operator/=(const vector<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] /= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::operator&=(const vector<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] &= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::operator|=(const vector<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] |= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::operator^=(const vector<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] ^= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::hadd(const vector<T, W> &v) {
+		if constexpr(part_width == 1) {
+			*this = horizontal_scalar(v, [](const part_type &a, const part_type &b) { return a + b; });
+		} else {
+			for(size_t i = 0; i < part_count; ++i)
+				m_parts[i].hadd(v.m_parts[i]);
+		}
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::hsub(const vector<T, W> &v) {
+		if constexpr(part_width == 1) {
+			*this = horizontal_scalar(v, [](const part_type &a, const part_type &b) { return a - b; });
+		} else {
+			for(size_t i = 0; i < part_count; ++i)
+				m_parts[i].hsub(v.m_parts[i]);
+		}
+		return *this;
+	}
+
+	template < class T, size_t W >
+	template < class F >
+	vector<T, W> vector<T, W>::horizontal_scalar(const vector<T, W> &v, F f) const {
+		// Mirrors the SIMD instructions, which combine pairs within each 128 bit block:
+		// A1+A2, A3+A4, B1+B2, B3+B4 for four float lanes
+		constexpr size_t block = W < 16 / sizeof(T) ? W : 16 / sizeof(T);
+		vector<T, W> res;
+		for(size_t b = 0; b < W; b += block) {
+			for(size_t i = 0; i < block / 2; ++i) {
+				res.m_parts[b + i] = f(m_parts[b + 2 * i], m_parts[b + 2 * i + 1]);
+				res.m_parts[b + block / 2 + i] = f(v.m_parts[b + 2 * i], v.m_parts[b + 2 * i + 1]);
+			}
+		}
+		return res;
+	}
+
+	template < class T, size_t W >
+	T vector<T, W>::hadd() const {
+		part_type sum = m_parts[0];
+		for(size_t i = 1; i < part_count; ++i)
+			sum += m_parts[i];
+		return sum.hadd();
+	}
+
+	template < class T, size_t W >
+	T vector<T, W>::hsub() const {
+		// Part i enters the difference tree negated if its index has an odd number of set bits
+		part_type pos = m_parts[0];
+		part_type neg = m_parts[1];
+		for(size_t i = 2; i < part_count; ++i) {
+			size_t bits = 0;
+			for(size_t j = i; j != 0; j &= j - 1)
+				++bits;
+			if(bits % 2)
+				neg += m_parts[i];
+			else
+				pos += m_parts[i];
+		}
+		return pos.hsub() - neg.hsub();
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::abs() {
+		for(auto &p : m_parts)
+			p.abs();
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::ceil() {
+		for(auto &p : m_parts)
+			p.ceil();
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::floor() {
+		for(auto &p : m_parts)
+			p.floor();
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> &vector<T, W>::round(int mode) {
+		for(auto &p : m_parts)
+			p.round(mode);
+		return *this;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> vector<T, W>::sqrt() const {
+		return apply([](const part_type &p) { return p.sqrt(); });
+	}
+
+	template < class T, size_t W >
+	vector<T, W> vector<T, W>::rsqrt() const {
+		return apply([](const part_type &p) { return p.rsqrt(); });
+	}
+
+	template < class T, size_t W >
+	mask<T, W>::mask(bool b) {
+		for(auto &p : m_parts)
+			p = part_type(b);
+	}
+
+	template < class T, size_t W >
+	mask<T, W>::mask(const std::array<bool, width> &arr) {
+		for(size_t i = 0; i < part_count; ++i) {
+			std::array<bool, part_width> part;
+			for(size_t j = 0; j < part_width; ++j)
+				part[j] = arr[i * part_width + j];
+			m_parts[i] = part_type(part);
+		}
+	}
+
+	template < class T, size_t W >
+	mask<T, W>::mask(const vector<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] = part_type(v.part(i));
+	}
+
+	template < class T, size_t W >
+	mask<T, W> mask<T, W>::first_n(size_t count) {
+		mask<T, W> res;
+		for(size_t i = 0; i < part_count; ++i)
+			res.m_parts[i] = part_type::first_n(count > i * part_width ? count - i * part_width : 0);
+		return res;
+	}
+
+	template < class T, size_t W >
+	mask<T, W> &mask<T, W>::operator&=(const mask<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] &= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	mask<T, W> &mask<T, W>::operator|=(const mask<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] |= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	mask<T, W> &mask<T, W>::operator^=(const mask<T, W> &v) {
+		for(size_t i = 0; i < part_count; ++i)
+			m_parts[i] ^= v.m_parts[i];
+		return *this;
+	}
+
+	template < class T, size_t W >
+	std::uint64_t mask<T, W>::get_mask() const {
+		constexpr size_t bits = part_width * detail::mask_lane_bits<T, part_width>;
+		static_assert(bits * part_count <= 64, "Mask does not fit into 64 bits");
+		std::uint64_t res = 0;
+		for(size_t i = 0; i < part_count; ++i)
+			res |= (static_cast<std::uint64_t>(m_parts[i].get_mask()) & ((std::uint64_t(1) << bits) - 1)) << (i * bits);
+		return res;
+	}
+
+	template < class T, size_t W >
+	bool mask<T, W>::all() const {
+		for(const auto &p : m_parts)
+			if(!p.all())
+				return false;
+		return true;
+	}
+
+	template < class T, size_t W >
+	bool mask<T, W>::any() const {
+		for(const auto &p : m_parts)
+			if(p.any())
+				return true;
+		return false;
+	}
+
+	template < class T, size_t W >
+	bool mask<T, W>::none() const {
+		return !any();
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
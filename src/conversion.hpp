@@ -6,8 +6,19 @@
 #include "float64x4.hpp"
 #include "int32x4.hpp"
 #include "int32x8.hpp"
+#include "int64x2.hpp"
+#include "int64x4.hpp"
+#include "float32x16.hpp"
+#include "float64x8.hpp"
+#include "int32x16.hpp"
+#include "int64x8.hpp"
+#include "uint32x4.hpp"
+#include "uint32x8.hpp"
+#include "uint64x2.hpp"
+#include "uint64x4.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 #if SIMD_SUPPORTS(SIMD_SSE2)
 	vector<float, 4>::vector(const vector<int, 4> &v) : vector_base(_mm_cvtepi32_ps(v.native())) {}
@@ -16,6 +27,30 @@ namespace simd {
 	vector<double, 2>::vector(const vector<float, 4> &v) : vector_base(_mm_cvtps_pd(v.native())) {}
 	vector<int, 4>::vector(const vector<float, 4> &v) : vector_base(_mm_cvtps_epi32(v.native())) {}
 	vector<int, 4>::vector(const vector<double, 2> &v) : vector_base(_mm_cvtpd_epi32(v.native())) {}
+
+	// Unsigned lanes go through the signed conversions, split in 16 bit halves or biased by 2^31
+	vector<float, 4>::vector(const vector<std::uint32_t, 4> &v) {
+		auto hi = _mm_cvtepi32_ps(_mm_srli_epi32(v.native(), 16));
+		auto lo = _mm_cvtepi32_ps(_mm_and_si128(v.native(), _mm_set1_epi32(0xFFFF)));
+		m_vec = _mm_add_ps(_mm_mul_ps(hi, _mm_set1_ps(65536.0f)), lo);
+	}
+
+	vector<double, 2>::vector(const vector<std::uint32_t, 4> &v) {
+		auto biased = _mm_xor_si128(v.native(), _mm_set1_epi32(INT32_MIN));
+		m_vec = _mm_add_pd(_mm_cvtepi32_pd(biased), _mm_set1_pd(2147483648.0));
+	}
+
+	vector<std::uint32_t, 4>::vector(const vector<float, 4> &v) {
+		const auto offset = _mm_set1_ps(2147483648.0f);
+		auto big = _mm_cmpge_ps(v.native(), offset);
+		auto converted = _mm_cvtps_epi32(_mm_sub_ps(v.native(), _mm_and_ps(big, offset)));
+		m_vec = _mm_xor_si128(converted, _mm_slli_epi32(_mm_castps_si128(big), 31));
+	}
+
+	vector<std::uint32_t, 4>::vector(const vector<double, 2> &v) {
+		auto converted = _mm_cvtpd_epi32(_mm_sub_pd(v.native(), _mm_set1_pd(2147483648.0)));
+		m_vec = _mm_xor_si128(converted, _mm_set_epi32(0, 0, INT32_MIN, INT32_MIN));
+	}
 #endif // SIMD_SUPPORTS(SIMD_SSE2)
 
 #if SIMD_SUPPORTS(SIMD_AVX)
@@ -23,11 +58,101 @@ namespace simd {
 	vector<double, 4>::vector(const vector<int, 4> &v) : vector_base(_mm256_cvtepi32_pd(v.native())) {}
 	vector<double, 4>::vector(const vector<float, 4> &v) : vector_base(_mm256_cvtps_pd(v.native())) {}
 	vector<int, 4>::vector(const vector<double, 4> &v) : vector_base(_mm256_cvtpd_epi32(v.native())) {}
+
+	vector<double, 4>::vector(const vector<std::uint32_t, 4> &v) {
+		auto biased = _mm_xor_si128(v.native(), _mm_set1_epi32(INT32_MIN));
+		m_vec = _mm256_add_pd(_mm256_cvtepi32_pd(biased), _mm256_set1_pd(2147483648.0));
+	}
+
+	vector<std::uint32_t, 4>::vector(const vector<double, 4> &v) {
+		auto converted = _mm256_cvtpd_epi32(_mm256_sub_pd(v.native(), _mm256_set1_pd(2147483648.0)));
+		m_vec = _mm_xor_si128(converted, _mm_set1_epi32(INT32_MIN));
+	}
 #endif // SIMD_SUPPORTS(SIMD_AVX)
 
 #if SIMD_SUPPORTS(SIMD_AVX2)
 	vector<float, 8>::vector(const vector<int, 8> &v) : vector_base(_mm256_cvtepi32_ps(v.native())) {}
 	vector<int, 8>::vector(const vector<float, 8> & v) : vector_base(_mm256_cvtps_epi32(v.native())) {}
+
+	vector<float, 8>::vector(const vector<std::uint32_t, 8> &v) {
+		auto hi = _mm256_cvtepi32_ps(_mm256_srli_epi32(v.native(), 16));
+		auto lo = _mm256_cvtepi32_ps(_mm256_and_si256(v.native(), _mm256_set1_epi32(0xFFFF)));
+		m_vec = _mm256_add_ps(_mm256_mul_ps(hi, _mm256_set1_ps(65536.0f)), lo);
+	}
+
+	vector<std::uint32_t, 8>::vector(const vector<float, 8> &v) {
+		const auto offset = _mm256_set1_ps(2147483648.0f);
+		auto big = _mm256_cmp_ps(v.native(), offset, _CMP_GE_OQ);
+		auto converted = _mm256_cvtps_epi32(_mm256_sub_ps(v.native(), _mm256_and_ps(big, offset)));
+		m_vec = _mm256_xor_si256(converted, _mm256_slli_epi32(_mm256_castps_si256(big), 31));
+	}
 #endif // SUPPORTS(SIMD_AVX2)
 
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	vector<float, 16>::vector(const vector<int, 16> &v) : vector_base(_mm512_cvtepi32_ps(v.native())) {}
+	vector<double, 8>::vector(const vector<int, 8> &v) : vector_base(_mm512_cvtepi32_pd(v.native())) {}
+	vector<double, 8>::vector(const vector<float, 8> &v) : vector_base(_mm512_cvtps_pd(v.native())) {}
+	vector<int, 16>::vector(const vector<float, 16> &v) : vector_base(_mm512_cvtps_epi32(v.native())) {}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+	vector<double, 8>::vector(const vector<std::int64_t, 8> &v) : vector_base(_mm512_cvtepi64_pd(v.native())) {}
+	vector<std::int64_t, 8>::vector(const vector<double, 8> &v) : vector_base(_mm512_cvtpd_epi64(v.native())) {}
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+
+	// The widening multiplies are declared with the 32 bit types but need the 64 bit ones
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	vector<std::int64_t, 2> mul_even(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int64_t, 2>(_mm_mul_epi32(v1.native(), v2.native()));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// Unsigned products, corrected by subtracting the other operand for each negative one
+		auto correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(v1.native(), 31), v2.native()),
+										_mm_and_si128(_mm_srai_epi32(v2.native(), 31), v1.native()));
+		return vector<std::int64_t, 2>(_mm_sub_epi64(_mm_mul_epu32(v1.native(), v2.native()), _mm_slli_epi64(correction, 32)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<std::int64_t, 2> mul_odd(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2) {
+		return mul_even(vector<std::int32_t, 4>(_mm_srli_epi64(v1.native(), 32)), vector<std::int32_t, 4>(_mm_srli_epi64(v2.native(), 32)));
+	}
+
+	vector<std::uint64_t, 2> mul_even(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		return vector<std::uint64_t, 2>(_mm_mul_epu32(v1.native(), v2.native()));
+	}
+
+	vector<std::uint64_t, 2> mul_odd(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		return vector<std::uint64_t, 2>(_mm_mul_epu32(_mm_srli_epi64(v1.native(), 32), _mm_srli_epi64(v2.native(), 32)));
+	}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+	vector<std::int64_t, 4> mul_even(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2) {
+		return vector<std::int64_t, 4>(_mm256_mul_epi32(v1.native(), v2.native()));
+	}
+
+	vector<std::int64_t, 4> mul_odd(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2) {
+		return vector<std::int64_t, 4>(_mm256_mul_epi32(_mm256_srli_epi64(v1.native(), 32), _mm256_srli_epi64(v2.native(), 32)));
+	}
+
+	vector<std::uint64_t, 4> mul_even(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		return vector<std::uint64_t, 4>(_mm256_mul_epu32(v1.native(), v2.native()));
+	}
+
+	vector<std::uint64_t, 4> mul_odd(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		return vector<std::uint64_t, 4>(_mm256_mul_epu32(_mm256_srli_epi64(v1.native(), 32), _mm256_srli_epi64(v2.native(), 32)));
+	}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	vector<std::int64_t, 8> mul_even(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return vector<std::int64_t, 8>(_mm512_mul_epi32(v1.native(), v2.native()));
+	}
+
+	vector<std::int64_t, 8> mul_odd(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return vector<std::int64_t, 8>(_mm512_mul_epi32(_mm512_srli_epi64(v1.native(), 32), _mm512_srli_epi64(v2.native(), 32)));
+	}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include "versions.hpp"
+#include "util.hpp"
+
+// Runtime selection between several builds of the same kernel.
+//
+// Put the kernel into its own source file and compile it once per instruction set (CMake:
+// simdwrapper_add_dispatch_sources). Inside, define it in a namespace named SIMD_ISA_NAMESPACE so every
+// build gets a distinct symbol:
+//
+//     namespace kernels { namespace SIMD_ISA_NAMESPACE {
+//         float sum(const float *vals, size_t count) { ... }
+//     } }
+//
+// The calling translation unit declares the variants it links against and lets a dispatcher pick one:
+//
+//     namespace kernels {
+//         namespace sse2 { float sum(const float *vals, size_t count); }
+//         namespace avx2 { float sum(const float *vals, size_t count); }
+//     }
+//     static const simd::dispatcher<float(const float *, size_t)> sum{
+//         { SIMD_SSE2, &kernels::sse2::sum },
+//         { SIMD_AVX2, &kernels::avx2::sum }
+//     };
+
+namespace simd {
+
+	// Probes the CPU on first use only, every further call returns the cached result
+	inline int runtime_version() {
+		static const int version = sse_runtime_version();
+		return version;
+	}
+
+	template < class F >
+	class dispatcher;
+
+	template < class R, class... Args >
+	class dispatcher<R(Args...)> {
+	public:
+		using function_type = R(*)(Args...);
+
+		struct target {
+			int required_version;
+			function_type function;
+		};
+
+		dispatcher(std::initializer_list<target> targets) : dispatcher(targets, runtime_version()) {}
+		dispatcher(std::initializer_list<target> targets, int available_version) : m_selected(select(targets, available_version)) {}
+
+		SIMD_FORCEINLINE R operator()(Args... args) const {
+			return m_selected.function(std::forward<Args>(args)...);
+		}
+
+		SIMD_FORCEINLINE function_type function() const {
+			return m_selected.function;
+		}
+
+		SIMD_FORCEINLINE int version() const {
+			return m_selected.required_version;
+		}
+
+	private:
+		static target select(std::initializer_list<target> targets, int available_version) {
+			const target *best = nullptr;
+			for(const target &t : targets) {
+				if(t.required_version <= available_version && (best == nullptr || t.required_version > best->required_version))
+					best = &t;
+			}
+			if(best == nullptr)
+				throw std::runtime_error("No kernel variant is supported by this CPU");
+			return *best;
+		}
+
+		target m_selected;
+	};
+
+} // namespace simd
\ No newline at end of file
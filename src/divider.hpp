@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+#include "vector.hpp"
+#include "scalar.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	// Division by a runtime invariant, e.g. a bucket count or stride that stays the same for a whole loop.
+	// The constructor precomputes a magic multiplier and shift (Granlund and Montgomery, the same scheme as
+	// libdivide), so dividing a vector only takes a multiply-high, shifts and adds. Rounds towards zero
+	// like the built-in division.
+	template < class T >
+	class divider {
+		static_assert(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8), "divider requires 32 or 64 bit integers");
+
+	public:
+		using type = T;
+
+		explicit divider(type d);
+
+		type divisor() const {
+			return m_divisor;
+		}
+
+		template < size_t W >
+		SIMD_FORCEINLINE vector<T, W> divide(const vector<T, W> &n) const;
+
+		template < size_t W >
+		friend SIMD_FORCEINLINE vector<T, W> operator/(const vector<T, W> &n, const divider<T> &d) {
+			return d.divide(n);
+		}
+		template < size_t W >
+		friend SIMD_FORCEINLINE vector<T, W> &operator/=(vector<T, W> &n, const divider<T> &d) {
+			return n = d.divide(n);
+		}
+		friend SIMD_FORCEINLINE type operator/(type n, const divider<T> &d) {
+			return d.divide(vector<T, 1>(n))[0];
+		}
+
+	private:
+		static constexpr int bits = 8 * sizeof(T);
+		// The magic numbers of unsigned divisors have one bit more precision, the dividend has no sign bit
+		static constexpr int magic_bits = std::is_signed_v<T> ? bits - 1 : bits;
+		using unsigned_type = std::make_unsigned_t<T>;
+
+		type m_divisor;
+		// Zero for powers of two, which only need a shift
+		type m_magic;
+		int m_shift;
+		// The magic number did not fit and the numerator has to be added after the multiplication
+		bool m_add;
+	};
+
+	template < class T >
+	divider<T>::divider(type d) : m_divisor(d), m_magic(0), m_shift(0), m_add(false) {
+		assert(d != 0);
+		bool negative = false;
+		if constexpr(std::is_signed_v<T>)
+			negative = d < 0;
+		const unsigned_type abs_d = negative ? unsigned_type(0) - unsigned_type(d) : unsigned_type(d);
+		int log2 = bits - 1;
+		while((abs_d >> log2) == 0)
+			--log2;
+
+		if((abs_d & (abs_d - 1)) == 0) {
+			m_shift = log2;
+			return;
+		}
+
+		// 2^(magic_bits + log2) / abs_d by long division, the quotient fits into unsigned_type
+		const int dividend_bit = magic_bits + log2;
+		unsigned_type quotient = 0;
+		unsigned_type remainder = 0;
+		for(int i = dividend_bit; i >= 0; --i) {
+			// Unsigned divisors can have the top bit set, so can the remainder before the shift
+			const bool carry = (remainder >> (bits - 1)) != 0;
+			remainder = (remainder << 1) | (i == dividend_bit ? 1 : 0);
+			quotient <<= 1;
+			if(carry || remainder >= abs_d) {
+				remainder -= abs_d;
+				quotient |= 1;
+			}
+		}
+
+		if(abs_d - remainder < (unsigned_type(1) << log2)) {
+			m_shift = std::is_signed_v<T> ? log2 - 1 : log2;
+		} else {
+			// One bit more precision than T can hold, made up for by adding the numerator
+			quotient += quotient;
+			const unsigned_type twice_remainder = remainder + remainder;
+			if(twice_remainder >= abs_d || twice_remainder < remainder)
+				quotient += 1;
+			m_shift = log2;
+			m_add = true;
+		}
+		quotient += 1;
+		m_magic = static_cast<type>(negative ? unsigned_type(0) - quotient : quotient);
+	}
+
+	template < class T >
+	template < size_t W >
+	vector<T, W> divider<T>::divide(const vector<T, W> &n) const {
+		using vector_type = vector<T, W>;
+		if constexpr(std::is_unsigned_v<T>) {
+			if(m_magic == 0)
+				return n >> m_shift;
+			const vector_type q = mulhi(n, vector_type(m_magic));
+			if(!m_add)
+				return q >> m_shift;
+			// (n + q) >> 1 without the carry out of the top bit
+			return (((n - q) >> 1) + q) >> m_shift;
+		} else {
+			// All ones for negative divisors to negate via (x ^ sign) - sign
+			const vector_type sign(m_divisor < 0 ? type(-1) : type(0));
+			if(m_magic == 0) {
+				// Negative numerators need a bias of 2^shift - 1 to round towards zero
+				const vector_type bias(static_cast<type>((unsigned_type(1) << m_shift) - 1));
+				const vector_type q = (n + ((n >> (bits - 1)) & bias)) >> m_shift;
+				return (q ^ sign) - sign;
+			}
+
+			vector_type q = mulhi(n, vector_type(m_magic));
+			if(m_add)
+				q += (n ^ sign) - sign;
+			q = q >> m_shift;
+			// Round towards zero by adding one to negative quotients
+			return q - (q >> (bits - 1));
+		}
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
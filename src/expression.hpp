@@ -0,0 +1,487 @@
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "float32x4.hpp"
+#include "float32x8.hpp"
+#include "float64x2.hpp"
+#include "float64x4.hpp"
+#include "int32x4.hpp"
+#include "int32x8.hpp"
+#include "int64x2.hpp"
+#include "int64x4.hpp"
+#include "float32x16.hpp"
+#include "float64x8.hpp"
+#include "int32x16.hpp"
+#include "int64x8.hpp"
+
+// Opt-in expression templates. expr::lazy(v) wraps a vector, operators with a wrapped operand build an
+// expression tree instead of temporaries, and the tree is evaluated when it is converted to a vector or mask,
+// stored or passed to eval(). Evaluation replaces patterns of the tree by single operations:
+//   a * b + c, c + a * b -> fmadd    a * b - c -> fmsub    c - a * b -> fnmadd    (floating point only)
+//   ~a & b, b & ~a -> andnot
+//   (a < b) & (c < d) -> one mask, on AVX-512 the second compare runs under the mask of the first
+// Fused multiply-adds round once, so results may differ from the eager operators in the last bit.
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace expr {
+		namespace op {
+
+			struct add {};
+			struct sub {};
+			struct mul {};
+			struct div {};
+			struct bit_and {};
+			struct bit_or {};
+			struct bit_xor {};
+			struct bit_not {};
+
+			// Comparisons with the predicates of the AVX-512 compares, matching the eager operators
+			struct equal {
+				static constexpr int float_predicate = _CMP_EQ_OQ;
+				static constexpr int int_predicate = 0; // _MM_CMPINT_EQ
+			};
+			struct not_equal {
+				static constexpr int float_predicate = _CMP_NEQ_UQ;
+				static constexpr int int_predicate = 4; // _MM_CMPINT_NE
+			};
+			struct less {
+				static constexpr int float_predicate = _CMP_LT_OQ;
+				static constexpr int int_predicate = 1; // _MM_CMPINT_LT
+			};
+			struct less_equal {
+				static constexpr int float_predicate = _CMP_LE_OQ;
+				static constexpr int int_predicate = 2; // _MM_CMPINT_LE
+			};
+			struct greater {
+				static constexpr int float_predicate = _CMP_GT_OQ;
+				static constexpr int int_predicate = 6; // _MM_CMPINT_NLE
+			};
+			struct greater_equal {
+				static constexpr int float_predicate = _CMP_GE_OQ;
+				static constexpr int int_predicate = 5; // _MM_CMPINT_NLT
+			};
+
+		} // namespace op
+	} // namespace expr
+
+	namespace detail {
+
+		// ~a & b
+#if SIMD_SUPPORTS(SIMD_SSE)
+		SIMD_FORCEINLINE vector<float, 4> andnot(const vector<float, 4> &a, const vector<float, 4> &b) {
+			return vector<float, 4>(_mm_andnot_ps(a.native(), b.native()));
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE)
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+		SIMD_FORCEINLINE vector<double, 2> andnot(const vector<double, 2> &a, const vector<double, 2> &b) {
+			return vector<double, 2>(_mm_andnot_pd(a.native(), b.native()));
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 4> andnot(const vector<std::int32_t, 4> &a, const vector<std::int32_t, 4> &b) {
+			return vector<std::int32_t, 4>(_mm_andnot_si128(a.native(), b.native()));
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 2> andnot(const vector<std::int64_t, 2> &a, const vector<std::int64_t, 2> &b) {
+			return vector<std::int64_t, 2>(_mm_andnot_si128(a.native(), b.native()));
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+		SIMD_FORCEINLINE vector<float, 8> andnot(const vector<float, 8> &a, const vector<float, 8> &b) {
+			return vector<float, 8>(_mm256_andnot_ps(a.native(), b.native()));
+		}
+
+		SIMD_FORCEINLINE vector<double, 4> andnot(const vector<double, 4> &a, const vector<double, 4> &b) {
+			return vector<double, 4>(_mm256_andnot_pd(a.native(), b.native()));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+		SIMD_FORCEINLINE vector<std::int32_t, 8> andnot(const vector<std::int32_t, 8> &a, const vector<std::int32_t, 8> &b) {
+			return vector<std::int32_t, 8>(_mm256_andnot_si256(a.native(), b.native()));
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 4> andnot(const vector<std::int64_t, 4> &a, const vector<std::int64_t, 4> &b) {
+			return vector<std::int64_t, 4>(_mm256_andnot_si256(a.native(), b.native()));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+		// vandnps/vandnpd need AVX512DQ, the integer form does the same
+		SIMD_FORCEINLINE vector<float, 16> andnot(const vector<float, 16> &a, const vector<float, 16> &b) {
+			return vector<float, 16>(_mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(a.native()), _mm512_castps_si512(b.native()))));
+		}
+
+		SIMD_FORCEINLINE vector<double, 8> andnot(const vector<double, 8> &a, const vector<double, 8> &b) {
+			return vector<double, 8>(_mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(a.native()), _mm512_castpd_si512(b.native()))));
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 16> andnot(const vector<std::int32_t, 16> &a, const vector<std::int32_t, 16> &b) {
+			return vector<std::int32_t, 16>(_mm512_andnot_si512(a.native(), b.native()));
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 8> andnot(const vector<std::int64_t, 8> &a, const vector<std::int64_t, 8> &b) {
+			return vector<std::int64_t, 8>(_mm512_andnot_si512(a.native(), b.native()));
+		}
+
+		// Compares the lanes selected by m, the others are false
+		template < class Op >
+		SIMD_FORCEINLINE mask<float, 16> masked_compare(const mask<float, 16> &m, const vector<float, 16> &a, const vector<float, 16> &b) {
+			return mask<float, 16>(_mm512_mask_cmp_ps_mask(m.native(), a.native(), b.native(), Op::float_predicate));
+		}
+
+		template < class Op >
+		SIMD_FORCEINLINE mask<double, 8> masked_compare(const mask<double, 8> &m, const vector<double, 8> &a, const vector<double, 8> &b) {
+			return mask<double, 8>(_mm512_mask_cmp_pd_mask(m.native(), a.native(), b.native(), Op::float_predicate));
+		}
+
+		template < class Op >
+		SIMD_FORCEINLINE mask<std::int32_t, 16> masked_compare(const mask<std::int32_t, 16> &m, const vector<std::int32_t, 16> &a, const vector<std::int32_t, 16> &b) {
+			return mask<std::int32_t, 16>(_mm512_mask_cmp_epi32_mask(m.native(), a.native(), b.native(), Op::int_predicate));
+		}
+
+		template < class Op >
+		SIMD_FORCEINLINE mask<std::int64_t, 8> masked_compare(const mask<std::int64_t, 8> &m, const vector<std::int64_t, 8> &a, const vector<std::int64_t, 8> &b) {
+			return mask<std::int64_t, 8>(_mm512_mask_cmp_epi64_mask(m.native(), a.native(), b.native(), Op::int_predicate));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+		// Composite vectors part by part, scalar lanes through the operators
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> andnot(const vector<T, W> &a, const vector<T, W> &b);
+
+		template < class T, size_t W >
+		vector<T, W> andnot(const vector<T, W> &a, const vector<T, W> &b) {
+			if constexpr(W == 1 || has_native_vector<T, W>::value) {
+				return ~a & b;
+			} else {
+				vector<T, W> res;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					res.part(i) = detail::andnot(a.part(i), b.part(i));
+				return res;
+			}
+		}
+
+	} // namespace detail
+
+	namespace expr {
+
+		template < class V >
+		class leaf {
+		public:
+			using value_type = V;
+
+			explicit SIMD_FORCEINLINE leaf(const V &v) : m_value(v) {}
+
+			SIMD_FORCEINLINE const V &value() const {
+				return m_value;
+			}
+
+		private:
+			V m_value;
+		};
+
+		template < class Op, class... A >
+		class node;
+
+		template < class E >
+		struct is_expression : std::false_type {};
+		template < class V >
+		struct is_expression<leaf<V>> : std::true_type {};
+		template < class Op, class... A >
+		struct is_expression<node<Op, A...>> : std::true_type {};
+
+		template < class E >
+		struct is_value : std::false_type {};
+		template < class T, size_t W >
+		struct is_value<vector<T, W>> : std::true_type {};
+		template < class T, size_t W >
+		struct is_value<mask<T, W>> : std::true_type {};
+
+		template < class E, class Op >
+		struct is_node : std::false_type {};
+		template < class Op, class... A >
+		struct is_node<node<Op, A...>, Op> : std::true_type {};
+
+		template < class Op >
+		constexpr bool is_comparison = std::is_same_v<Op, op::equal> || std::is_same_v<Op, op::not_equal> || std::is_same_v<Op, op::less> ||
+									   std::is_same_v<Op, op::less_equal> || std::is_same_v<Op, op::greater> || std::is_same_v<Op, op::greater_equal>;
+
+		template < class E >
+		struct is_compare : std::false_type {};
+		template < class Op, class L, class R >
+		struct is_compare<node<Op, L, R>> : std::bool_constant<is_comparison<Op>> {};
+
+		// Comparisons yield masks, everything else the type of the operands
+		template < class Op, class V >
+		struct result {
+			using type = V;
+		};
+		template < class Op, class T, size_t W >
+		struct result<Op, vector<T, W>> {
+			using type = std::conditional_t<is_comparison<Op>, mask<T, W>, vector<T, W>>;
+		};
+
+		template < class E >
+		SIMD_FORCEINLINE auto evaluate(const E &e);
+
+		template < class Op, class... A >
+		class node {
+		public:
+			using operator_type = Op;
+			using first_type = std::tuple_element_t<0, std::tuple<A...>>;
+			using value_type = typename result<Op, typename first_type::value_type>::type;
+			static_assert((std::is_same_v<typename A::value_type, typename first_type::value_type> && ...), "operands of different types");
+
+			explicit SIMD_FORCEINLINE node(const A &... args) : m_args(args...) {}
+
+			template < size_t I >
+			SIMD_FORCEINLINE const auto &arg() const {
+				return std::get<I>(m_args);
+			}
+
+			SIMD_FORCEINLINE value_type eval() const {
+				return expr::evaluate(*this);
+			}
+
+			SIMD_FORCEINLINE operator value_type() const {
+				return eval();
+			}
+
+			template < class T, class... Tag >
+			SIMD_FORCEINLINE void store(T *vals, Tag... tag) const {
+				eval().store(vals, tag...);
+			}
+
+		private:
+			std::tuple<A...> m_args;
+		};
+
+		template < class V >
+		SIMD_FORCEINLINE leaf<V> lazy(const V &v) {
+			static_assert(is_value<V>::value, "lazy wraps simd vectors and masks");
+			return leaf<V>(v);
+		}
+
+		template < class E >
+		SIMD_FORCEINLINE auto eval(const E &e) {
+			return expr::evaluate(e);
+		}
+
+		template < class E >
+		SIMD_FORCEINLINE const E &wrap(const E &e, std::true_type) {
+			return e;
+		}
+
+		template < class V >
+		SIMD_FORCEINLINE leaf<V> wrap(const V &v, std::false_type) {
+			return leaf<V>(v);
+		}
+
+		template < class E >
+		SIMD_FORCEINLINE auto wrap(const E &e) {
+			return expr::wrap(e, is_expression<E>());
+		}
+
+		template < class E >
+		using operand_type = std::decay_t<decltype(expr::wrap(std::declval<const E &>()))>;
+
+		// At least one operand is an expression, the other one may be a plain vector or mask
+		template < class L, class R >
+		using enable_binary = std::enable_if_t<(is_expression<L>::value || is_expression<R>::value) &&
+											   (is_expression<L>::value || is_value<L>::value) && (is_expression<R>::value || is_value<R>::value)>;
+
+		template < class Op, class L, class R >
+		SIMD_FORCEINLINE node<Op, operand_type<L>, operand_type<R>> make(const L &l, const R &r) {
+			return node<Op, operand_type<L>, operand_type<R>>(expr::wrap(l), expr::wrap(r));
+		}
+
+		template < class Op, class E >
+		SIMD_FORCEINLINE node<Op, E> make(const E &e) {
+			return node<Op, E>(e);
+		}
+
+		template < class E >
+		constexpr bool is_fusable_product() {
+			if constexpr(is_node<E, op::mul>::value)
+				return std::is_floating_point_v<typename E::value_type::type>;
+			else
+				return false;
+		}
+
+		template < class T, size_t W >
+		SIMD_FORCEINLINE mask<T, W> fuse_andnot(const mask<T, W> &a, const mask<T, W> &b) {
+			return andnot(a, b);
+		}
+
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> fuse_andnot(const vector<T, W> &a, const vector<T, W> &b) {
+			return detail::andnot(a, b);
+		}
+
+		template < class Op, class T, size_t W >
+		SIMD_FORCEINLINE mask<T, W> compare(const vector<T, W> &a, const vector<T, W> &b) {
+			if constexpr(std::is_same_v<Op, op::equal>)
+				return mask<T, W>(a == b);
+			else if constexpr(std::is_same_v<Op, op::not_equal>)
+				return mask<T, W>(a != b);
+			else if constexpr(std::is_same_v<Op, op::less>)
+				return mask<T, W>(a < b);
+			else if constexpr(std::is_same_v<Op, op::less_equal>)
+				return mask<T, W>(a <= b);
+			else if constexpr(std::is_same_v<Op, op::greater>)
+				return mask<T, W>(a > b);
+			else
+				return mask<T, W>(a >= b);
+		}
+
+		// Mask of a chained comparison, under AVX-512 the comparison only runs on the lanes of m
+		template < class T, size_t W, class Op, class L, class R >
+		SIMD_FORCEINLINE mask<T, W> compare_under(const mask<T, W> &m, const node<Op, L, R> &e) {
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+			if constexpr(detail::has_native_mask<T, W>::value)
+				return detail::masked_compare<Op>(m, expr::evaluate(e.template arg<0>()), expr::evaluate(e.template arg<1>()));
+			else
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+				return m & expr::evaluate(e);
+		}
+
+		template < class E >
+		SIMD_FORCEINLINE auto evaluate(const E &e) {
+			if constexpr(!is_expression<E>::value) {
+				return e;
+			} else if constexpr(std::is_same_v<E, leaf<typename E::value_type>>) {
+				return e.value();
+			} else {
+				const auto &a0 = e.template arg<0>();
+				using L = std::decay_t<decltype(a0)>;
+				if constexpr(is_node<E, op::bit_not>::value) {
+					return ~expr::evaluate(a0);
+				} else {
+					const auto &a1 = e.template arg<1>();
+					using R = std::decay_t<decltype(a1)>;
+					if constexpr(is_node<E, op::add>::value) {
+						if constexpr(is_fusable_product<L>())
+							return fmadd(expr::evaluate(a0.template arg<0>()), expr::evaluate(a0.template arg<1>()), expr::evaluate(a1));
+						else if constexpr(is_fusable_product<R>())
+							return fmadd(expr::evaluate(a1.template arg<0>()), expr::evaluate(a1.template arg<1>()), expr::evaluate(a0));
+						else
+							return expr::evaluate(a0) + expr::evaluate(a1);
+					} else if constexpr(is_node<E, op::sub>::value) {
+						if constexpr(is_fusable_product<L>())
+							return fmsub(expr::evaluate(a0.template arg<0>()), expr::evaluate(a0.template arg<1>()), expr::evaluate(a1));
+						else if constexpr(is_fusable_product<R>())
+							return fnmadd(expr::evaluate(a1.template arg<0>()), expr::evaluate(a1.template arg<1>()), expr::evaluate(a0));
+						else
+							return expr::evaluate(a0) - expr::evaluate(a1);
+					} else if constexpr(is_node<E, op::mul>::value) {
+						return expr::evaluate(a0) * expr::evaluate(a1);
+					} else if constexpr(is_node<E, op::div>::value) {
+						return expr::evaluate(a0) / expr::evaluate(a1);
+					} else if constexpr(is_node<E, op::bit_and>::value) {
+						if constexpr(is_node<L, op::bit_not>::value)
+							return expr::fuse_andnot(expr::evaluate(a0.template arg<0>()), expr::evaluate(a1));
+						else if constexpr(is_node<R, op::bit_not>::value)
+							return expr::fuse_andnot(expr::evaluate(a1.template arg<0>()), expr::evaluate(a0));
+						else if constexpr(is_compare<R>::value)
+							return expr::compare_under(expr::evaluate(a0), a1);
+						else if constexpr(is_compare<L>::value)
+							return expr::compare_under(expr::evaluate(a1), a0);
+						else
+							return expr::evaluate(a0) & expr::evaluate(a1);
+					} else if constexpr(is_node<E, op::bit_or>::value) {
+						return expr::evaluate(a0) | expr::evaluate(a1);
+					} else if constexpr(is_node<E, op::bit_xor>::value) {
+						return expr::evaluate(a0) ^ expr::evaluate(a1);
+					} else {
+						return expr::compare<typename E::operator_type>(expr::evaluate(a0), expr::evaluate(a1));
+					}
+				}
+			}
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator+(const L &l, const R &r) {
+			return expr::make<op::add>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator-(const L &l, const R &r) {
+			return expr::make<op::sub>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator*(const L &l, const R &r) {
+			return expr::make<op::mul>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator/(const L &l, const R &r) {
+			return expr::make<op::div>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator&(const L &l, const R &r) {
+			return expr::make<op::bit_and>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator|(const L &l, const R &r) {
+			return expr::make<op::bit_or>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator^(const L &l, const R &r) {
+			return expr::make<op::bit_xor>(l, r);
+		}
+
+		template < class E, class = std::enable_if_t<is_expression<E>::value> >
+		SIMD_FORCEINLINE auto operator~(const E &e) {
+			return expr::make<op::bit_not>(e);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator==(const L &l, const R &r) {
+			return expr::make<op::equal>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator!=(const L &l, const R &r) {
+			return expr::make<op::not_equal>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator<(const L &l, const R &r) {
+			return expr::make<op::less>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator<=(const L &l, const R &r) {
+			return expr::make<op::less_equal>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator>(const L &l, const R &r) {
+			return expr::make<op::greater>(l, r);
+		}
+
+		template < class L, class R, class = enable_binary<L, R> >
+		SIMD_FORCEINLINE auto operator>=(const L &l, const R &r) {
+			return expr::make<op::greater_equal>(l, r);
+		}
+
+	} // namespace expr
+
+	using expr::lazy;
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
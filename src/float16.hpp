@@ -0,0 +1,244 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "narrow_float.hpp"
+#include "float32x4.hpp"
+#include "float32x8.hpp"
+#include "float32x16.hpp"
+
+// IEEE 754 half precision values in memory. There is no arithmetic on them: load_float16 widens W of them
+// to vector<float, W>, store_float16 narrows a vector back with one of the rounding modes of vcvtps2ph.
+// F16C (SIMD_F16C) and AVX-512 convert 4, 8 or 16 values per instruction, SSE2 without F16C uses a few
+// integer and float instructions for the same, everything else converts lane by lane.
+
+namespace simd {
+
+	// Rounding of conversions to a narrower type, the values are the rounding control bits of vcvtps2ph
+	enum class rounding { nearest = 0, down = 1, up = 2, toward_zero = 3 };
+
+	// Only the bits, shared by all instruction set levels. The conversions are in SIMD_ISA_NAMESPACE so that
+	// kernels compiled for several levels (dispatch.hpp) do not end up calling one level's copy.
+	struct float16 {
+		std::uint16_t bits;
+	};
+
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		// Conversions of a single value, the reference for the kernels below
+		inline std::uint16_t half_from_float(float f, rounding mode) {
+			std::uint32_t u;
+			std::memcpy(&u, &f, sizeof(u));
+			const std::uint32_t sign = (u >> 16) & 0x8000;
+			u &= 0x7FFFFFFF;
+			// NaN stays a quiet NaN with the upper bits of its payload
+			if(u >= 0x7F800000)
+				return static_cast<std::uint16_t>(sign | (u > 0x7F800000 ? 0x7E00 | ((u >> 13) & 0x3FF) : 0x7C00));
+			const int e = static_cast<int>(u >> 23) - 127;
+			std::uint32_t res, rest, half;
+			if(e > 15) {
+				// Beyond the largest finite value, which rounds to infinity unless rounding towards zero
+				res = 0x7BFF;
+				rest = 2;
+				half = 1;
+			} else if(e >= -14) {
+				res = (static_cast<std::uint32_t>(e + 15) << 10) | ((u >> 13) & 0x3FF);
+				rest = u & 0x1FFF;
+				half = 0x1000;
+			} else {
+				// Subnormal results count in units of 2^-24
+				const auto m = u < 0x00800000 ? u : (u & 0x7FFFFF) | 0x800000;
+				const int shift = -1 - e < 31 ? -1 - e : 31;
+				res = m >> shift;
+				rest = m & ((1u << shift) - 1);
+				half = 1u << (shift - 1);
+			}
+			bool up = false;
+			switch(mode) {
+			case rounding::nearest: up = rest > half || (rest == half && (res & 1)); break;
+			case rounding::down: up = rest && sign; break;
+			case rounding::up: up = rest && !sign; break;
+			case rounding::toward_zero: break;
+			}
+			// Carries go into the exponent, up to infinity
+			return static_cast<std::uint16_t>(sign | (res + up));
+		}
+
+		inline float half_to_float(std::uint16_t h) {
+			const std::uint32_t em = h & 0x7FFF;
+			std::uint32_t u;
+			if(em < 0x400) {
+				const float f = static_cast<float>(em) * (1.f / 16777216.f);
+				std::memcpy(&u, &f, sizeof(u));
+			} else {
+				u = (em << 13) + ((127 - 15) << 23);
+				// Signalling NaNs come out quiet, as from vcvtph2ps
+				if(em >= 0x7C00)
+					u |= em > 0x7C00 ? 0x7FC00000 : 0x7F800000;
+			}
+			u |= static_cast<std::uint32_t>(h & 0x8000) << 16;
+			float f;
+			std::memcpy(&f, &u, sizeof(f));
+			return f;
+		}
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+		// The four halves in the lower 64 bits of h
+		SIMD_FORCEINLINE __m128 cvtph_ps(__m128i h) {
+#if SIMD_F16C
+			return _mm_cvtph_ps(h);
+#else // SIMD_F16C
+			// Normal numbers get their exponent rebiased, subnormals are converted as integers times 2^-24.
+			// NaNs are quieted like by vcvtph2ps.
+			const auto x = _mm_unpacklo_epi16(h, _mm_setzero_si128());
+			const auto em = _mm_and_si128(x, _mm_set1_epi32(0x7FFF));
+			auto normal = _mm_add_epi32(_mm_slli_epi32(em, 13), _mm_set1_epi32((127 - 15) << 23));
+			normal = _mm_or_si128(normal, _mm_and_si128(_mm_cmpgt_epi32(em, _mm_set1_epi32(0x7BFF)), _mm_set1_epi32(0x7F800000)));
+			normal = _mm_or_si128(normal, _mm_and_si128(_mm_cmpgt_epi32(em, _mm_set1_epi32(0x7C00)), _mm_set1_epi32(0x00400000)));
+			const auto sub = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(em), _mm_set1_ps(1.f / 16777216.f)));
+			const auto is_sub = _mm_cmplt_epi32(em, _mm_set1_epi32(0x400));
+			const auto mag = _mm_or_si128(_mm_and_si128(is_sub, sub), _mm_andnot_si128(is_sub, normal));
+			return _mm_castsi128_ps(_mm_or_si128(mag, _mm_slli_epi32(_mm_and_si128(x, _mm_set1_epi32(0x8000)), 16)));
+#endif // SIMD_F16C
+		}
+
+#if !SIMD_F16C
+		// Round to nearest even without F16C, see half_from_float for the cases
+		SIMD_FORCEINLINE __m128i cvtps_ph_nearest(__m128 f) {
+			const auto sign = _mm_and_si128(_mm_castps_si128(f), _mm_set1_epi32(INT32_MIN));
+			const auto u = _mm_xor_si128(_mm_castps_si128(f), sign);
+			const auto nan = _mm_cmpgt_epi32(u, _mm_set1_epi32(0x7F800000));
+			const auto payload = _mm_or_si128(_mm_set1_epi32(0x200), _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(0x3FF)));
+			const auto special = _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(nan, payload));
+			// Adding 0.5 moves the bits of a subnormal result to the bottom, rounded to nearest even by the addition
+			const auto magic = _mm_set1_epi32(126 << 23);
+			const auto sub = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_castsi128_ps(magic))), magic);
+			const auto odd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+			const auto bias = _mm_set1_epi32(static_cast<int>((15u - 127u) << 23) + 0xFFF);
+			const auto normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(u, bias), odd), 13);
+			const auto is_sub = _mm_cmplt_epi32(u, _mm_set1_epi32(113 << 23));
+			const auto is_special = _mm_cmpgt_epi32(u, _mm_set1_epi32(((127 + 16) << 23) - 1));
+			auto res = _mm_or_si128(_mm_and_si128(is_sub, sub), _mm_andnot_si128(is_sub, normal));
+			res = _mm_or_si128(_mm_and_si128(is_special, special), _mm_andnot_si128(is_special, res));
+			res = _mm_or_si128(res, _mm_srli_epi32(sign, 16));
+			// Sign extended from 16 bits, so the saturating pack keeps them as they are
+			res = _mm_srai_epi32(_mm_slli_epi32(res, 16), 16);
+			return _mm_packs_epi32(res, res);
+		}
+#endif // !SIMD_F16C
+
+		// Four halves in the lower 64 bits of the result
+		template < rounding R >
+		SIMD_FORCEINLINE __m128i cvtps_ph(__m128 f) {
+#if SIMD_F16C
+			return _mm_cvtps_ph(f, static_cast<int>(R));
+#else // SIMD_F16C
+			if constexpr(R == rounding::nearest) {
+				return detail::cvtps_ph_nearest(f);
+			} else {
+				alignas(16) float in[4];
+				alignas(16) std::uint16_t out[8] = {};
+				_mm_store_ps(in, f);
+				for(int i = 0; i < 4; ++i)
+					out[i] = detail::half_from_float(in[i], R);
+				return _mm_load_si128(reinterpret_cast<const __m128i *>(out));
+			}
+#endif // SIMD_F16C
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+		SIMD_FORCEINLINE __m256 cvtph_ps8(__m128i h) {
+#if SIMD_F16C
+			return _mm256_cvtph_ps(h);
+#else // SIMD_F16C
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(detail::cvtph_ps(h)), detail::cvtph_ps(_mm_unpackhi_epi64(h, h)), 1);
+#endif // SIMD_F16C
+		}
+
+		template < rounding R >
+		SIMD_FORCEINLINE __m128i cvtps_ph8(__m256 f) {
+#if SIMD_F16C
+			return _mm256_cvtps_ph(f, static_cast<int>(R));
+#else // SIMD_F16C
+			return _mm_unpacklo_epi64(detail::cvtps_ph<R>(_mm256_castps256_ps128(f)), detail::cvtps_ph<R>(_mm256_extractf128_ps(f, 1)));
+#endif // SIMD_F16C
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+	} // namespace detail
+
+	template < size_t W >
+	SIMD_FORCEINLINE vector<float, W> load_float16(const float16 *src);
+
+	template < rounding R = rounding::nearest, size_t W >
+	SIMD_FORCEINLINE void store_float16(float16 *dst, const vector<float, W> &v);
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	template <>
+	SIMD_FORCEINLINE vector<float, 4> load_float16<4>(const float16 *src) {
+		return vector<float, 4>(detail::cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src))));
+	}
+
+	template < rounding R = rounding::nearest >
+	SIMD_FORCEINLINE void store_float16(float16 *dst, const vector<float, 4> &v) {
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(dst), detail::cvtps_ph<R>(v.native()));
+	}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+	template <>
+	SIMD_FORCEINLINE vector<float, 8> load_float16<8>(const float16 *src) {
+		return vector<float, 8>(detail::cvtph_ps8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src))));
+	}
+
+	template < rounding R = rounding::nearest >
+	SIMD_FORCEINLINE void store_float16(float16 *dst, const vector<float, 8> &v) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst), detail::cvtps_ph8<R>(v.native()));
+	}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	template <>
+	SIMD_FORCEINLINE vector<float, 16> load_float16<16>(const float16 *src) {
+		return vector<float, 16>(_mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src))));
+	}
+
+	template < rounding R = rounding::nearest >
+	SIMD_FORCEINLINE void store_float16(float16 *dst, const vector<float, 16> &v) {
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm512_cvtps_ph(v.native(), static_cast<int>(R)));
+	}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+	template < size_t W >
+	vector<float, W> load_float16(const float16 *src) {
+		return detail::narrow_float<float16>::load<W>(
+			src, [](auto pw, const float16 *p) { return load_float16<decltype(pw)::value>(p); }, [](float16 h) { return detail::half_to_float(h.bits); });
+	}
+
+	template < rounding R, size_t W >
+	void store_float16(float16 *dst, const vector<float, W> &v) {
+		detail::narrow_float<float16>::store(
+			dst, v, [](float16 *p, const auto &part) { store_float16<R>(p, part); }, [](float f) { return float16{ detail::half_from_float(f, R) }; });
+	}
+
+	inline void float16_to_float(const float16 *src, float *dst, size_t count) {
+		detail::narrow_float<float16>::to_float(
+			src, dst, count, [](auto w, const float16 *p) { return load_float16<decltype(w)::value>(p); },
+			[](float16 h) { return detail::half_to_float(h.bits); });
+	}
+
+	template < rounding R = rounding::nearest >
+	void float_to_float16(const float *src, float16 *dst, size_t count) {
+		detail::narrow_float<float16>::from_float(
+			src, dst, count, [](float16 *p, const auto &v) { store_float16<R>(p, v); }, [](float f) { return float16{ detail::half_from_float(f, R) }; });
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,463 @@
+#pragma once
+
+#include <array>
+#include <exception>
+#include "base_types.hpp"
+#include "simd.hpp"
+#include "util.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	template <>
+	class vector<float, 16> : public vector_base<float, 16> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+		// AVX-512 always has FMA
+		static constexpr bool fused_multiply_add = true;
+
+	public:
+		SIMD_FORCEINLINE vector() : vector_base() {}
+		explicit SIMD_FORCEINLINE vector(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE vector(type f) : vector_base(_mm512_set1_ps(f)) {}
+		explicit SIMD_FORCEINLINE vector(type f1, type f2, type f3, type f4, type f5, type f6, type f7, type f8,
+										 type f9, type f10, type f11, type f12, type f13, type f14, type f15, type f16) :
+			vector_base(_mm512_set_ps(f16, f15, f14, f13, f12, f11, f10, f9, f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit SIMD_FORCEINLINE vector(const std::array<type, width> &arr) : vector_base(_mm512_loadu_ps(arr.data())) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals) : vector_base(_mm512_loadu_ps(vals)) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals, aligned_load) : vector_base(_mm512_load_ps(vals)) {}
+		explicit SIMD_FORCEINLINE vector(const vector<std::int32_t, 16> &v);
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<float, 16> &operator+=(const vector<float, 16> &v);
+		SIMD_FORCEINLINE vector<float, 16> &operator-=(const vector<float, 16> &v);
+		SIMD_FORCEINLINE vector<float, 16> &operator*=(const vector<float, 16> &v);
+		SIMD_FORCEINLINE vector<float, 16> &operator/=(const vector<float, 16> &v);
+		friend SIMD_FORCEINLINE vector<float, 16> operator+(vector<float, 16> v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE vector<float, 16> operator-(vector<float, 16> v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE vector<float, 16> operator*(vector<float, 16> v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE vector<float, 16> operator/(vector<float, 16> v1, const vector<float, 16> &v2);
+		// v1 * v2 + v3, v1 * v2 - v3, -(v1 * v2) + v3 and -(v1 * v2) - v3, see is_fma_fused
+		friend SIMD_FORCEINLINE vector<float, 16> fmadd(const vector<float, 16> &v1, const vector<float, 16> &v2, const vector<float, 16> &v3);
+		friend SIMD_FORCEINLINE vector<float, 16> fmsub(const vector<float, 16> &v1, const vector<float, 16> &v2, const vector<float, 16> &v3);
+		friend SIMD_FORCEINLINE vector<float, 16> fnmadd(const vector<float, 16> &v1, const vector<float, 16> &v2, const vector<float, 16> &v3);
+		friend SIMD_FORCEINLINE vector<float, 16> fnmsub(const vector<float, 16> &v1, const vector<float, 16> &v2, const vector<float, 16> &v3);
+
+		SIMD_FORCEINLINE vector<float, 16> &operator&=(const vector<float, 16> &v);
+		SIMD_FORCEINLINE vector<float, 16> &operator|=(const vector<float, 16> &v);
+		SIMD_FORCEINLINE vector<float, 16> &operator^=(const vector<float, 16> &v);
+		friend SIMD_FORCEINLINE vector<float, 16> operator~(const vector<float, 16> &v);
+		friend SIMD_FORCEINLINE vector<float, 16> operator&(vector<float, 16> v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE vector<float, 16> operator|(vector<float, 16> v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE vector<float, 16> operator^(vector<float, 16> v1, const vector<float, 16> &v2);
+
+		// Comparisons produce k-register masks instead of vectors
+		friend SIMD_FORCEINLINE mask<float, 16> operator==(const vector<float, 16> &v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> operator!=(const vector<float, 16> &v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> operator>(const vector<float, 16> &v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> operator>=(const vector<float, 16> &v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> operator<(const vector<float, 16> &v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> operator<=(const vector<float, 16> &v1, const vector<float, 16> &v2);
+
+		SIMD_FORCEINLINE vector<float, 16> &hadd(const vector<float, 16> &v);
+		SIMD_FORCEINLINE vector<float, 16> &hsub(const vector<float, 16> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		// Pairwise difference tree, i.e. ((A1-A2)-(A3-A4))-((A5-A6)-(A7-A8))-...
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<float, 16> hadd(vector<float, 16> v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE vector<float, 16> hsub(vector<float, 16> v1, const vector<float, 16> &v2);
+
+		SIMD_FORCEINLINE vector<float, 16> &abs();
+		friend SIMD_FORCEINLINE vector<float, 16> abs(vector<float, 16> v);
+		friend SIMD_FORCEINLINE vector<float, 16> min(const vector<float, 16> &v1, const vector<float, 16> &v2);
+		friend SIMD_FORCEINLINE vector<float, 16> max(const vector<float, 16> &v1, const vector<float, 16> &v2);
+		SIMD_FORCEINLINE vector<float, 16> &ceil();
+		SIMD_FORCEINLINE vector<float, 16> &floor();
+		SIMD_FORCEINLINE vector<float, 16> &round(int mode);
+		friend SIMD_FORCEINLINE vector<float, 16> ceil(vector<float, 16> v);
+		friend SIMD_FORCEINLINE vector<float, 16> floor(vector<float, 16> v);
+		friend SIMD_FORCEINLINE vector<float, 16> round(vector<float, 16> v, int mode);
+
+		SIMD_FORCEINLINE vector<float, 16> sqrt() const;
+		SIMD_FORCEINLINE vector<float, 16> rsqrt() const;
+
+		friend SIMD_FORCEINLINE vector<float, 16> select(const vector<float, 16> &v, const vector<float, 16> &alt, const mask<float, 16> &condition);
+		friend SIMD_FORCEINLINE vector<float, 16> select(const vector<float, 16> &v, const vector<float, 16> &alt, const vector<float, 16> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<float, 16> &v);
+	};
+
+	template <>
+	class mask<float, 16> {
+	public:
+		using type = float;
+		static constexpr size_t width = 16;
+		using native_type = native_vector<type, width>::mask_type;
+
+		SIMD_FORCEINLINE mask() : m_mask(0) {}
+		explicit SIMD_FORCEINLINE mask(native_type m) : m_mask(m) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : m_mask(static_cast<native_type>(-static_cast<int>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7, bool b8,
+									   bool b9, bool b10, bool b11, bool b12, bool b13, bool b14, bool b15, bool b16) :
+			mask(std::array<bool, width>{ { b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15, b16 } }) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width> &arr) : m_mask(0) {
+			for(size_t i = 0; i < width; ++i)
+				m_mask |= static_cast<native_type>(arr[i]) << i;
+		}
+		// Lanes with the sign bit set are considered true, like by the blendv and movemask based masks
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE mask(const vector<float, 16> &v) : m_mask(_mm512_movepi32_mask(_mm512_castps_si512(v.native()))) {}
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE mask(const vector<float, 16> &v) : m_mask(_mm512_cmplt_epi32_mask(_mm512_castps_si512(v.native()), _mm512_setzero_si512())) {}
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		static SIMD_FORCEINLINE mask<float, 16> first_n(size_t count);
+
+		SIMD_FORCEINLINE native_type &native() {
+			return m_mask;
+		}
+
+		SIMD_FORCEINLINE const native_type &native() const {
+			return m_mask;
+		}
+
+		SIMD_FORCEINLINE bool operator[](size_t index) const {
+			assert(index < width);
+			return (m_mask >> index) & 1;
+		}
+
+		friend SIMD_FORCEINLINE mask<float, 16> operator==(const mask<float, 16> &v1, const mask<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> operator!=(const mask<float, 16> &v1, const mask<float, 16> &v2);
+
+		SIMD_FORCEINLINE mask<float, 16> &operator&=(const mask<float, 16> &v);
+		SIMD_FORCEINLINE mask<float, 16> &operator|=(const mask<float, 16> &v);
+		SIMD_FORCEINLINE mask<float, 16> &operator^=(const mask<float, 16> &v);
+
+		friend SIMD_FORCEINLINE mask<float, 16> operator~(const mask<float, 16> &v);
+		friend SIMD_FORCEINLINE mask<float, 16> operator&(mask<float, 16> v1, const mask<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> operator|(mask<float, 16> v1, const mask<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> operator^(mask<float, 16> v1, const mask<float, 16> &v2);
+		friend SIMD_FORCEINLINE mask<float, 16> andnot(const mask<float, 16> &v1, const mask<float, 16> &v2);
+
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const mask<float, 16> &m);
+
+	private:
+		native_type m_mask;
+	};
+
+	void vector<float, 16>::store(type *vals) const {
+		_mm512_storeu_ps(vals, m_vec);
+	}
+
+	void vector<float, 16>::store(type *vals, aligned_store) const {
+		_mm512_store_ps(vals, m_vec);
+	}
+
+	void vector<float, 16>::stream(type *vals) const {
+		_mm512_stream_ps(vals, m_vec);
+	}
+
+	void vector<float, 16>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		_mm512_mask_storeu_ps(vals, static_cast<__mmask16>((1u << count) - 1u), m_vec);
+	}
+
+	vector<float, 16> &vector<float, 16>::operator+=(const vector<float, 16> &v) {
+		m_vec = _mm512_add_ps(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::operator-=(const vector<float, 16> &v) {
+		m_vec = _mm512_sub_ps(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::operator*=(const vector<float, 16> &v) {
+		m_vec = _mm512_mul_ps(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::operator/=(const vector<float, 16> &v) {
+		m_vec = _mm512_div_ps(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::hadd(const vector<float, 16> &v) {
+		// Same lane layout as _mm256_hadd_ps: A1+A2, A3+A4, B1+B2, B3+B4 per 128 bit lane
+		m_vec = _mm512_add_ps(_mm512_shuffle_ps(m_vec, v.m_vec, 0b10001000), _mm512_shuffle_ps(m_vec, v.m_vec, 0b11011101));
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::hsub(const vector<float, 16> &v) {
+		m_vec = _mm512_sub_ps(_mm512_shuffle_ps(m_vec, v.m_vec, 0b10001000), _mm512_shuffle_ps(m_vec, v.m_vec, 0b11011101));
+		return *this;
+	}
+
+	float vector<float, 16>::hadd() const {
+		return _mm512_reduce_add_ps(m_vec);
+	}
+
+	float vector<float, 16>::hsub() const {
+		// Every lane with an odd number of set index bits ends up negated in the difference tree
+		auto negated = _mm512_mask_xor_epi32(_mm512_castps_si512(m_vec), 0x6996, _mm512_castps_si512(m_vec), _mm512_set1_epi32(0x80000000));
+		return _mm512_reduce_add_ps(_mm512_castsi512_ps(negated));
+	}
+
+	vector<float, 16> hadd(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return v1.hadd(v2);
+	}
+
+	vector<float, 16> hsub(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return v1.hsub(v2);
+	}
+
+	vector<float, 16> operator+(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<float, 16> operator-(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<float, 16> operator*(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<float, 16> operator/(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<float, 16> fmadd(const vector<float, 16> &v1, const vector<float, 16> &v2, const vector<float, 16> &v3) {
+		return vector<float, 16>(_mm512_fmadd_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+	}
+
+	vector<float, 16> fmsub(const vector<float, 16> &v1, const vector<float, 16> &v2, const vector<float, 16> &v3) {
+		return vector<float, 16>(_mm512_fmsub_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+	}
+
+	vector<float, 16> fnmadd(const vector<float, 16> &v1, const vector<float, 16> &v2, const vector<float, 16> &v3) {
+		return vector<float, 16>(_mm512_fnmadd_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+	}
+
+	vector<float, 16> fnmsub(const vector<float, 16> &v1, const vector<float, 16> &v2, const vector<float, 16> &v3) {
+		return vector<float, 16>(_mm512_fnmsub_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+	}
+
+	// The floating point logic instructions require AVX512DQ, the integer ones do the same job
+	vector<float, 16> &vector<float, 16>::operator&=(const vector<float, 16> &v) {
+		m_vec = _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(m_vec), _mm512_castps_si512(v.m_vec)));
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::operator|=(const vector<float, 16> &v) {
+		m_vec = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(m_vec), _mm512_castps_si512(v.m_vec)));
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::operator^=(const vector<float, 16> &v) {
+		m_vec = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(m_vec), _mm512_castps_si512(v.m_vec)));
+		return *this;
+	}
+
+	vector<float, 16> operator~(const vector<float, 16> &v) {
+		return vector<float, 16>(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(v.m_vec), _mm512_set1_epi32(-1))));
+	}
+
+	vector<float, 16> operator&(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<float, 16> operator|(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<float, 16> operator^(vector<float, 16> v1, const vector<float, 16> &v2) {
+		return v1 ^= v2;
+	}
+
+	mask<float, 16> operator==(const vector<float, 16> &v1, const vector<float, 16> &v2) {
+		return mask<float, 16>(_mm512_cmp_ps_mask(v1.m_vec, v2.m_vec, _CMP_EQ_OQ));
+	}
+
+	mask<float, 16> operator!=(const vector<float, 16> &v1, const vector<float, 16> &v2) {
+		return mask<float, 16>(_mm512_cmp_ps_mask(v1.m_vec, v2.m_vec, _CMP_NEQ_UQ));
+	}
+
+	mask<float, 16> operator>(const vector<float, 16> &v1, const vector<float, 16> &v2) {
+		return mask<float, 16>(_mm512_cmp_ps_mask(v1.m_vec, v2.m_vec, _CMP_GT_OQ));
+	}
+
+	mask<float, 16> operator>=(const vector<float, 16> &v1, const vector<float, 16> &v2) {
+		return mask<float, 16>(_mm512_cmp_ps_mask(v1.m_vec, v2.m_vec, _CMP_GE_OQ));
+	}
+
+	mask<float, 16> operator<(const vector<float, 16> &v1, const vector<float, 16> &v2) {
+		return mask<float, 16>(_mm512_cmp_ps_mask(v1.m_vec, v2.m_vec, _CMP_LT_OQ));
+	}
+
+	mask<float, 16> operator<=(const vector<float, 16> &v1, const vector<float, 16> &v2) {
+		return mask<float, 16>(_mm512_cmp_ps_mask(v1.m_vec, v2.m_vec, _CMP_LE_OQ));
+	}
+
+	vector<float, 16> &vector<float, 16>::abs() {
+		// Clear the sign bit
+		m_vec = _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(m_vec), _mm512_set1_epi32(0x7FFFFFFF)));
+		return *this;
+	}
+
+	vector<float, 16> abs(vector<float, 16> v) {
+		return v.abs();
+	}
+
+	vector<float, 16> min(const vector<float, 16> &v1, const vector<float, 16> &v2) {
+		return vector<float, 16>(_mm512_min_ps(v1.m_vec, v2.m_vec));
+	}
+
+	vector<float, 16> max(const vector<float, 16> &v1, const vector<float, 16> &v2) {
+		return vector<float, 16>(_mm512_max_ps(v1.m_vec, v2.m_vec));
+	}
+
+	vector<float, 16> vector<float, 16>::sqrt() const {
+		return vector<float, 16>(_mm512_sqrt_ps(m_vec));
+	}
+
+	vector<float, 16> vector<float, 16>::rsqrt() const {
+		return vector<float, 16>(_mm512_rsqrt14_ps(m_vec));
+	}
+
+	vector<float, 16> &vector<float, 16>::ceil() {
+		m_vec = _mm512_roundscale_ps(m_vec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::floor() {
+		m_vec = _mm512_roundscale_ps(m_vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+		return *this;
+	}
+
+	vector<float, 16> &vector<float, 16>::round(int mode) {
+		switch(mode & 0b11) {
+		case 0: m_vec = _mm512_roundscale_ps(m_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); break;
+		case 1: m_vec = _mm512_roundscale_ps(m_vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); break;
+		case 2: m_vec = _mm512_roundscale_ps(m_vec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); break;
+		default: m_vec = _mm512_roundscale_ps(m_vec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); break;
+		}
+		return *this;
+	}
+
+	vector<float, 16> ceil(vector<float, 16> v) {
+		return v.ceil();
+	}
+
+	vector<float, 16> floor(vector<float, 16> v) {
+		return v.floor();
+	}
+
+	vector<float, 16> round(vector<float, 16> v, int mode) {
+		return v.round(mode);
+	}
+
+	vector<float, 16> select(const vector<float, 16> &v, const vector<float, 16> &alt, const mask<float, 16> &condition) {
+		return vector<float, 16>(_mm512_mask_blend_ps(condition.native(), alt.m_vec, v.m_vec));
+	}
+
+	vector<float, 16> select(const vector<float, 16> &v, const vector<float, 16> &alt, const vector<float, 16> &condition) {
+		return select(v, alt, mask<float, 16>(condition));
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<float, 16> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<float, 16> operator==(const mask<float, 16> &v1, const mask<float, 16> &v2) {
+		return mask<float, 16>(_mm512_kxnor(v1.m_mask, v2.m_mask));
+	}
+
+	mask<float, 16> operator!=(const mask<float, 16> &v1, const mask<float, 16> &v2) {
+		return mask<float, 16>(_mm512_kxor(v1.m_mask, v2.m_mask));
+	}
+
+	mask<float, 16> &mask<float, 16>::operator&=(const mask<float, 16> &v) {
+		m_mask = _mm512_kand(m_mask, v.m_mask);
+		return *this;
+	}
+
+	mask<float, 16> &mask<float, 16>::operator|=(const mask<float, 16> &v) {
+		m_mask = _mm512_kor(m_mask, v.m_mask);
+		return *this;
+	}
+
+	mask<float, 16> &mask<float, 16>::operator^=(const mask<float, 16> &v) {
+		m_mask = _mm512_kxor(m_mask, v.m_mask);
+		return *this;
+	}
+
+	mask<float, 16> operator~(const mask<float, 16> &v) {
+		return mask<float, 16>(_mm512_knot(v.m_mask));
+	}
+
+	mask<float, 16> operator&(mask<float, 16> v1, const mask<float, 16> &v2) {
+		return v1 &= v2;
+	}
+
+	mask<float, 16> operator|(mask<float, 16> v1, const mask<float, 16> &v2) {
+		return v1 |= v2;
+	}
+
+	mask<float, 16> operator^(mask<float, 16> v1, const mask<float, 16> &v2) {
+		return v1 ^= v2;
+	}
+
+	mask<float, 16> andnot(const mask<float, 16> &v1, const mask<float, 16> &v2) {
+		return mask<float, 16>(_mm512_kandn(v1.m_mask, v2.m_mask));
+	}
+
+	mask<float, 16> mask<float, 16>::first_n(size_t count) {
+		return mask<float, 16>(static_cast<native_type>((1u << (count < width ? count : width)) - 1));
+	}
+
+	int mask<float, 16>::get_mask() const {
+		return m_mask;
+	}
+
+	bool mask<float, 16>::all() const {
+		return m_mask == 0xFFFF;
+	}
+
+	bool mask<float, 16>::any() const {
+		return m_mask != 0;
+	}
+
+	bool mask<float, 16>::none() const {
+		return m_mask == 0;
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const mask<float, 16> &m) {
+		stream << '(';
+		for (size_t i = 0; i < m.width - 1; ++i) {
+			stream << m[i] << ' ';
+		}
+		stream << m[m.width - 1] << ')';
+		return stream;
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
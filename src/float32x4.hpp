@@ -7,14 +7,29 @@
 #include "util.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 #if SIMD_SUPPORTS(SIMD_SSE)
-	using float32x4 = vector<float, 4>;
+#if !SIMD_SUPPORTS(SIMD_SSE4_1)
+	namespace detail {
+		// Rounds to nearest even by adding and subtracting 2^23 with the sign of x, which pushes
+		// the fraction bits out of the mantissa. Values of at least 2^23 are already integral.
+		inline __m128 round_nearest(__m128 x) {
+			const auto sign = _mm_set1_ps(-0.f);
+			const auto limit = _mm_set1_ps(8388608.f);
+			auto magic = _mm_or_ps(_mm_and_ps(x, sign), limit);
+			auto r = _mm_sub_ps(_mm_add_ps(x, magic), magic);
+			auto integral = _mm_cmpge_ps(_mm_andnot_ps(sign, x), limit);
+			return _mm_or_ps(_mm_and_ps(integral, x), _mm_andnot_ps(integral, r));
+		}
+	} // namespace detail
+#endif // !SIMD_SUPPORTS(SIMD_SSE4_1)
 
 	template <>
 	class vector<float, 4> : public vector_base<float, 4> {
 	public:
 		static constexpr int required_version = native_vector<type, width>::required_version;
+		static constexpr bool fused_multiply_add = SIMD_FMA;
 
 		SIMD_FORCEINLINE vector() : vector_base() {}
 		explicit SIMD_FORCEINLINE vector(native_type v) : vector_base(v) {}
@@ -25,11 +40,19 @@ namespace simd {
 		explicit SIMD_FORCEINLINE vector(const type *vals, aligned_load) : vector_base(_mm_load_ps(vals)) {}
 		explicit SIMD_FORCEINLINE vector(const vector<int, 4> &v);
 		explicit SIMD_FORCEINLINE vector(const vector<double, 2> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<std::uint32_t, 4> &v);
 #if SIMD_SUPPORTS(SIMD_AVX)
 		explicit SIMD_FORCEINLINE vector(const vector<double, 4> &v);
 #endif // SIMD_SUPPORTS(SIMD_AVX)
 
 
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
 		SIMD_FORCEINLINE vector<float, 4> &operator+=(const vector<float, 4> &v);
 		SIMD_FORCEINLINE vector<float, 4> &operator-=(const vector<float, 4> &v);
 		SIMD_FORCEINLINE vector<float, 4> &operator*=(const vector<float, 4> &v);
@@ -38,6 +61,11 @@ namespace simd {
 		friend SIMD_FORCEINLINE vector<float, 4> operator-(vector<float, 4> v1, const vector<float, 4> &v2);
 		friend SIMD_FORCEINLINE vector<float, 4> operator*(vector<float, 4> v1, const vector<float, 4> &v2);
 		friend SIMD_FORCEINLINE vector<float, 4> operator/(vector<float, 4> v1, const vector<float, 4> &v2);
+		// v1 * v2 + v3, v1 * v2 - v3, -(v1 * v2) + v3 and -(v1 * v2) - v3, see is_fma_fused
+		friend SIMD_FORCEINLINE vector<float, 4> fmadd(const vector<float, 4> &v1, const vector<float, 4> &v2, const vector<float, 4> &v3);
+		friend SIMD_FORCEINLINE vector<float, 4> fmsub(const vector<float, 4> &v1, const vector<float, 4> &v2, const vector<float, 4> &v3);
+		friend SIMD_FORCEINLINE vector<float, 4> fnmadd(const vector<float, 4> &v1, const vector<float, 4> &v2, const vector<float, 4> &v3);
+		friend SIMD_FORCEINLINE vector<float, 4> fnmsub(const vector<float, 4> &v1, const vector<float, 4> &v2, const vector<float, 4> &v3);
 
 		SIMD_FORCEINLINE vector<float, 4> &operator&=(const vector<float, 4> &v);
 		SIMD_FORCEINLINE vector<float, 4> &operator|=(const vector<float, 4> &v);
@@ -81,7 +109,7 @@ namespace simd {
 		friend SIMD_FORCEINLINE vector<float, 4> select(const vector<float, 4> &v, const vector<float, 4> &alt, const mask<float, 4> &condition);
 		friend SIMD_FORCEINLINE vector<float, 4> select(const vector<float, 4> &v, const vector<float, 4> &alt, const vector<float, 4> &condition);
 
-		friend std::ostream &operator<<(std::ostream &stream, const vector<float, 4> &v);
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<float, 4> &v);
 	};
 
 	template <>
@@ -92,8 +120,9 @@ namespace simd {
 		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_castsi128_ps(_mm_set1_epi32(-static_cast<int>(b)))) {}
 		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4) : vector_base(_mm_castsi128_ps(_mm_set_epi32(
 			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1)))) {}
-		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[3], arr[2], arr[1], arr[0]) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3]) {}
 		explicit SIMD_FORCEINLINE mask(const vector<float, 4> &v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<float, 4> first_n(size_t count);
 
 		friend SIMD_FORCEINLINE mask<float, 4> operator==(const mask<float, 4> &v1, const mask<float, 4> &v2);
 		friend SIMD_FORCEINLINE mask<float, 4> operator!=(const mask<float, 4> &v1, const mask<float, 4> &v2);
@@ -114,6 +143,36 @@ namespace simd {
 		SIMD_FORCEINLINE bool none() const;
 	};
 
+	void vector<float, 4>::store(type *vals) const {
+		_mm_storeu_ps(vals, m_vec);
+	}
+
+	void vector<float, 4>::store(type *vals, aligned_store) const {
+		_mm_store_ps(vals, m_vec);
+	}
+
+	void vector<float, 4>::stream(type *vals) const {
+		_mm_stream_ps(vals, m_vec);
+	}
+
+	void vector<float, 4>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		switch(count) {
+		case 4:
+			_mm_storeu_ps(vals, m_vec);
+			break;
+		case 3:
+			_mm_store_ss(vals + 2, _mm_movehl_ps(m_vec, m_vec));
+			[[fallthrough]];
+		case 2:
+			_mm_storel_pi(reinterpret_cast<__m64 *>(vals), m_vec);
+			break;
+		case 1:
+			_mm_store_ss(vals, m_vec);
+			break;
+		}
+	}
+
 	vector<float, 4> &vector<float, 4>::operator+=(const vector<float, 4> &v) {
 		m_vec = _mm_add_ps(m_vec, v.m_vec);
 		return *this;
@@ -138,7 +197,10 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE3)
 		m_vec = _mm_hadd_ps(m_vec, v.m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
+		// Gather the even and odd lanes of both vectors and combine them
+		auto even = _mm_shuffle_ps(m_vec, v.m_vec, 0b10001000);
+		auto odd = _mm_shuffle_ps(m_vec, v.m_vec, 0b11011101);
+		m_vec = _mm_add_ps(even, odd);
 #endif // SIMD_SUPPORTS(SIMD_SSE3)
 		return *this;
 	}
@@ -147,7 +209,9 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE3)
 		m_vec = _mm_hsub_ps(m_vec, v.m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
+		auto even = _mm_shuffle_ps(m_vec, v.m_vec, 0b10001000);
+		auto odd = _mm_shuffle_ps(m_vec, v.m_vec, 0b11011101);
+		m_vec = _mm_sub_ps(even, odd);
 #endif // SIMD_SUPPORTS(SIMD_SSE3)
 		return *this;
 	}
@@ -166,7 +230,13 @@ namespace simd {
 	}
 
 	float vector<float, 4>::hsub() const {
-		throw std::runtime_error("Operation not implemented");
+#if SIMD_SUPPORTS(SIMD_SSE3)
+		auto t1 = _mm_hsub_ps(m_vec, m_vec);
+		return _mm_cvtss_f32(_mm_hsub_ps(t1, t1));
+#else // SIMD_SUPPORTS(SIMD_SSE3)
+		// (A1-A2)-(A3-A4) == A1-A2-A3+A4, so flip the signs of A2 and A3 and sum up
+		return vector<float, 4>(_mm_xor_ps(m_vec, _mm_set_ps(0.f, -0.f, -0.f, 0.f))).hadd();
+#endif // SIMD_SUPPORTS(SIMD_SSE3)
 	}
 
 	vector<float, 4> hadd(vector<float, 4> v1, const vector<float, 4> &v2) {
@@ -193,6 +263,38 @@ namespace simd {
 		return (v1 /= v2);
 	}
 
+	vector<float, 4> fmadd(const vector<float, 4> &v1, const vector<float, 4> &v2, const vector<float, 4> &v3) {
+#if SIMD_FMA
+		return vector<float, 4>(_mm_fmadd_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<float, 4>(_mm_add_ps(_mm_mul_ps(v1.m_vec, v2.m_vec), v3.m_vec));
+#endif // SIMD_FMA
+	}
+
+	vector<float, 4> fmsub(const vector<float, 4> &v1, const vector<float, 4> &v2, const vector<float, 4> &v3) {
+#if SIMD_FMA
+		return vector<float, 4>(_mm_fmsub_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<float, 4>(_mm_sub_ps(_mm_mul_ps(v1.m_vec, v2.m_vec), v3.m_vec));
+#endif // SIMD_FMA
+	}
+
+	vector<float, 4> fnmadd(const vector<float, 4> &v1, const vector<float, 4> &v2, const vector<float, 4> &v3) {
+#if SIMD_FMA
+		return vector<float, 4>(_mm_fnmadd_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<float, 4>(_mm_sub_ps(v3.m_vec, _mm_mul_ps(v1.m_vec, v2.m_vec)));
+#endif // SIMD_FMA
+	}
+
+	vector<float, 4> fnmsub(const vector<float, 4> &v1, const vector<float, 4> &v2, const vector<float, 4> &v3) {
+#if SIMD_FMA
+		return vector<float, 4>(_mm_fnmsub_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<float, 4>(_mm_xor_ps(_mm_add_ps(_mm_mul_ps(v1.m_vec, v2.m_vec), v3.m_vec), _mm_set1_ps(-0.f)));
+#endif // SIMD_FMA
+	}
+
 	vector<float, 4> &vector<float, 4>::operator&=(const vector<float, 4> &v) {
 		m_vec = _mm_and_ps(m_vec, v.m_vec);
 		return *this;
@@ -282,7 +384,9 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
 		m_vec = _mm_ceil_ps(m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
+		auto r = detail::round_nearest(m_vec);
+		r = _mm_add_ps(r, _mm_and_ps(_mm_cmplt_ps(r, m_vec), _mm_set1_ps(1.f)));
+		m_vec = _mm_or_ps(r, _mm_and_ps(m_vec, _mm_set1_ps(-0.f)));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 		return *this;
 	}
@@ -291,17 +395,34 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
 		m_vec = _mm_floor_ps(m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
+		auto r = detail::round_nearest(m_vec);
+		r = _mm_sub_ps(r, _mm_and_ps(_mm_cmpgt_ps(r, m_vec), _mm_set1_ps(1.f)));
+		m_vec = _mm_or_ps(r, _mm_and_ps(m_vec, _mm_set1_ps(-0.f)));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 		return *this;
 	}
 
 	vector<float, 4> &vector<float, 4>::round(int mode) {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
-		// TODO: requires constant expression?
-		m_vec = _mm_round_ps(m_vec, 0);
+		switch(mode & 0b11) {
+		case 0: m_vec = _mm_round_ps(m_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); break;
+		case 1: m_vec = _mm_round_ps(m_vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); break;
+		case 2: m_vec = _mm_round_ps(m_vec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); break;
+		default: m_vec = _mm_round_ps(m_vec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); break;
+		}
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
+		switch(mode & 0b11) {
+		case 0: m_vec = _mm_or_ps(detail::round_nearest(m_vec), _mm_and_ps(m_vec, _mm_set1_ps(-0.f))); break;
+		case 1: floor(); break;
+		case 2: ceil(); break;
+		default: {
+			// Towards zero is the floor of the magnitude
+			const auto sign = _mm_and_ps(m_vec, _mm_set1_ps(-0.f));
+			m_vec = _mm_xor_ps(m_vec, sign);
+			floor();
+			m_vec = _mm_or_ps(m_vec, sign);
+		}
+		}
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 		return *this;
 	}
@@ -322,8 +443,7 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
 		return vector<float, 4>(_mm_blendv_ps(alt.m_vec, v.m_vec, condition.native()));
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		// TODO: only works when condition has either all or none set!
-		return vector<float, 4>(_mm_or_ps(_mm_and_ps(v.m_vec, condition.native()), _mm_andnot_ps(alt.m_vec, condition.native())));
+		return select(v, alt, vector<float, 4>(condition.native()));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 	}
 
@@ -331,8 +451,9 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
 		return vector<float, 4>(_mm_blendv_ps(alt.m_vec, v.m_vec, condition.m_vec));
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		// TODO: only works when condition has either all or none set!
-		return vector<float, 4>(_mm_or_ps(_mm_and_ps(v.m_vec, condition.m_vec), _mm_andnot_ps(alt.m_vec, condition.m_vec)));
+		// Only the sign bits count like for blendv, so spread them over their lanes
+		const auto sign = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(condition.m_vec), 31));
+		return vector<float, 4>(_mm_or_ps(_mm_and_ps(v.m_vec, sign), _mm_andnot_ps(sign, alt.m_vec)));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 	}
 
@@ -346,11 +467,12 @@ namespace simd {
 	}
 
 	mask<float, 4> operator==(const mask<float, 4> &v1, const mask<float, 4> &v2) {
-		return mask<float, 4>(_mm_cmp_ps(v1.m_vec, v2.m_vec, _CMP_EQ_OQ));
+		// Mask lanes are all ones (NaN) or all zeros, so compare bitwise instead of as floats
+		return mask<float, 4>(_mm_xor_ps(_mm_xor_ps(v1.m_vec, v2.m_vec), _mm_castsi128_ps(_mm_set1_epi32(-1))));
 	}
 
 	mask<float, 4> operator!=(const mask<float, 4> &v1, const mask<float, 4> &v2) {
-		return mask<float, 4>(_mm_cmp_ps(v1.m_vec, v2.m_vec, _CMP_NEQ_OQ));
+		return mask<float, 4>(_mm_xor_ps(v1.m_vec, v2.m_vec));
 	}
 
 	mask<float, 4> &mask<float, 4>::operator&=(const mask<float, 4> &v) {
@@ -388,6 +510,11 @@ namespace simd {
 		return mask<float, 4>(_mm_andnot_ps(v1.m_vec, v2.m_vec));
 	}
 
+	mask<float, 4> mask<float, 4>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<float, 4>(_mm_castsi128_ps(_mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 1, 2, 3))));
+	}
+
 	int mask<float, 4>::get_mask() const {
 		return _mm_movemask_ps(m_vec);
 	}
@@ -407,4 +534,5 @@ namespace simd {
 
 #endif // SIMD_SUPPORTS(SIMD_SSE)
 
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -7,14 +7,14 @@
 #include "util.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 #if SIMD_SUPPORTS(SIMD_AVX)
-	using float32x8 = vector<float, 8>;
-
 	template <>
 	class vector<float, 8> : public vector_base<float, 8> {
 	public:
 		static constexpr int required_version = native_vector<type, width>::required_version;
+		static constexpr bool fused_multiply_add = SIMD_FMA;
 
 	public:
 		SIMD_FORCEINLINE vector() : vector_base() {}
@@ -28,8 +28,16 @@ namespace simd {
 		explicit SIMD_FORCEINLINE vector(const type *vals, aligned_load) : vector_base(_mm256_load_ps(vals)) {}
 #if SIMD_SUPPORTS(SIMD_AVX2)
 		explicit SIMD_FORCEINLINE vector(const vector<int, 8> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<std::uint32_t, 8> &v);
 #endif // SIMD_SUPPORTS(SIMD_AVX2)
 
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
 		SIMD_FORCEINLINE vector<float, 8> &operator+=(const vector<float, 8> &v);
 		SIMD_FORCEINLINE vector<float, 8> &operator-=(const vector<float, 8> &v);
 		SIMD_FORCEINLINE vector<float, 8> &operator*=(const vector<float, 8> &v);
@@ -38,6 +46,11 @@ namespace simd {
 		friend SIMD_FORCEINLINE vector<float, 8> operator-(vector<float, 8> v1, const vector<float, 8> &v2);
 		friend SIMD_FORCEINLINE vector<float, 8> operator*(vector<float, 8> v1, const vector<float, 8> &v2);
 		friend SIMD_FORCEINLINE vector<float, 8> operator/(vector<float, 8> v1, const vector<float, 8> &v2);
+		// v1 * v2 + v3, v1 * v2 - v3, -(v1 * v2) + v3 and -(v1 * v2) - v3, see is_fma_fused
+		friend SIMD_FORCEINLINE vector<float, 8> fmadd(const vector<float, 8> &v1, const vector<float, 8> &v2, const vector<float, 8> &v3);
+		friend SIMD_FORCEINLINE vector<float, 8> fmsub(const vector<float, 8> &v1, const vector<float, 8> &v2, const vector<float, 8> &v3);
+		friend SIMD_FORCEINLINE vector<float, 8> fnmadd(const vector<float, 8> &v1, const vector<float, 8> &v2, const vector<float, 8> &v3);
+		friend SIMD_FORCEINLINE vector<float, 8> fnmsub(const vector<float, 8> &v1, const vector<float, 8> &v2, const vector<float, 8> &v3);
 
 		SIMD_FORCEINLINE vector<float, 8> &operator&=(const vector<float, 8> &v);
 		SIMD_FORCEINLINE vector<float, 8> &operator|=(const vector<float, 8> &v);
@@ -78,7 +91,7 @@ namespace simd {
 		friend SIMD_FORCEINLINE vector<float, 8> select(const vector<float, 8> &v, const vector<float, 8> &alt, const mask<float, 8> &condition);
 		friend SIMD_FORCEINLINE vector<float, 8> select(const vector<float, 8> &v, const vector<float, 8> &alt, const vector<float, 8> &condition);
 
-		friend std::ostream &operator<<(std::ostream &stream, const vector<float, 8> &v);
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<float, 8> &v);
 	};
 
 	template <>
@@ -90,8 +103,9 @@ namespace simd {
 		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7, bool b8) : vector_base(_mm256_castsi256_ps(_mm256_set_epi32(
 			-static_cast<int>(b8), -static_cast<int>(b7), -static_cast<int>(b6), -static_cast<int>(b5),
 			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1)))) {}
-		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[7], arr[6], arr[5], arr[4], arr[3], arr[2], arr[1], arr[0]) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3], arr[4], arr[5], arr[6], arr[7]) {}
 		explicit SIMD_FORCEINLINE mask(const vector<float, 8> &v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<float, 8> first_n(size_t count);
 
 		friend SIMD_FORCEINLINE mask<float, 8> operator==(const mask<float, 8> &v1, const mask<float, 8> &v2);
 		friend SIMD_FORCEINLINE mask<float, 8> operator!=(const mask<float, 8> &v1, const mask<float, 8> &v2);
@@ -112,6 +126,24 @@ namespace simd {
 		SIMD_FORCEINLINE bool none() const;
 	};
 
+	void vector<float, 8>::store(type *vals) const {
+		_mm256_storeu_ps(vals, m_vec);
+	}
+
+	void vector<float, 8>::store(type *vals, aligned_store) const {
+		_mm256_store_ps(vals, m_vec);
+	}
+
+	void vector<float, 8>::stream(type *vals) const {
+		_mm256_stream_ps(vals, m_vec);
+	}
+
+	void vector<float, 8>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		const auto tail = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(detail::tail_mask_table + 8 - count));
+		_mm256_maskstore_ps(vals, tail, m_vec);
+	}
+
 	vector<float, 8> &vector<float, 8>::operator+=(const vector<float, 8> &v) {
 		m_vec = _mm256_add_ps(m_vec, v.m_vec);
 		return *this;
@@ -146,7 +178,7 @@ namespace simd {
 		// Results in A1+A2, A3+A4, ..., ..., A5+A6, A7+A8
 		auto t1 = _mm256_hadd_ps(m_vec, m_vec);
 		// Permute to get A5+A6, A7+A8, ....
-		auto t2 = _mm256_permute2f128_ps(m_vec, m_vec, 0b000001);
+		auto t2 = _mm256_permute2f128_ps(t1, t1, 0b000001);
 		// Add first 4 elements
 		auto t3 = _mm256_add_ps(t1, t2);
 		// And last 4 elements
@@ -157,7 +189,11 @@ namespace simd {
 	}
 
 	float vector<float, 8>::hsub() const {
-		throw std::runtime_error("Operation not implemented");
+		// Results in A1-A2, A3-A4, ..., ..., A5-A6, A7-A8
+		auto t1 = _mm256_hsub_ps(m_vec, m_vec);
+		// (A1-A2)-(A3-A4) and (A5-A6)-(A7-A8) in the first entry of each half
+		auto t2 = _mm256_hsub_ps(t1, t1);
+		return _mm_cvtss_f32(_mm_sub_ss(_mm256_castps256_ps128(t2), _mm256_extractf128_ps(t2, 1)));
 	}
 
 	vector<float, 8> hadd(vector<float, 8> v1, const vector<float, 8> &v2) {
@@ -184,6 +220,38 @@ namespace simd {
 		return (v1 /= v2);
 	}
 
+	vector<float, 8> fmadd(const vector<float, 8> &v1, const vector<float, 8> &v2, const vector<float, 8> &v3) {
+#if SIMD_FMA
+		return vector<float, 8>(_mm256_fmadd_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<float, 8>(_mm256_add_ps(_mm256_mul_ps(v1.m_vec, v2.m_vec), v3.m_vec));
+#endif // SIMD_FMA
+	}
+
+	vector<float, 8> fmsub(const vector<float, 8> &v1, const vector<float, 8> &v2, const vector<float, 8> &v3) {
+#if SIMD_FMA
+		return vector<float, 8>(_mm256_fmsub_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<float, 8>(_mm256_sub_ps(_mm256_mul_ps(v1.m_vec, v2.m_vec), v3.m_vec));
+#endif // SIMD_FMA
+	}
+
+	vector<float, 8> fnmadd(const vector<float, 8> &v1, const vector<float, 8> &v2, const vector<float, 8> &v3) {
+#if SIMD_FMA
+		return vector<float, 8>(_mm256_fnmadd_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<float, 8>(_mm256_sub_ps(v3.m_vec, _mm256_mul_ps(v1.m_vec, v2.m_vec)));
+#endif // SIMD_FMA
+	}
+
+	vector<float, 8> fnmsub(const vector<float, 8> &v1, const vector<float, 8> &v2, const vector<float, 8> &v3) {
+#if SIMD_FMA
+		return vector<float, 8>(_mm256_fnmsub_ps(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<float, 8>(_mm256_xor_ps(_mm256_add_ps(_mm256_mul_ps(v1.m_vec, v2.m_vec), v3.m_vec), _mm256_set1_ps(-0.f)));
+#endif // SIMD_FMA
+	}
+
 	vector<float, 8> &vector<float, 8>::operator&=(const vector<float, 8> &v) {
 		m_vec = _mm256_and_ps(m_vec, v.m_vec);
 		return *this;
@@ -277,8 +345,12 @@ namespace simd {
 	}
 
 	vector<float, 8> &vector<float, 8>::round(int mode) {
-		// TODO: requires constant expression?
-		m_vec = _mm256_round_ps(m_vec, 0);
+		switch(mode & 0b11) {
+		case 0: m_vec = _mm256_round_ps(m_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); break;
+		case 1: m_vec = _mm256_round_ps(m_vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); break;
+		case 2: m_vec = _mm256_round_ps(m_vec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); break;
+		default: m_vec = _mm256_round_ps(m_vec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); break;
+		}
 		return *this;
 	}
 
@@ -312,11 +384,12 @@ namespace simd {
 	}
 
 	mask<float, 8> operator==(const mask<float, 8> &v1, const mask<float, 8> &v2) {
-		return mask<float, 8>(_mm256_cmp_ps(v1.m_vec, v2.m_vec, _CMP_EQ_OQ));
+		// Mask lanes are all ones (NaN) or all zeros, so compare bitwise instead of as floats
+		return mask<float, 8>(_mm256_xor_ps(_mm256_xor_ps(v1.m_vec, v2.m_vec), _mm256_castsi256_ps(_mm256_set1_epi32(-1))));
 	}
 
 	mask<float, 8> operator!=(const mask<float, 8> &v1, const mask<float, 8> &v2) {
-		return mask<float, 8>(_mm256_cmp_ps(v1.m_vec, v2.m_vec, _CMP_NEQ_OQ));
+		return mask<float, 8>(_mm256_xor_ps(v1.m_vec, v2.m_vec));
 	}
 
 	mask<float, 8> &mask<float, 8>::operator&=(const mask<float, 8> &v) {
@@ -354,13 +427,18 @@ namespace simd {
 		return mask<float, 8>(_mm256_andnot_ps(v1.m_vec, v2.m_vec));
 	}
 
+	mask<float, 8> mask<float, 8>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<float, 8>(_mm256_cmp_ps(_mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f), _mm256_set1_ps(static_cast<float>(n)), _CMP_LT_OQ));
+	}
+
 	int mask<float, 8>::get_mask() const {
 		return _mm256_movemask_ps(m_vec);
 	}
 
 	bool mask<float, 8>::all() const {
 		// TODO: what is faster here?
-		return _mm256_movemask_ps(m_vec) & 0b11111111;
+		return _mm256_movemask_ps(m_vec) == 0b11111111;
 	}
 
 	bool mask<float, 8>::any() const {
@@ -373,4 +451,5 @@ namespace simd {
 
 #endif // SIMD_SUPPORTS(SIMD_AVX)
 
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -6,14 +6,28 @@
 #include "simd.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 #if SIMD_SUPPORTS(SIMD_SSE2)
-	using float64x2 = vector<double, 2>;
+#if !SIMD_SUPPORTS(SIMD_SSE4_1)
+	namespace detail {
+		// Same trick as the float version (float32x4.hpp) with 2^52
+		inline __m128d round_nearest(__m128d x) {
+			const auto sign = _mm_set1_pd(-0.0);
+			const auto limit = _mm_set1_pd(4503599627370496.0);
+			auto magic = _mm_or_pd(_mm_and_pd(x, sign), limit);
+			auto r = _mm_sub_pd(_mm_add_pd(x, magic), magic);
+			auto integral = _mm_cmpge_pd(_mm_andnot_pd(sign, x), limit);
+			return _mm_or_pd(_mm_and_pd(integral, x), _mm_andnot_pd(integral, r));
+		}
+	} // namespace detail
+#endif // !SIMD_SUPPORTS(SIMD_SSE4_1)
 
 	template <>
 	class vector<double, 2> : public vector_base<double, 2> {
 	public:
 		static constexpr int required_version = native_vector<type, width>::required_version;
+		static constexpr bool fused_multiply_add = SIMD_FMA;
 
 	public:
 		vector() : vector_base() {}
@@ -23,57 +37,71 @@ namespace simd {
 		explicit vector(const std::array<type, width>& arr) : vector_base(_mm_set_pd(arr[1], arr[0])) {}
 		explicit vector(const type *vals) : vector_base(_mm_loadu_pd(vals)) {}
 		explicit vector(const type *vals, aligned_load) : vector_base(_mm_load_pd(vals)) {}
-		explicit vector(const vector<int, 4> &v);
-		explicit vector(const vector<float, 4> &v);
-
-		vector<double, 2> &operator+=(const vector<double, 2> &v);
-		vector<double, 2> &operator-=(const vector<double, 2> &v);
-		vector<double, 2> &operator*=(const vector<double, 2> &v);
-		vector<double, 2> &operator/=(const vector<double, 2> &v);
-		friend vector<double, 2> operator+(vector<double, 2> v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator-(vector<double, 2> v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator*(vector<double, 2> v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator/(vector<double, 2> v1, const vector<double, 2> &v2);
-
-		vector<double, 2> &operator&=(const vector<double, 2> &v);
-		vector<double, 2> &operator|=(const vector<double, 2> &v);
-		vector<double, 2> &operator^=(const vector<double, 2> &v);
-		friend vector<double, 2> operator~(const vector<double, 2> &v);
-		friend vector<double, 2> operator&(vector<double, 2> v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator|(vector<double, 2> v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator^(vector<double, 2> v1, const vector<double, 2> &v2);
-
-		friend vector<double, 2> operator==(const vector<double, 2> &v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator!=(const vector<double, 2> &v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator>(const vector<double, 2> &v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator>=(const vector<double, 2> &v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator<(const vector<double, 2> &v1, const vector<double, 2> &v2);
-		friend vector<double, 2> operator<=(const vector<double, 2> &v1, const vector<double, 2> &v2);
-
-		vector<double, 2> &hadd(const vector<double, 2> &v);
-		vector<double, 2> &hsub(const vector<double, 2> &v);
-		type hadd() const;
-		type hsub() const;
-		friend vector<double, 2> hadd(vector<double, 2> v1, const vector<double, 2> &v2);
-		friend vector<double, 2> hsub(vector<double, 2> v1, const vector<double, 2> &v2);
-
-		vector<double, 2> &abs();
-		friend vector<double, 2> abs(vector<double, 2> v);
-		friend vector<double, 2> min(const vector<double, 2> &v1, const vector<double, 2> &v2);
-		friend vector<double, 2> max(const vector<double, 2> &v1, const vector<double, 2> &v2);
-		vector<double, 2> &ceil();
-		vector<double, 2> &floor();
-		vector<double, 2> &round(int mode);
-		friend vector<double, 2> ceil(vector<double, 2> v);
-		friend vector<double, 2> floor(vector<double, 2> v);
-		friend vector<double, 2> round(vector<double, 2> v, int mode);
-
-		vector<double, 2> sqrt() const;
-		vector<double, 2> rsqrt() const;
-
-		friend vector<double, 2> select(const vector<double, 2> &v, const vector<double, 2> &alt, const mask<double, 2> &condition);
-
-		friend std::ostream &operator<<(std::ostream &stream, const vector<double, 2> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<int, 4> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<float, 4> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<std::uint32_t, 4> &v);
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<double, 2> &operator+=(const vector<double, 2> &v);
+		SIMD_FORCEINLINE vector<double, 2> &operator-=(const vector<double, 2> &v);
+		SIMD_FORCEINLINE vector<double, 2> &operator*=(const vector<double, 2> &v);
+		SIMD_FORCEINLINE vector<double, 2> &operator/=(const vector<double, 2> &v);
+		friend SIMD_FORCEINLINE vector<double, 2> operator+(vector<double, 2> v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator-(vector<double, 2> v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator*(vector<double, 2> v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator/(vector<double, 2> v1, const vector<double, 2> &v2);
+		// v1 * v2 + v3, v1 * v2 - v3, -(v1 * v2) + v3 and -(v1 * v2) - v3, see is_fma_fused
+		friend SIMD_FORCEINLINE vector<double, 2> fmadd(const vector<double, 2> &v1, const vector<double, 2> &v2, const vector<double, 2> &v3);
+		friend SIMD_FORCEINLINE vector<double, 2> fmsub(const vector<double, 2> &v1, const vector<double, 2> &v2, const vector<double, 2> &v3);
+		friend SIMD_FORCEINLINE vector<double, 2> fnmadd(const vector<double, 2> &v1, const vector<double, 2> &v2, const vector<double, 2> &v3);
+		friend SIMD_FORCEINLINE vector<double, 2> fnmsub(const vector<double, 2> &v1, const vector<double, 2> &v2, const vector<double, 2> &v3);
+
+		SIMD_FORCEINLINE vector<double, 2> &operator&=(const vector<double, 2> &v);
+		SIMD_FORCEINLINE vector<double, 2> &operator|=(const vector<double, 2> &v);
+		SIMD_FORCEINLINE vector<double, 2> &operator^=(const vector<double, 2> &v);
+		friend SIMD_FORCEINLINE vector<double, 2> operator~(const vector<double, 2> &v);
+		friend SIMD_FORCEINLINE vector<double, 2> operator&(vector<double, 2> v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator|(vector<double, 2> v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator^(vector<double, 2> v1, const vector<double, 2> &v2);
+
+		friend SIMD_FORCEINLINE vector<double, 2> operator==(const vector<double, 2> &v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator!=(const vector<double, 2> &v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator>(const vector<double, 2> &v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator>=(const vector<double, 2> &v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator<(const vector<double, 2> &v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> operator<=(const vector<double, 2> &v1, const vector<double, 2> &v2);
+
+		SIMD_FORCEINLINE vector<double, 2> &hadd(const vector<double, 2> &v);
+		SIMD_FORCEINLINE vector<double, 2> &hsub(const vector<double, 2> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<double, 2> hadd(vector<double, 2> v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> hsub(vector<double, 2> v1, const vector<double, 2> &v2);
+
+		SIMD_FORCEINLINE vector<double, 2> &abs();
+		friend SIMD_FORCEINLINE vector<double, 2> abs(vector<double, 2> v);
+		friend SIMD_FORCEINLINE vector<double, 2> min(const vector<double, 2> &v1, const vector<double, 2> &v2);
+		friend SIMD_FORCEINLINE vector<double, 2> max(const vector<double, 2> &v1, const vector<double, 2> &v2);
+		SIMD_FORCEINLINE vector<double, 2> &ceil();
+		SIMD_FORCEINLINE vector<double, 2> &floor();
+		SIMD_FORCEINLINE vector<double, 2> &round(int mode);
+		friend SIMD_FORCEINLINE vector<double, 2> ceil(vector<double, 2> v);
+		friend SIMD_FORCEINLINE vector<double, 2> floor(vector<double, 2> v);
+		friend SIMD_FORCEINLINE vector<double, 2> round(vector<double, 2> v, int mode);
+
+		SIMD_FORCEINLINE vector<double, 2> sqrt() const;
+		SIMD_FORCEINLINE vector<double, 2> rsqrt() const;
+
+		friend SIMD_FORCEINLINE vector<double, 2> select(const vector<double, 2> &v, const vector<double, 2> &alt, const mask<double, 2> &condition);
+		friend SIMD_FORCEINLINE vector<double, 2> select(const vector<double, 2> &v, const vector<double, 2> &alt, const vector<double, 2> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<double, 2> &v);
 	};
 
 	template <>
@@ -84,8 +112,9 @@ namespace simd {
 		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_castsi128_pd(_mm_set1_epi64x(-static_cast<int>(b)))) {}
 		explicit SIMD_FORCEINLINE mask(bool b1, bool b2) : vector_base(_mm_castsi128_pd(_mm_set_epi64x(
 			-static_cast<int>(b2), -static_cast<int>(b1)))) {}
-		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[1], arr[0]) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1]) {}
 		explicit SIMD_FORCEINLINE mask(const vector<double, 2> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<double, 2> first_n(size_t count);
 
 		friend SIMD_FORCEINLINE mask<double, 2> operator==(const mask<double, 2> & v1, const mask<double, 2> & v2);
 		friend SIMD_FORCEINLINE mask<double, 2> operator!=(const mask<double, 2> & v1, const mask<double, 2> & v2);
@@ -106,6 +135,30 @@ namespace simd {
 		SIMD_FORCEINLINE bool none() const;
 	};
 
+	void vector<double, 2>::store(type *vals) const {
+		_mm_storeu_pd(vals, m_vec);
+	}
+
+	void vector<double, 2>::store(type *vals, aligned_store) const {
+		_mm_store_pd(vals, m_vec);
+	}
+
+	void vector<double, 2>::stream(type *vals) const {
+		_mm_stream_pd(vals, m_vec);
+	}
+
+	void vector<double, 2>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		switch(count) {
+		case 2:
+			_mm_storeu_pd(vals, m_vec);
+			break;
+		case 1:
+			_mm_store_sd(vals, m_vec);
+			break;
+		}
+	}
+
 	vector<double, 2> &vector<double, 2>::operator+=(const vector<double, 2> &v) {
 		m_vec = _mm_add_pd(m_vec, v.m_vec);
 		return *this;
@@ -130,7 +183,7 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE3)
 		m_vec = _mm_hadd_pd(m_vec, v.m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
+		m_vec = _mm_add_pd(_mm_unpacklo_pd(m_vec, v.m_vec), _mm_unpackhi_pd(m_vec, v.m_vec));
 #endif // SIMD_SUPPORTS(SIMD_SSE3)
 		return *this;
 	}
@@ -139,7 +192,7 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE3)
 		m_vec = _mm_hsub_pd(m_vec, v.m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
+		m_vec = _mm_sub_pd(_mm_unpacklo_pd(m_vec, v.m_vec), _mm_unpackhi_pd(m_vec, v.m_vec));
 #endif // SIMD_SUPPORTS(SIMD_SSE3)
 		return *this;
 	}
@@ -155,7 +208,7 @@ namespace simd {
 	}
 
 	double vector<double, 2>::hsub() const {
-		throw std::runtime_error("Operation not implemented");
+		return _mm_cvtsd_f64(_mm_sub_sd(m_vec, _mm_unpackhi_pd(m_vec, m_vec)));
 	}
 
 	vector<double, 2> hadd(vector<double, 2> v1, const vector<double, 2> &v2) {
@@ -182,6 +235,38 @@ namespace simd {
 		return (v1 /= v2);
 	}
 
+	vector<double, 2> fmadd(const vector<double, 2> &v1, const vector<double, 2> &v2, const vector<double, 2> &v3) {
+#if SIMD_FMA
+		return vector<double, 2>(_mm_fmadd_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<double, 2>(_mm_add_pd(_mm_mul_pd(v1.m_vec, v2.m_vec), v3.m_vec));
+#endif // SIMD_FMA
+	}
+
+	vector<double, 2> fmsub(const vector<double, 2> &v1, const vector<double, 2> &v2, const vector<double, 2> &v3) {
+#if SIMD_FMA
+		return vector<double, 2>(_mm_fmsub_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<double, 2>(_mm_sub_pd(_mm_mul_pd(v1.m_vec, v2.m_vec), v3.m_vec));
+#endif // SIMD_FMA
+	}
+
+	vector<double, 2> fnmadd(const vector<double, 2> &v1, const vector<double, 2> &v2, const vector<double, 2> &v3) {
+#if SIMD_FMA
+		return vector<double, 2>(_mm_fnmadd_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<double, 2>(_mm_sub_pd(v3.m_vec, _mm_mul_pd(v1.m_vec, v2.m_vec)));
+#endif // SIMD_FMA
+	}
+
+	vector<double, 2> fnmsub(const vector<double, 2> &v1, const vector<double, 2> &v2, const vector<double, 2> &v3) {
+#if SIMD_FMA
+		return vector<double, 2>(_mm_fnmsub_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<double, 2>(_mm_xor_pd(_mm_add_pd(_mm_mul_pd(v1.m_vec, v2.m_vec), v3.m_vec), _mm_set1_pd(-0.0)));
+#endif // SIMD_FMA
+	}
+
 	vector<double, 2> &vector<double, 2>::operator&=(const vector<double, 2> &v) {
 		m_vec = _mm_and_pd(m_vec, v.m_vec);
 		return *this;
@@ -267,7 +352,9 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
 		m_vec = _mm_ceil_pd(m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
+		auto r = detail::round_nearest(m_vec);
+		r = _mm_add_pd(r, _mm_and_pd(_mm_cmplt_pd(r, m_vec), _mm_set1_pd(1.0)));
+		m_vec = _mm_or_pd(r, _mm_and_pd(m_vec, _mm_set1_pd(-0.0)));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 		return *this;
 	}
@@ -276,17 +363,34 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
 		m_vec = _mm_floor_pd(m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
+		auto r = detail::round_nearest(m_vec);
+		r = _mm_sub_pd(r, _mm_and_pd(_mm_cmpgt_pd(r, m_vec), _mm_set1_pd(1.0)));
+		m_vec = _mm_or_pd(r, _mm_and_pd(m_vec, _mm_set1_pd(-0.0)));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 		return *this;
 	}
 
 	vector<double, 2> &vector<double, 2>::round(int mode) {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
-		// TODO: requires constant expression?
-		m_vec = _mm_round_pd(m_vec, 0);
+		switch(mode & 0b11) {
+		case 0: m_vec = _mm_round_pd(m_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); break;
+		case 1: m_vec = _mm_round_pd(m_vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); break;
+		case 2: m_vec = _mm_round_pd(m_vec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); break;
+		default: m_vec = _mm_round_pd(m_vec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); break;
+		}
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
+		switch(mode & 0b11) {
+		case 0: m_vec = _mm_or_pd(detail::round_nearest(m_vec), _mm_and_pd(m_vec, _mm_set1_pd(-0.0))); break;
+		case 1: floor(); break;
+		case 2: ceil(); break;
+		default: {
+			// Towards zero is the floor of the magnitude
+			const auto sign = _mm_and_pd(m_vec, _mm_set1_pd(-0.0));
+			m_vec = _mm_xor_pd(m_vec, sign);
+			floor();
+			m_vec = _mm_or_pd(m_vec, sign);
+		}
+		}
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 		return *this;
 	}
@@ -307,8 +411,17 @@ namespace simd {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
 		return vector<double, 2>(_mm_blendv_pd(alt.m_vec, v.m_vec, condition.native()));
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		// TODO: only works when condition has either all or none set!
-		return vector<double, 2>(_mm_or_pd(_mm_and_pd(v.m_vec, condition.m_vec), _mm_andnot_pd(alt.m_vec, condition.native())));
+		return select(v, alt, vector<double, 2>(condition.native()));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<double, 2> select(const vector<double, 2> &v, const vector<double, 2> &alt, const vector<double, 2> &condition) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<double, 2>(_mm_blendv_pd(alt.m_vec, v.m_vec, condition.m_vec));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// Only the sign bits count like for blendv, copied into the upper and then the lower halves of the lanes
+		const auto sign = _mm_castsi128_pd(_mm_shuffle_epi32(_mm_srai_epi32(_mm_castpd_si128(condition.m_vec), 31), _MM_SHUFFLE(3, 3, 1, 1)));
+		return vector<double, 2>(_mm_or_pd(_mm_and_pd(v.m_vec, sign), _mm_andnot_pd(sign, alt.m_vec)));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 	}
 
@@ -322,11 +435,12 @@ namespace simd {
 	}
 
 	mask<double, 2> operator==(const mask<double, 2> & v1, const mask<double, 2> & v2) {
-		return mask<double, 2>(_mm_cmp_pd(v1.m_vec, v2.m_vec, _CMP_EQ_OQ));
+		// Mask lanes are all ones (NaN) or all zeros, so compare bitwise instead of as floats
+		return mask<double, 2>(_mm_xor_pd(_mm_xor_pd(v1.m_vec, v2.m_vec), _mm_castsi128_pd(_mm_set1_epi64x(-1))));
 	}
 
 	mask<double, 2> operator!=(const mask<double, 2> & v1, const mask<double, 2> & v2) {
-		return mask<double, 2>(_mm_cmp_pd(v1.m_vec, v2.m_vec, _CMP_NEQ_OQ));
+		return mask<double, 2>(_mm_xor_pd(v1.m_vec, v2.m_vec));
 	}
 
 	mask<double, 2> & mask<double, 2>::operator&=(const mask<double, 2> & v) {
@@ -364,13 +478,18 @@ namespace simd {
 		return mask<double, 2>(_mm_andnot_pd(v1.m_vec, v2.m_vec));
 	}
 
+	mask<double, 2> mask<double, 2>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<double, 2>(_mm_castsi128_pd(_mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 0, 1, 1))));
+	}
+
 	int mask<double, 2>::get_mask() const {
 		return _mm_movemask_pd(m_vec);
 	}
 
 	bool mask<double, 2>::all() const {
 		// TODO: what is faster here?
-		return _mm_movemask_pd(m_vec) == 0b1111;
+		return _mm_movemask_pd(m_vec) == 0b11;
 	}
 
 	bool mask<double, 2>::any() const {
@@ -383,4 +502,5 @@ namespace simd {
 
 #endif // SIMD_SUPPORTS(SIMD_SSE2)
 
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
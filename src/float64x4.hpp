@@ -6,14 +6,14 @@
 #include "simd.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 #if SIMD_SUPPORTS(SIMD_AVX)
-	using float64x4 = vector<double, 4>;
-
 	template <>
 	class vector<double, 4> : public vector_base<double, 4> {
 	public:
 		static constexpr int required_version = native_vector<type, width>::required_version;
+		static constexpr bool fused_multiply_add = SIMD_FMA;
 
 	public:
 		vector() : vector_base() {}
@@ -23,57 +23,71 @@ namespace simd {
 		explicit vector(const std::array<type, width>& arr) : vector_base(_mm256_set_pd(arr[3], arr[2], arr[1], arr[0])) {}
 		explicit vector(const type *vals) : vector_base(_mm256_loadu_pd(vals)) {}
 		explicit vector(const type *vals, aligned_load) : vector_base(_mm256_load_pd(vals)) {}
-		explicit vector(const vector<int, 4> &v);
-		explicit vector(const vector<float, 4> &v);
-
-		vector<double, 4> &operator+=(const vector<double, 4> &v);
-		vector<double, 4> &operator-=(const vector<double, 4> &v);
-		vector<double, 4> &operator*=(const vector<double, 4> &v);
-		vector<double, 4> &operator/=(const vector<double, 4> &v);
-		friend vector<double, 4> operator+(vector<double, 4> v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator-(vector<double, 4> v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator*(vector<double, 4> v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator/(vector<double, 4> v1, const vector<double, 4> &v2);
-
-		vector<double, 4> &operator&=(const vector<double, 4> &v);
-		vector<double, 4> &operator|=(const vector<double, 4> &v);
-		vector<double, 4> &operator^=(const vector<double, 4> &v);
-		friend vector<double, 4> operator~(const vector<double, 4> &v);
-		friend vector<double, 4> operator&(vector<double, 4> v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator|(vector<double, 4> v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator^(vector<double, 4> v1, const vector<double, 4> &v2);
-
-		friend vector<double, 4> operator==(const vector<double, 4> &v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator!=(const vector<double, 4> &v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator>(const vector<double, 4> &v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator>=(const vector<double, 4> &v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator<(const vector<double, 4> &v1, const vector<double, 4> &v2);
-		friend vector<double, 4> operator<=(const vector<double, 4> &v1, const vector<double, 4> &v2);
-
-		vector<double, 4> &hadd(const vector<double, 4> &v);
-		vector<double, 4> &hsub(const vector<double, 4> &v);
-		type hadd() const;
-		type hsub() const;
-		friend vector<double, 4> hadd(vector<double, 4> v1, const vector<double, 4> &v2);
-		friend vector<double, 4> hsub(vector<double, 4> v1, const vector<double, 4> &v2);
-
-		vector<double, 4> &abs();
-		friend vector<double, 4> abs(vector<double, 4> v);
-		friend vector<double, 4> min(const vector<double, 4> &v1, const vector<double, 4> &v2);
-		friend vector<double, 4> max(const vector<double, 4> &v1, const vector<double, 4> &v2);
-		vector<double, 4> &ceil();
-		vector<double, 4> &floor();
-		vector<double, 4> &round(int mode);
-		friend vector<double, 4> ceil(vector<double, 4> v);
-		friend vector<double, 4> floor(vector<double, 4> v);
-		friend vector<double, 4> round(vector<double, 4> v, int mode);
-
-		vector<double, 4> sqrt() const;
-		vector<double, 4> rsqrt() const;
-
-		friend vector<double, 4> select(const vector<double, 4> &v, const vector<double, 4> &alt, const mask<double, 4> &condition);
-
-		friend std::ostream &operator<<(std::ostream &stream, const vector<double, 4> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<int, 4> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<float, 4> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<std::uint32_t, 4> &v);
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<double, 4> &operator+=(const vector<double, 4> &v);
+		SIMD_FORCEINLINE vector<double, 4> &operator-=(const vector<double, 4> &v);
+		SIMD_FORCEINLINE vector<double, 4> &operator*=(const vector<double, 4> &v);
+		SIMD_FORCEINLINE vector<double, 4> &operator/=(const vector<double, 4> &v);
+		friend SIMD_FORCEINLINE vector<double, 4> operator+(vector<double, 4> v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator-(vector<double, 4> v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator*(vector<double, 4> v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator/(vector<double, 4> v1, const vector<double, 4> &v2);
+		// v1 * v2 + v3, v1 * v2 - v3, -(v1 * v2) + v3 and -(v1 * v2) - v3, see is_fma_fused
+		friend SIMD_FORCEINLINE vector<double, 4> fmadd(const vector<double, 4> &v1, const vector<double, 4> &v2, const vector<double, 4> &v3);
+		friend SIMD_FORCEINLINE vector<double, 4> fmsub(const vector<double, 4> &v1, const vector<double, 4> &v2, const vector<double, 4> &v3);
+		friend SIMD_FORCEINLINE vector<double, 4> fnmadd(const vector<double, 4> &v1, const vector<double, 4> &v2, const vector<double, 4> &v3);
+		friend SIMD_FORCEINLINE vector<double, 4> fnmsub(const vector<double, 4> &v1, const vector<double, 4> &v2, const vector<double, 4> &v3);
+
+		SIMD_FORCEINLINE vector<double, 4> &operator&=(const vector<double, 4> &v);
+		SIMD_FORCEINLINE vector<double, 4> &operator|=(const vector<double, 4> &v);
+		SIMD_FORCEINLINE vector<double, 4> &operator^=(const vector<double, 4> &v);
+		friend SIMD_FORCEINLINE vector<double, 4> operator~(const vector<double, 4> &v);
+		friend SIMD_FORCEINLINE vector<double, 4> operator&(vector<double, 4> v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator|(vector<double, 4> v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator^(vector<double, 4> v1, const vector<double, 4> &v2);
+
+		friend SIMD_FORCEINLINE vector<double, 4> operator==(const vector<double, 4> &v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator!=(const vector<double, 4> &v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator>(const vector<double, 4> &v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator>=(const vector<double, 4> &v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator<(const vector<double, 4> &v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> operator<=(const vector<double, 4> &v1, const vector<double, 4> &v2);
+
+		SIMD_FORCEINLINE vector<double, 4> &hadd(const vector<double, 4> &v);
+		SIMD_FORCEINLINE vector<double, 4> &hsub(const vector<double, 4> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<double, 4> hadd(vector<double, 4> v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> hsub(vector<double, 4> v1, const vector<double, 4> &v2);
+
+		SIMD_FORCEINLINE vector<double, 4> &abs();
+		friend SIMD_FORCEINLINE vector<double, 4> abs(vector<double, 4> v);
+		friend SIMD_FORCEINLINE vector<double, 4> min(const vector<double, 4> &v1, const vector<double, 4> &v2);
+		friend SIMD_FORCEINLINE vector<double, 4> max(const vector<double, 4> &v1, const vector<double, 4> &v2);
+		SIMD_FORCEINLINE vector<double, 4> &ceil();
+		SIMD_FORCEINLINE vector<double, 4> &floor();
+		SIMD_FORCEINLINE vector<double, 4> &round(int mode);
+		friend SIMD_FORCEINLINE vector<double, 4> ceil(vector<double, 4> v);
+		friend SIMD_FORCEINLINE vector<double, 4> floor(vector<double, 4> v);
+		friend SIMD_FORCEINLINE vector<double, 4> round(vector<double, 4> v, int mode);
+
+		SIMD_FORCEINLINE vector<double, 4> sqrt() const;
+		SIMD_FORCEINLINE vector<double, 4> rsqrt() const;
+
+		friend SIMD_FORCEINLINE vector<double, 4> select(const vector<double, 4> &v, const vector<double, 4> &alt, const mask<double, 4> &condition);
+		friend SIMD_FORCEINLINE vector<double, 4> select(const vector<double, 4> &v, const vector<double, 4> &alt, const vector<double, 4> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<double, 4> &v);
 	};
 
 	template <>
@@ -84,8 +98,9 @@ namespace simd {
 		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm256_castsi256_pd(_mm256_set1_epi64x(-static_cast<int>(b)))) {}
 		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4) : vector_base(_mm256_castsi256_pd(_mm256_set_epi64x(
 			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1)))) {}
-		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[3], arr[2], arr[1], arr[0]) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3]) {}
 		explicit SIMD_FORCEINLINE mask(const vector<double, 4> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<double, 4> first_n(size_t count);
 
 		friend SIMD_FORCEINLINE mask<double, 4> operator==(const mask<double, 4> & v1, const mask<double, 4> & v2);
 		friend SIMD_FORCEINLINE mask<double, 4> operator!=(const mask<double, 4> & v1, const mask<double, 4> & v2);
@@ -106,6 +121,25 @@ namespace simd {
 		SIMD_FORCEINLINE bool none() const;
 	};
 
+	void vector<double, 4>::store(type *vals) const {
+		_mm256_storeu_pd(vals, m_vec);
+	}
+
+	void vector<double, 4>::store(type *vals, aligned_store) const {
+		_mm256_store_pd(vals, m_vec);
+	}
+
+	void vector<double, 4>::stream(type *vals) const {
+		_mm256_stream_pd(vals, m_vec);
+	}
+
+	void vector<double, 4>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		// Two 32 bit mask entries per 64 bit lane
+		const auto tail = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(detail::tail_mask_table + 8 - 2 * count));
+		_mm256_maskstore_pd(vals, tail, m_vec);
+	}
+
 	vector<double, 4> &vector<double, 4>::operator+=(const vector<double, 4> &v) {
 		m_vec = _mm256_add_pd(m_vec, v.m_vec);
 		return *this;
@@ -127,39 +161,26 @@ namespace simd {
 	}
 
 	vector<double, 4> &vector<double, 4>::hadd(const vector<double, 4> &v) {
-#if SIMD_SUPPORTS(SIMD_SSE3)
 		m_vec = _mm256_hadd_pd(m_vec, v.m_vec);
-#else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE3)
 		return *this;
 	}
 
 	vector<double, 4> &vector<double, 4>::hsub(const vector<double, 4> &v) {
-#if SIMD_SUPPORTS(SIMD_SSE3)
 		m_vec = _mm256_hsub_pd(m_vec, v.m_vec);
-#else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE3)
 		return *this;
 	}
 
 	double vector<double, 4>::hadd() const {
-		throw std::runtime_error("Operation not implemented");
-		return 0.0;
 		// Results in A1+A2, ..., A3+A4, ...
-		/*auto t1 = _mm256_hadd_pd(m_vec, m_vec);
-		// Permute to get A1+A2, A3+A4, ...
-		auto t2 = _mm256_permute2f128_pd(m_vec, m_vec, 0b000001);
-		// Add (A1+A2)+(A3+A4), ...
-		auto t3 = _mm256_hadd_ps(t1, t1);
-		
-		// Grab the first entry
-		return _mm256_cvtsd_f64(t3);*/
+		auto t1 = _mm256_hadd_pd(m_vec, m_vec);
+		// Add (A1+A2)+(A3+A4) from both halves
+		return _mm_cvtsd_f64(_mm_add_sd(_mm256_castpd256_pd128(t1), _mm256_extractf128_pd(t1, 1)));
 	}
 
 	double vector<double, 4>::hsub() const {
-		throw std::runtime_error("Operation not implemented");
+		// Results in A1-A2, ..., A3-A4, ...
+		auto t1 = _mm256_hsub_pd(m_vec, m_vec);
+		return _mm_cvtsd_f64(_mm_sub_sd(_mm256_castpd256_pd128(t1), _mm256_extractf128_pd(t1, 1)));
 	}
 
 	vector<double, 4> hadd(vector<double, 4> v1, const vector<double, 4> &v2) {
@@ -186,6 +207,38 @@ namespace simd {
 		return (v1 /= v2);
 	}
 
+	vector<double, 4> fmadd(const vector<double, 4> &v1, const vector<double, 4> &v2, const vector<double, 4> &v3) {
+#if SIMD_FMA
+		return vector<double, 4>(_mm256_fmadd_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<double, 4>(_mm256_add_pd(_mm256_mul_pd(v1.m_vec, v2.m_vec), v3.m_vec));
+#endif // SIMD_FMA
+	}
+
+	vector<double, 4> fmsub(const vector<double, 4> &v1, const vector<double, 4> &v2, const vector<double, 4> &v3) {
+#if SIMD_FMA
+		return vector<double, 4>(_mm256_fmsub_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<double, 4>(_mm256_sub_pd(_mm256_mul_pd(v1.m_vec, v2.m_vec), v3.m_vec));
+#endif // SIMD_FMA
+	}
+
+	vector<double, 4> fnmadd(const vector<double, 4> &v1, const vector<double, 4> &v2, const vector<double, 4> &v3) {
+#if SIMD_FMA
+		return vector<double, 4>(_mm256_fnmadd_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<double, 4>(_mm256_sub_pd(v3.m_vec, _mm256_mul_pd(v1.m_vec, v2.m_vec)));
+#endif // SIMD_FMA
+	}
+
+	vector<double, 4> fnmsub(const vector<double, 4> &v1, const vector<double, 4> &v2, const vector<double, 4> &v3) {
+#if SIMD_FMA
+		return vector<double, 4>(_mm256_fnmsub_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+#else // SIMD_FMA
+		return vector<double, 4>(_mm256_xor_pd(_mm256_add_pd(_mm256_mul_pd(v1.m_vec, v2.m_vec), v3.m_vec), _mm256_set1_pd(-0.0)));
+#endif // SIMD_FMA
+	}
+
 	vector<double, 4> &vector<double, 4>::operator&=(const vector<double, 4> &v) {
 		m_vec = _mm256_and_pd(m_vec, v.m_vec);
 		return *this;
@@ -278,8 +331,12 @@ namespace simd {
 	}
 
 	vector<double, 4> &vector<double, 4>::round(int mode) {
-		// TODO: requires constant expression?
-		m_vec = _mm256_round_pd(m_vec, 0);
+		switch(mode & 0b11) {
+		case 0: m_vec = _mm256_round_pd(m_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); break;
+		case 1: m_vec = _mm256_round_pd(m_vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); break;
+		case 2: m_vec = _mm256_round_pd(m_vec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); break;
+		default: m_vec = _mm256_round_pd(m_vec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); break;
+		}
 		return *this;
 	}
 
@@ -299,6 +356,10 @@ namespace simd {
 		return vector<double, 4>(_mm256_blendv_pd(alt.m_vec, v.m_vec, condition.native()));
 	}
 
+	vector<double, 4> select(const vector<double, 4> &v, const vector<double, 4> &alt, const vector<double, 4> &condition) {
+		return vector<double, 4>(_mm256_blendv_pd(alt.m_vec, v.m_vec, condition.m_vec));
+	}
+
 	std::ostream &operator<<(std::ostream &stream, const vector<double, 4> &v) {
 		stream << '(';
 		for (size_t i = 0; i < v.width - 1; ++i) {
@@ -309,11 +370,12 @@ namespace simd {
 	}
 
 	mask<double, 4> operator==(const mask<double, 4> & v1, const mask<double, 4> & v2) {
-		return mask<double, 4>(_mm256_cmp_pd(v1.m_vec, v2.m_vec, _CMP_EQ_OQ));
+		// Mask lanes are all ones (NaN) or all zeros, so compare bitwise instead of as floats
+		return mask<double, 4>(_mm256_xor_pd(_mm256_xor_pd(v1.m_vec, v2.m_vec), _mm256_castsi256_pd(_mm256_set1_epi64x(-1))));
 	}
 
 	mask<double, 4> operator!=(const mask<double, 4> & v1, const mask<double, 4> & v2) {
-		return mask<double, 4>(_mm256_cmp_pd(v1.m_vec, v2.m_vec, _CMP_NEQ_OQ));
+		return mask<double, 4>(_mm256_xor_pd(v1.m_vec, v2.m_vec));
 	}
 
 	mask<double, 4> & mask<double, 4>::operator&=(const mask<double, 4> & v) {
@@ -351,6 +413,11 @@ namespace simd {
 		return mask<double, 4>(_mm256_andnot_pd(v1.m_vec, v2.m_vec));
 	}
 
+	mask<double, 4> mask<double, 4>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<double, 4>(_mm256_cmp_pd(_mm256_setr_pd(0., 1., 2., 3.), _mm256_set1_pd(n), _CMP_LT_OQ));
+	}
+
 	int mask<double, 4>::get_mask() const {
 		return _mm256_movemask_pd(m_vec);
 	}
@@ -370,4 +437,5 @@ namespace simd {
 
 #endif // SIMD_SUPPORTS(SIMD_AVX)
 
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
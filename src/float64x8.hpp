@@ -0,0 +1,466 @@
+#pragma once
+
+#include <array>
+#include <exception>
+#include "base_types.hpp"
+#include "simd.hpp"
+#include "util.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	template <>
+	class vector<double, 8> : public vector_base<double, 8> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+		// AVX-512 always has FMA
+		static constexpr bool fused_multiply_add = true;
+
+	public:
+		SIMD_FORCEINLINE vector() : vector_base() {}
+		explicit SIMD_FORCEINLINE vector(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE vector(type f) : vector_base(_mm512_set1_pd(f)) {}
+		explicit SIMD_FORCEINLINE vector(type f1, type f2, type f3, type f4,
+										 type f5, type f6, type f7, type f8) : vector_base(_mm512_set_pd(f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit SIMD_FORCEINLINE vector(const std::array<type, width> &arr) : vector_base(_mm512_loadu_pd(arr.data())) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals) : vector_base(_mm512_loadu_pd(vals)) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals, aligned_load) : vector_base(_mm512_load_pd(vals)) {}
+		explicit SIMD_FORCEINLINE vector(const vector<std::int32_t, 8> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<float, 8> &v);
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE vector(const vector<std::int64_t, 8> &v);
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<double, 8> &operator+=(const vector<double, 8> &v);
+		SIMD_FORCEINLINE vector<double, 8> &operator-=(const vector<double, 8> &v);
+		SIMD_FORCEINLINE vector<double, 8> &operator*=(const vector<double, 8> &v);
+		SIMD_FORCEINLINE vector<double, 8> &operator/=(const vector<double, 8> &v);
+		friend SIMD_FORCEINLINE vector<double, 8> operator+(vector<double, 8> v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE vector<double, 8> operator-(vector<double, 8> v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE vector<double, 8> operator*(vector<double, 8> v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE vector<double, 8> operator/(vector<double, 8> v1, const vector<double, 8> &v2);
+		// v1 * v2 + v3, v1 * v2 - v3, -(v1 * v2) + v3 and -(v1 * v2) - v3, see is_fma_fused
+		friend SIMD_FORCEINLINE vector<double, 8> fmadd(const vector<double, 8> &v1, const vector<double, 8> &v2, const vector<double, 8> &v3);
+		friend SIMD_FORCEINLINE vector<double, 8> fmsub(const vector<double, 8> &v1, const vector<double, 8> &v2, const vector<double, 8> &v3);
+		friend SIMD_FORCEINLINE vector<double, 8> fnmadd(const vector<double, 8> &v1, const vector<double, 8> &v2, const vector<double, 8> &v3);
+		friend SIMD_FORCEINLINE vector<double, 8> fnmsub(const vector<double, 8> &v1, const vector<double, 8> &v2, const vector<double, 8> &v3);
+
+		SIMD_FORCEINLINE vector<double, 8> &operator&=(const vector<double, 8> &v);
+		SIMD_FORCEINLINE vector<double, 8> &operator|=(const vector<double, 8> &v);
+		SIMD_FORCEINLINE vector<double, 8> &operator^=(const vector<double, 8> &v);
+		friend SIMD_FORCEINLINE vector<double, 8> operator~(const vector<double, 8> &v);
+		friend SIMD_FORCEINLINE vector<double, 8> operator&(vector<double, 8> v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE vector<double, 8> operator|(vector<double, 8> v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE vector<double, 8> operator^(vector<double, 8> v1, const vector<double, 8> &v2);
+
+		// Comparisons produce k-register masks instead of vectors
+		friend SIMD_FORCEINLINE mask<double, 8> operator==(const vector<double, 8> &v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> operator!=(const vector<double, 8> &v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> operator>(const vector<double, 8> &v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> operator>=(const vector<double, 8> &v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> operator<(const vector<double, 8> &v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> operator<=(const vector<double, 8> &v1, const vector<double, 8> &v2);
+
+		SIMD_FORCEINLINE vector<double, 8> &hadd(const vector<double, 8> &v);
+		SIMD_FORCEINLINE vector<double, 8> &hsub(const vector<double, 8> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		// Pairwise difference tree, i.e. ((A1-A2)-(A3-A4))-((A5-A6)-(A7-A8))-...
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<double, 8> hadd(vector<double, 8> v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE vector<double, 8> hsub(vector<double, 8> v1, const vector<double, 8> &v2);
+
+		SIMD_FORCEINLINE vector<double, 8> &abs();
+		friend SIMD_FORCEINLINE vector<double, 8> abs(vector<double, 8> v);
+		friend SIMD_FORCEINLINE vector<double, 8> min(const vector<double, 8> &v1, const vector<double, 8> &v2);
+		friend SIMD_FORCEINLINE vector<double, 8> max(const vector<double, 8> &v1, const vector<double, 8> &v2);
+		SIMD_FORCEINLINE vector<double, 8> &ceil();
+		SIMD_FORCEINLINE vector<double, 8> &floor();
+		SIMD_FORCEINLINE vector<double, 8> &round(int mode);
+		friend SIMD_FORCEINLINE vector<double, 8> ceil(vector<double, 8> v);
+		friend SIMD_FORCEINLINE vector<double, 8> floor(vector<double, 8> v);
+		friend SIMD_FORCEINLINE vector<double, 8> round(vector<double, 8> v, int mode);
+
+		SIMD_FORCEINLINE vector<double, 8> sqrt() const;
+		SIMD_FORCEINLINE vector<double, 8> rsqrt() const;
+
+		friend SIMD_FORCEINLINE vector<double, 8> select(const vector<double, 8> &v, const vector<double, 8> &alt, const mask<double, 8> &condition);
+		friend SIMD_FORCEINLINE vector<double, 8> select(const vector<double, 8> &v, const vector<double, 8> &alt, const vector<double, 8> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<double, 8> &v);
+	};
+
+	template <>
+	class mask<double, 8> {
+	public:
+		using type = double;
+		static constexpr size_t width = 8;
+		using native_type = native_vector<type, width>::mask_type;
+
+		SIMD_FORCEINLINE mask() : m_mask(0) {}
+		explicit SIMD_FORCEINLINE mask(native_type m) : m_mask(m) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : m_mask(static_cast<native_type>(-static_cast<int>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7, bool b8) :
+			mask(std::array<bool, width>{ { b1, b2, b3, b4, b5, b6, b7, b8 } }) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width> &arr) : m_mask(0) {
+			for(size_t i = 0; i < width; ++i)
+				m_mask |= static_cast<native_type>(arr[i]) << i;
+		}
+		// Lanes with the sign bit set are considered true, like by the blendv and movemask based masks
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE mask(const vector<double, 8> &v) : m_mask(_mm512_movepi64_mask(_mm512_castpd_si512(v.native()))) {}
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE mask(const vector<double, 8> &v) : m_mask(_mm512_cmplt_epi64_mask(_mm512_castpd_si512(v.native()), _mm512_setzero_si512())) {}
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		static SIMD_FORCEINLINE mask<double, 8> first_n(size_t count);
+
+		SIMD_FORCEINLINE native_type &native() {
+			return m_mask;
+		}
+
+		SIMD_FORCEINLINE const native_type &native() const {
+			return m_mask;
+		}
+
+		SIMD_FORCEINLINE bool operator[](size_t index) const {
+			assert(index < width);
+			return (m_mask >> index) & 1;
+		}
+
+		friend SIMD_FORCEINLINE mask<double, 8> operator==(const mask<double, 8> &v1, const mask<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> operator!=(const mask<double, 8> &v1, const mask<double, 8> &v2);
+
+		SIMD_FORCEINLINE mask<double, 8> &operator&=(const mask<double, 8> &v);
+		SIMD_FORCEINLINE mask<double, 8> &operator|=(const mask<double, 8> &v);
+		SIMD_FORCEINLINE mask<double, 8> &operator^=(const mask<double, 8> &v);
+
+		friend SIMD_FORCEINLINE mask<double, 8> operator~(const mask<double, 8> &v);
+		friend SIMD_FORCEINLINE mask<double, 8> operator&(mask<double, 8> v1, const mask<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> operator|(mask<double, 8> v1, const mask<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> operator^(mask<double, 8> v1, const mask<double, 8> &v2);
+		friend SIMD_FORCEINLINE mask<double, 8> andnot(const mask<double, 8> &v1, const mask<double, 8> &v2);
+
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const mask<double, 8> &m);
+
+	private:
+		native_type m_mask;
+	};
+
+	void vector<double, 8>::store(type *vals) const {
+		_mm512_storeu_pd(vals, m_vec);
+	}
+
+	void vector<double, 8>::store(type *vals, aligned_store) const {
+		_mm512_store_pd(vals, m_vec);
+	}
+
+	void vector<double, 8>::stream(type *vals) const {
+		_mm512_stream_pd(vals, m_vec);
+	}
+
+	void vector<double, 8>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		_mm512_mask_storeu_pd(vals, static_cast<__mmask8>((1u << count) - 1u), m_vec);
+	}
+
+	vector<double, 8> &vector<double, 8>::operator+=(const vector<double, 8> &v) {
+		m_vec = _mm512_add_pd(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::operator-=(const vector<double, 8> &v) {
+		m_vec = _mm512_sub_pd(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::operator*=(const vector<double, 8> &v) {
+		m_vec = _mm512_mul_pd(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::operator/=(const vector<double, 8> &v) {
+		m_vec = _mm512_div_pd(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::hadd(const vector<double, 8> &v) {
+		// Same lane layout as _mm256_hadd_pd: A1+A2, B1+B2 per 128 bit lane
+		m_vec = _mm512_add_pd(_mm512_unpacklo_pd(m_vec, v.m_vec), _mm512_unpackhi_pd(m_vec, v.m_vec));
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::hsub(const vector<double, 8> &v) {
+		m_vec = _mm512_sub_pd(_mm512_unpacklo_pd(m_vec, v.m_vec), _mm512_unpackhi_pd(m_vec, v.m_vec));
+		return *this;
+	}
+
+	double vector<double, 8>::hadd() const {
+		return _mm512_reduce_add_pd(m_vec);
+	}
+
+	double vector<double, 8>::hsub() const {
+		// Every lane with an odd number of set index bits ends up negated in the difference tree
+		auto negated = _mm512_mask_xor_epi64(_mm512_castpd_si512(m_vec), 0x96, _mm512_castpd_si512(m_vec), _mm512_set1_epi64(0x8000000000000000));
+		return _mm512_reduce_add_pd(_mm512_castsi512_pd(negated));
+	}
+
+	vector<double, 8> hadd(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return v1.hadd(v2);
+	}
+
+	vector<double, 8> hsub(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return v1.hsub(v2);
+	}
+
+	vector<double, 8> operator+(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<double, 8> operator-(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<double, 8> operator*(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<double, 8> operator/(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<double, 8> fmadd(const vector<double, 8> &v1, const vector<double, 8> &v2, const vector<double, 8> &v3) {
+		return vector<double, 8>(_mm512_fmadd_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+	}
+
+	vector<double, 8> fmsub(const vector<double, 8> &v1, const vector<double, 8> &v2, const vector<double, 8> &v3) {
+		return vector<double, 8>(_mm512_fmsub_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+	}
+
+	vector<double, 8> fnmadd(const vector<double, 8> &v1, const vector<double, 8> &v2, const vector<double, 8> &v3) {
+		return vector<double, 8>(_mm512_fnmadd_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+	}
+
+	vector<double, 8> fnmsub(const vector<double, 8> &v1, const vector<double, 8> &v2, const vector<double, 8> &v3) {
+		return vector<double, 8>(_mm512_fnmsub_pd(v1.m_vec, v2.m_vec, v3.m_vec));
+	}
+
+	// The floating point logic instructions require AVX512DQ, the integer ones do the same job
+	vector<double, 8> &vector<double, 8>::operator&=(const vector<double, 8> &v) {
+		m_vec = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(m_vec), _mm512_castpd_si512(v.m_vec)));
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::operator|=(const vector<double, 8> &v) {
+		m_vec = _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(m_vec), _mm512_castpd_si512(v.m_vec)));
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::operator^=(const vector<double, 8> &v) {
+		m_vec = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(m_vec), _mm512_castpd_si512(v.m_vec)));
+		return *this;
+	}
+
+	vector<double, 8> operator~(const vector<double, 8> &v) {
+		return vector<double, 8>(_mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(v.m_vec), _mm512_set1_epi32(-1))));
+	}
+
+	vector<double, 8> operator&(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<double, 8> operator|(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<double, 8> operator^(vector<double, 8> v1, const vector<double, 8> &v2) {
+		return v1 ^= v2;
+	}
+
+	mask<double, 8> operator==(const vector<double, 8> &v1, const vector<double, 8> &v2) {
+		return mask<double, 8>(_mm512_cmp_pd_mask(v1.m_vec, v2.m_vec, _CMP_EQ_OQ));
+	}
+
+	mask<double, 8> operator!=(const vector<double, 8> &v1, const vector<double, 8> &v2) {
+		return mask<double, 8>(_mm512_cmp_pd_mask(v1.m_vec, v2.m_vec, _CMP_NEQ_UQ));
+	}
+
+	mask<double, 8> operator>(const vector<double, 8> &v1, const vector<double, 8> &v2) {
+		return mask<double, 8>(_mm512_cmp_pd_mask(v1.m_vec, v2.m_vec, _CMP_GT_OQ));
+	}
+
+	mask<double, 8> operator>=(const vector<double, 8> &v1, const vector<double, 8> &v2) {
+		return mask<double, 8>(_mm512_cmp_pd_mask(v1.m_vec, v2.m_vec, _CMP_GE_OQ));
+	}
+
+	mask<double, 8> operator<(const vector<double, 8> &v1, const vector<double, 8> &v2) {
+		return mask<double, 8>(_mm512_cmp_pd_mask(v1.m_vec, v2.m_vec, _CMP_LT_OQ));
+	}
+
+	mask<double, 8> operator<=(const vector<double, 8> &v1, const vector<double, 8> &v2) {
+		return mask<double, 8>(_mm512_cmp_pd_mask(v1.m_vec, v2.m_vec, _CMP_LE_OQ));
+	}
+
+	vector<double, 8> &vector<double, 8>::abs() {
+		// Clear the sign bit
+		m_vec = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(m_vec), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFF)));
+		return *this;
+	}
+
+	vector<double, 8> abs(vector<double, 8> v) {
+		return v.abs();
+	}
+
+	vector<double, 8> min(const vector<double, 8> &v1, const vector<double, 8> &v2) {
+		return vector<double, 8>(_mm512_min_pd(v1.m_vec, v2.m_vec));
+	}
+
+	vector<double, 8> max(const vector<double, 8> &v1, const vector<double, 8> &v2) {
+		return vector<double, 8>(_mm512_max_pd(v1.m_vec, v2.m_vec));
+	}
+
+	vector<double, 8> vector<double, 8>::sqrt() const {
+		return vector<double, 8>(_mm512_sqrt_pd(m_vec));
+	}
+
+	vector<double, 8> vector<double, 8>::rsqrt() const {
+		return vector<double, 8>(_mm512_rsqrt14_pd(m_vec));
+	}
+
+	vector<double, 8> &vector<double, 8>::ceil() {
+		m_vec = _mm512_roundscale_pd(m_vec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::floor() {
+		m_vec = _mm512_roundscale_pd(m_vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+		return *this;
+	}
+
+	vector<double, 8> &vector<double, 8>::round(int mode) {
+		switch(mode & 0b11) {
+		case 0: m_vec = _mm512_roundscale_pd(m_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); break;
+		case 1: m_vec = _mm512_roundscale_pd(m_vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); break;
+		case 2: m_vec = _mm512_roundscale_pd(m_vec, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); break;
+		default: m_vec = _mm512_roundscale_pd(m_vec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); break;
+		}
+		return *this;
+	}
+
+	vector<double, 8> ceil(vector<double, 8> v) {
+		return v.ceil();
+	}
+
+	vector<double, 8> floor(vector<double, 8> v) {
+		return v.floor();
+	}
+
+	vector<double, 8> round(vector<double, 8> v, int mode) {
+		return v.round(mode);
+	}
+
+	vector<double, 8> select(const vector<double, 8> &v, const vector<double, 8> &alt, const mask<double, 8> &condition) {
+		return vector<double, 8>(_mm512_mask_blend_pd(condition.native(), alt.m_vec, v.m_vec));
+	}
+
+	vector<double, 8> select(const vector<double, 8> &v, const vector<double, 8> &alt, const vector<double, 8> &condition) {
+		return select(v, alt, mask<double, 8>(condition));
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<double, 8> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	// The 8 bit k-register instructions need AVX512DQ, plain integer operations on the mask do the same job
+	mask<double, 8> operator==(const mask<double, 8> &v1, const mask<double, 8> &v2) {
+		return mask<double, 8>(static_cast<__mmask8>(~(v1.m_mask ^ v2.m_mask)));
+	}
+
+	mask<double, 8> operator!=(const mask<double, 8> &v1, const mask<double, 8> &v2) {
+		return mask<double, 8>(static_cast<__mmask8>(v1.m_mask ^ v2.m_mask));
+	}
+
+	mask<double, 8> &mask<double, 8>::operator&=(const mask<double, 8> &v) {
+		m_mask &= v.m_mask;
+		return *this;
+	}
+
+	mask<double, 8> &mask<double, 8>::operator|=(const mask<double, 8> &v) {
+		m_mask |= v.m_mask;
+		return *this;
+	}
+
+	mask<double, 8> &mask<double, 8>::operator^=(const mask<double, 8> &v) {
+		m_mask ^= v.m_mask;
+		return *this;
+	}
+
+	mask<double, 8> operator~(const mask<double, 8> &v) {
+		return mask<double, 8>(static_cast<__mmask8>(~v.m_mask));
+	}
+
+	mask<double, 8> operator&(mask<double, 8> v1, const mask<double, 8> &v2) {
+		return v1 &= v2;
+	}
+
+	mask<double, 8> operator|(mask<double, 8> v1, const mask<double, 8> &v2) {
+		return v1 |= v2;
+	}
+
+	mask<double, 8> operator^(mask<double, 8> v1, const mask<double, 8> &v2) {
+		return v1 ^= v2;
+	}
+
+	mask<double, 8> andnot(const mask<double, 8> &v1, const mask<double, 8> &v2) {
+		return mask<double, 8>(static_cast<__mmask8>(~v1.m_mask & v2.m_mask));
+	}
+
+	mask<double, 8> mask<double, 8>::first_n(size_t count) {
+		return mask<double, 8>(static_cast<native_type>((1u << (count < width ? count : width)) - 1));
+	}
+
+	int mask<double, 8>::get_mask() const {
+		return m_mask;
+	}
+
+	bool mask<double, 8>::all() const {
+		return m_mask == 0xFF;
+	}
+
+	bool mask<double, 8>::any() const {
+		return m_mask != 0;
+	}
+
+	bool mask<double, 8>::none() const {
+		return m_mask == 0;
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const mask<double, 8> &m) {
+		stream << '(';
+		for (size_t i = 0; i < m.width - 1; ++i) {
+			stream << m[i] << ' ';
+		}
+		stream << m[m.width - 1] << ')';
+		return stream;
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,375 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "float32x4.hpp"
+#include "float32x8.hpp"
+#include "float64x2.hpp"
+#include "float64x4.hpp"
+#include "int32x4.hpp"
+#include "int32x8.hpp"
+#include "int64x2.hpp"
+#include "int64x4.hpp"
+#include "float32x16.hpp"
+#include "float64x8.hpp"
+#include "int32x16.hpp"
+#include "int64x8.hpp"
+
+// Indexed loads and stores through 32 bit element offsets: lane i of gather(base, index) is base[index[i]],
+// scatter(base, index, v) stores lane i of v to base[index[i]]. AVX2 gathers and AVX-512 gathers and
+// scatters are used where available (scatters of 128 and 256 bit vectors need AVX512VL, i.e. SIMD_AVX512BW),
+// everything else loads or stores lane by lane. Scatters to the same element keep the highest lane.
+//
+// Hardware gathers are not always faster than scalar loads (bench/gather.cpp): on current cores they win
+// for tables in the caches, while for tables far beyond the last level cache both are bound by the misses.
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		// Builds the vector from scalar loads, which compiles to insertions into the register
+		template < class T, size_t W, size_t... L >
+		SIMD_FORCEINLINE vector<T, W> gather_lanes(const T *base, const std::int32_t *index, std::index_sequence<L...>) {
+			return vector<T, W>(std::array<T, W>{ { base[index[L]]... } });
+		}
+
+		// Lanes not in the mask read their value from alt, so no address outside the selected ones is accessed
+		template < class T, size_t W, size_t... L >
+		SIMD_FORCEINLINE vector<T, W> gather_lanes(const T *base, const std::int32_t *index, const T *alt, int bits, std::index_sequence<L...>) {
+			return vector<T, W>(std::array<T, W>{ { *(lane_set<T, W>(bits, L) ? base + index[L] : alt + L)... } });
+		}
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+		// vector<std::int32_t, 2> has no register of its own, so its offsets are loaded into the low half of one
+		SIMD_FORCEINLINE __m128i low_offsets(const vector<std::int32_t, 2> &index) {
+			alignas(8) std::int32_t offsets[2];
+			index.store(offsets);
+			return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(offsets));
+		}
+
+		SIMD_FORCEINLINE vector<float, 4> gather(const float *base, const vector<std::int32_t, 4> &index) {
+			return vector<float, 4>(_mm_i32gather_ps(base, index.native(), 4));
+		}
+
+		SIMD_FORCEINLINE vector<float, 4> gather(const float *base, const vector<std::int32_t, 4> &index, const vector<float, 4> &alt,
+												 const mask<float, 4> &condition) {
+			return vector<float, 4>(_mm_mask_i32gather_ps(alt.native(), base, index.native(), condition.native(), 4));
+		}
+
+		SIMD_FORCEINLINE vector<float, 8> gather(const float *base, const vector<std::int32_t, 8> &index) {
+			return vector<float, 8>(_mm256_i32gather_ps(base, index.native(), 4));
+		}
+
+		SIMD_FORCEINLINE vector<float, 8> gather(const float *base, const vector<std::int32_t, 8> &index, const vector<float, 8> &alt,
+												 const mask<float, 8> &condition) {
+			return vector<float, 8>(_mm256_mask_i32gather_ps(alt.native(), base, index.native(), condition.native(), 4));
+		}
+
+		SIMD_FORCEINLINE vector<double, 2> gather(const double *base, const vector<std::int32_t, 2> &index) {
+			return vector<double, 2>(_mm_i32gather_pd(base, low_offsets(index), 8));
+		}
+
+		SIMD_FORCEINLINE vector<double, 2> gather(const double *base, const vector<std::int32_t, 2> &index, const vector<double, 2> &alt,
+												  const mask<double, 2> &condition) {
+			return vector<double, 2>(_mm_mask_i32gather_pd(alt.native(), base, low_offsets(index), condition.native(), 8));
+		}
+
+		SIMD_FORCEINLINE vector<double, 4> gather(const double *base, const vector<std::int32_t, 4> &index) {
+			return vector<double, 4>(_mm256_i32gather_pd(base, index.native(), 8));
+		}
+
+		SIMD_FORCEINLINE vector<double, 4> gather(const double *base, const vector<std::int32_t, 4> &index, const vector<double, 4> &alt,
+												  const mask<double, 4> &condition) {
+			return vector<double, 4>(_mm256_mask_i32gather_pd(alt.native(), base, index.native(), condition.native(), 8));
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 4> gather(const std::int32_t *base, const vector<std::int32_t, 4> &index) {
+			return vector<std::int32_t, 4>(_mm_i32gather_epi32(reinterpret_cast<const int *>(base), index.native(), 4));
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 4> gather(const std::int32_t *base, const vector<std::int32_t, 4> &index,
+														const vector<std::int32_t, 4> &alt, const mask<std::int32_t, 4> &condition) {
+			return vector<std::int32_t, 4>(_mm_mask_i32gather_epi32(alt.native(), reinterpret_cast<const int *>(base), index.native(),
+																	condition.native(), 4));
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 8> gather(const std::int32_t *base, const vector<std::int32_t, 8> &index) {
+			return vector<std::int32_t, 8>(_mm256_i32gather_epi32(reinterpret_cast<const int *>(base), index.native(), 4));
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 8> gather(const std::int32_t *base, const vector<std::int32_t, 8> &index,
+														const vector<std::int32_t, 8> &alt, const mask<std::int32_t, 8> &condition) {
+			return vector<std::int32_t, 8>(_mm256_mask_i32gather_epi32(alt.native(), reinterpret_cast<const int *>(base), index.native(),
+																	   condition.native(), 4));
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 2> gather(const std::int64_t *base, const vector<std::int32_t, 2> &index) {
+			return vector<std::int64_t, 2>(_mm_i32gather_epi64(reinterpret_cast<const long long *>(base), low_offsets(index), 8));
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 2> gather(const std::int64_t *base, const vector<std::int32_t, 2> &index,
+														const vector<std::int64_t, 2> &alt, const mask<std::int64_t, 2> &condition) {
+			return vector<std::int64_t, 2>(_mm_mask_i32gather_epi64(alt.native(), reinterpret_cast<const long long *>(base), low_offsets(index),
+																	condition.native(), 8));
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 4> gather(const std::int64_t *base, const vector<std::int32_t, 4> &index) {
+			return vector<std::int64_t, 4>(_mm256_i32gather_epi64(reinterpret_cast<const long long *>(base), index.native(), 8));
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 4> gather(const std::int64_t *base, const vector<std::int32_t, 4> &index,
+														const vector<std::int64_t, 4> &alt, const mask<std::int64_t, 4> &condition) {
+			return vector<std::int64_t, 4>(_mm256_mask_i32gather_epi64(alt.native(), reinterpret_cast<const long long *>(base), index.native(),
+																	   condition.native(), 8));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+		SIMD_FORCEINLINE vector<float, 16> gather(const float *base, const vector<std::int32_t, 16> &index) {
+			return vector<float, 16>(_mm512_i32gather_ps(index.native(), base, 4));
+		}
+
+		SIMD_FORCEINLINE vector<float, 16> gather(const float *base, const vector<std::int32_t, 16> &index, const vector<float, 16> &alt,
+												  const mask<float, 16> &condition) {
+			return vector<float, 16>(_mm512_mask_i32gather_ps(alt.native(), condition.native(), index.native(), base, 4));
+		}
+
+		SIMD_FORCEINLINE void scatter(float *base, const vector<std::int32_t, 16> &index, const vector<float, 16> &v) {
+			_mm512_i32scatter_ps(base, index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(float *base, const vector<std::int32_t, 16> &index, const vector<float, 16> &v, const mask<float, 16> &condition) {
+			_mm512_mask_i32scatter_ps(base, condition.native(), index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE vector<double, 8> gather(const double *base, const vector<std::int32_t, 8> &index) {
+			return vector<double, 8>(_mm512_i32gather_pd(index.native(), base, 8));
+		}
+
+		SIMD_FORCEINLINE vector<double, 8> gather(const double *base, const vector<std::int32_t, 8> &index, const vector<double, 8> &alt,
+												  const mask<double, 8> &condition) {
+			return vector<double, 8>(_mm512_mask_i32gather_pd(alt.native(), condition.native(), index.native(), base, 8));
+		}
+
+		SIMD_FORCEINLINE void scatter(double *base, const vector<std::int32_t, 8> &index, const vector<double, 8> &v) {
+			_mm512_i32scatter_pd(base, index.native(), v.native(), 8);
+		}
+
+		SIMD_FORCEINLINE void scatter(double *base, const vector<std::int32_t, 8> &index, const vector<double, 8> &v, const mask<double, 8> &condition) {
+			_mm512_mask_i32scatter_pd(base, condition.native(), index.native(), v.native(), 8);
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 16> gather(const std::int32_t *base, const vector<std::int32_t, 16> &index) {
+			return vector<std::int32_t, 16>(_mm512_i32gather_epi32(index.native(), base, 4));
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 16> gather(const std::int32_t *base, const vector<std::int32_t, 16> &index,
+														 const vector<std::int32_t, 16> &alt, const mask<std::int32_t, 16> &condition) {
+			return vector<std::int32_t, 16>(_mm512_mask_i32gather_epi32(alt.native(), condition.native(), index.native(), base, 4));
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int32_t *base, const vector<std::int32_t, 16> &index, const vector<std::int32_t, 16> &v) {
+			_mm512_i32scatter_epi32(base, index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int32_t *base, const vector<std::int32_t, 16> &index, const vector<std::int32_t, 16> &v,
+									  const mask<std::int32_t, 16> &condition) {
+			_mm512_mask_i32scatter_epi32(base, condition.native(), index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 8> gather(const std::int64_t *base, const vector<std::int32_t, 8> &index) {
+			return vector<std::int64_t, 8>(_mm512_i32gather_epi64(index.native(), base, 8));
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 8> gather(const std::int64_t *base, const vector<std::int32_t, 8> &index,
+														const vector<std::int64_t, 8> &alt, const mask<std::int64_t, 8> &condition) {
+			return vector<std::int64_t, 8>(_mm512_mask_i32gather_epi64(alt.native(), condition.native(), index.native(), base, 8));
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int64_t *base, const vector<std::int32_t, 8> &index, const vector<std::int64_t, 8> &v) {
+			_mm512_i32scatter_epi64(base, index.native(), v.native(), 8);
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int64_t *base, const vector<std::int32_t, 8> &index, const vector<std::int64_t, 8> &v,
+									  const mask<std::int64_t, 8> &condition) {
+			_mm512_mask_i32scatter_epi64(base, condition.native(), index.native(), v.native(), 8);
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		// AVX512VL scatters of the AVX2 vectors, which keep their conditions as vectors
+		SIMD_FORCEINLINE void scatter(float *base, const vector<std::int32_t, 4> &index, const vector<float, 4> &v) {
+			_mm_i32scatter_ps(base, index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(float *base, const vector<std::int32_t, 4> &index, const vector<float, 4> &v, const mask<float, 4> &condition) {
+			_mm_mask_i32scatter_ps(base, static_cast<__mmask8>(_mm_movemask_ps(condition.native())), index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(float *base, const vector<std::int32_t, 8> &index, const vector<float, 8> &v) {
+			_mm256_i32scatter_ps(base, index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(float *base, const vector<std::int32_t, 8> &index, const vector<float, 8> &v, const mask<float, 8> &condition) {
+			_mm256_mask_i32scatter_ps(base, static_cast<__mmask8>(_mm256_movemask_ps(condition.native())), index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(double *base, const vector<std::int32_t, 4> &index, const vector<double, 4> &v) {
+			_mm256_i32scatter_pd(base, index.native(), v.native(), 8);
+		}
+
+		SIMD_FORCEINLINE void scatter(double *base, const vector<std::int32_t, 4> &index, const vector<double, 4> &v, const mask<double, 4> &condition) {
+			_mm256_mask_i32scatter_pd(base, static_cast<__mmask8>(_mm256_movemask_pd(condition.native())), index.native(), v.native(), 8);
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int32_t *base, const vector<std::int32_t, 4> &index, const vector<std::int32_t, 4> &v) {
+			_mm_i32scatter_epi32(base, index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int32_t *base, const vector<std::int32_t, 4> &index, const vector<std::int32_t, 4> &v,
+									  const mask<std::int32_t, 4> &condition) {
+			_mm_mask_i32scatter_epi32(base, static_cast<__mmask8>(_mm_movemask_ps(_mm_castsi128_ps(condition.native()))), index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int32_t *base, const vector<std::int32_t, 8> &index, const vector<std::int32_t, 8> &v) {
+			_mm256_i32scatter_epi32(base, index.native(), v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int32_t *base, const vector<std::int32_t, 8> &index, const vector<std::int32_t, 8> &v,
+									  const mask<std::int32_t, 8> &condition) {
+			_mm256_mask_i32scatter_epi32(base, static_cast<__mmask8>(_mm256_movemask_ps(_mm256_castsi256_ps(condition.native()))), index.native(),
+										 v.native(), 4);
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int64_t *base, const vector<std::int32_t, 4> &index, const vector<std::int64_t, 4> &v) {
+			_mm256_i32scatter_epi64(base, index.native(), v.native(), 8);
+		}
+
+		SIMD_FORCEINLINE void scatter(std::int64_t *base, const vector<std::int32_t, 4> &index, const vector<std::int64_t, 4> &v,
+									  const mask<std::int64_t, 4> &condition) {
+			_mm256_mask_i32scatter_epi64(base, static_cast<__mmask8>(_mm256_movemask_pd(_mm256_castsi256_pd(condition.native()))), index.native(),
+										 v.native(), 8);
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+
+		// Native vectors without a gather or scatter instruction go lane by lane, composite vectors (composite.hpp)
+		// part by part and scalar vectors access their single element
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> gather(const T *base, const vector<std::int32_t, W> &index);
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> gather(const T *base, const vector<std::int32_t, W> &index, const vector<T, W> &alt, const mask<T, W> &condition);
+		template < class T, size_t W >
+		SIMD_FORCEINLINE void scatter(T *base, const vector<std::int32_t, W> &index, const vector<T, W> &v);
+		template < class T, size_t W >
+		SIMD_FORCEINLINE void scatter(T *base, const vector<std::int32_t, W> &index, const vector<T, W> &v, const mask<T, W> &condition);
+
+		template < class T, size_t W >
+		vector<T, W> gather(const T *base, const vector<std::int32_t, W> &index) {
+			if constexpr(W == 1) {
+				return vector<T, W>(base[index[0]]);
+			} else if constexpr(has_native_vector<T, W>::value) {
+				alignas(64) std::int32_t offsets[W];
+				index.store(offsets);
+				return gather_lanes<T, W>(base, offsets, std::make_index_sequence<W>());
+			} else {
+				constexpr size_t pw = vector<T, W>::part_width;
+				alignas(64) std::int32_t offsets[W];
+				index.store(offsets);
+				vector<T, W> res;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					res.part(i) = detail::gather(base, vector<std::int32_t, pw>(offsets + i * pw));
+				return res;
+			}
+		}
+
+		template < class T, size_t W >
+		vector<T, W> gather(const T *base, const vector<std::int32_t, W> &index, const vector<T, W> &alt, const mask<T, W> &condition) {
+			if constexpr(W == 1) {
+				return condition.get_mask() ? vector<T, W>(base[index[0]]) : alt;
+			} else if constexpr(has_native_vector<T, W>::value) {
+				alignas(64) std::int32_t offsets[W];
+				alignas(64) T fallback[W];
+				index.store(offsets);
+				alt.store(fallback);
+				return gather_lanes<T, W>(base, offsets, fallback, condition.get_mask(), std::make_index_sequence<W>());
+			} else {
+				constexpr size_t pw = vector<T, W>::part_width;
+				alignas(64) std::int32_t offsets[W];
+				index.store(offsets);
+				vector<T, W> res;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					res.part(i) = detail::gather(base, vector<std::int32_t, pw>(offsets + i * pw), alt.part(i), condition.part(i));
+				return res;
+			}
+		}
+
+		template < class T, size_t W >
+		void scatter(T *base, const vector<std::int32_t, W> &index, const vector<T, W> &v) {
+			if constexpr(W == 1) {
+				base[index[0]] = v[0];
+			} else {
+				alignas(64) std::int32_t offsets[W];
+				alignas(64) T vals[W];
+				index.store(offsets);
+				v.store(vals);
+				for(size_t i = 0; i < W; ++i)
+					base[offsets[i]] = vals[i];
+			}
+		}
+
+		template < class T, size_t W >
+		void scatter(T *base, const vector<std::int32_t, W> &index, const vector<T, W> &v, const mask<T, W> &condition) {
+			if constexpr(W == 1) {
+				if(condition.get_mask())
+					base[index[0]] = v[0];
+			} else if constexpr(has_native_vector<T, W>::value) {
+				alignas(64) std::int32_t offsets[W];
+				alignas(64) T vals[W];
+				index.store(offsets);
+				v.store(vals);
+				const int bits = condition.get_mask();
+				for(size_t i = 0; i < W; ++i)
+					if(lane_set<T, W>(bits, i))
+						base[offsets[i]] = vals[i];
+			} else {
+				constexpr size_t pw = vector<T, W>::part_width;
+				alignas(64) std::int32_t offsets[W];
+				index.store(offsets);
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					detail::scatter(base, vector<std::int32_t, pw>(offsets + i * pw), v.part(i), condition.part(i));
+			}
+		}
+
+	} // namespace detail
+
+	// Lane i is base[index[i]]
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> gather(const T *base, const vector<std::int32_t, W> &index) {
+		return detail::gather(base, index);
+	}
+
+	// Lane i is base[index[i]] where condition is set and alt[i] otherwise; only the selected elements are read
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> gather(const T *base, const vector<std::int32_t, W> &index, const vector<T, W> &alt, const mask<T, W> &condition) {
+		return detail::gather(base, index, alt, condition);
+	}
+
+	// Stores lane i of v to base[index[i]], the highest lane wins for repeated indices
+	template < class T, size_t W >
+	SIMD_FORCEINLINE void scatter(T *base, const vector<std::int32_t, W> &index, const vector<T, W> &v) {
+		detail::scatter(base, index, v);
+	}
+
+	// Only stores the lanes where condition is set
+	template < class T, size_t W >
+	SIMD_FORCEINLINE void scatter(T *base, const vector<std::int32_t, W> &index, const vector<T, W> &v, const mask<T, W> &condition) {
+		detail::scatter(base, index, v, condition);
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,412 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	template <>
+	class vector<std::int32_t, 16> : public vector_base<std::int32_t, 16> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+	public:
+		SIMD_FORCEINLINE vector() : vector_base() {}
+		explicit SIMD_FORCEINLINE vector(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE vector(type f) : vector_base(_mm512_set1_epi32(f)) {}
+		explicit SIMD_FORCEINLINE vector(type f1, type f2, type f3, type f4, type f5, type f6, type f7, type f8,
+										 type f9, type f10, type f11, type f12, type f13, type f14, type f15, type f16) :
+			vector_base(_mm512_set_epi32(f16, f15, f14, f13, f12, f11, f10, f9, f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit SIMD_FORCEINLINE vector(const std::array<type, width> &arr) : vector_base(_mm512_loadu_si512(arr.data())) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals) : vector_base(_mm512_loadu_si512(vals)) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals, aligned_load) : vector_base(_mm512_load_si512(vals)) {}
+		explicit SIMD_FORCEINLINE vector(const vector<float, 16> &v);
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &operator+=(const vector<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &operator-=(const vector<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &operator*=(const vector<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &operator/=(const vector<std::int32_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator+(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator-(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator*(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator/(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+		// High 32 bits of the 64 bit products
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> mulhi(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+		// Full 64 bit products of the even and the odd lanes respectively, see conversion.hpp
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> mul_even(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> mul_odd(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &operator&=(const vector<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &operator|=(const vector<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &operator^=(const vector<std::int32_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator~(const vector<std::int32_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator&(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator|(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator^(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator<<(const vector<std::int32_t, 16> &v, std::int32_t bits);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> operator>>(const vector<std::int32_t, 16> &v, std::int32_t bits);
+
+		// Comparisons produce k-register masks instead of vectors
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator==(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator!=(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator>(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator>=(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator<(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator<=(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &hadd(const vector<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &hsub(const vector<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		// Pairwise difference tree, i.e. ((A1-A2)-(A3-A4))-((A5-A6)-(A7-A8))-...
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> hadd(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> hsub(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 16> &abs();
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> abs(vector<std::int32_t, 16> v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> min(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> max(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int32_t, 16> select(const vector<std::int32_t, 16> &v, const vector<std::int32_t, 16> &alt, const mask<std::int32_t, 16> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::int32_t, 16> &v);
+	};
+
+	template <>
+	class mask<std::int32_t, 16> {
+	public:
+		using type = std::int32_t;
+		static constexpr size_t width = 16;
+		using native_type = native_vector<type, width>::mask_type;
+
+		SIMD_FORCEINLINE mask() : m_mask(0) {}
+		explicit SIMD_FORCEINLINE mask(native_type m) : m_mask(m) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : m_mask(static_cast<native_type>(-static_cast<int>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7, bool b8,
+									   bool b9, bool b10, bool b11, bool b12, bool b13, bool b14, bool b15, bool b16) :
+			mask(std::array<bool, width>{ { b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15, b16 } }) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width> &arr) : m_mask(0) {
+			for(size_t i = 0; i < width; ++i)
+				m_mask |= static_cast<native_type>(arr[i]) << i;
+		}
+		// Lanes with the sign bit set are considered true, like by the blendv and movemask based masks
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE mask(const vector<std::int32_t, 16> &v) : m_mask(_mm512_movepi32_mask(v.native())) {}
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE mask(const vector<std::int32_t, 16> &v) : m_mask(_mm512_cmplt_epi32_mask(v.native(), _mm512_setzero_si512())) {}
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		static SIMD_FORCEINLINE mask<std::int32_t, 16> first_n(size_t count);
+
+		SIMD_FORCEINLINE native_type &native() {
+			return m_mask;
+		}
+
+		SIMD_FORCEINLINE const native_type &native() const {
+			return m_mask;
+		}
+
+		SIMD_FORCEINLINE bool operator[](size_t index) const {
+			assert(index < width);
+			return (m_mask >> index) & 1;
+		}
+
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator==(const mask<std::int32_t, 16> &v1, const mask<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator!=(const mask<std::int32_t, 16> &v1, const mask<std::int32_t, 16> &v2);
+
+		SIMD_FORCEINLINE mask<std::int32_t, 16> &operator&=(const mask<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE mask<std::int32_t, 16> &operator|=(const mask<std::int32_t, 16> &v);
+		SIMD_FORCEINLINE mask<std::int32_t, 16> &operator^=(const mask<std::int32_t, 16> &v);
+
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator~(const mask<std::int32_t, 16> &v);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator&(mask<std::int32_t, 16> v1, const mask<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator|(mask<std::int32_t, 16> v1, const mask<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> operator^(mask<std::int32_t, 16> v1, const mask<std::int32_t, 16> &v2);
+		friend SIMD_FORCEINLINE mask<std::int32_t, 16> andnot(const mask<std::int32_t, 16> &v1, const mask<std::int32_t, 16> &v2);
+
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const mask<std::int32_t, 16> &m);
+
+	private:
+		native_type m_mask;
+	};
+
+	void vector<std::int32_t, 16>::store(type *vals) const {
+		_mm512_storeu_si512(vals, m_vec);
+	}
+
+	void vector<std::int32_t, 16>::store(type *vals, aligned_store) const {
+		_mm512_store_si512(vals, m_vec);
+	}
+
+	void vector<std::int32_t, 16>::stream(type *vals) const {
+		_mm512_stream_si512(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int32_t, 16>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		_mm512_mask_storeu_epi32(vals, static_cast<__mmask16>((1u << count) - 1u), m_vec);
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::operator+=(const vector<std::int32_t, 16> &v) {
+		m_vec = _mm512_add_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::operator-=(const vector<std::int32_t, 16> &v) {
+		m_vec = _mm512_sub_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::operator*=(const vector<std::int32_t, 16> &v) {
+		m_vec = _mm512_mullo_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::operator/=(const vector<std::int32_t, 16> &v) {
+		// Doubles represent every 32 bit integer exactly, so dividing in double and truncating is exact
+		auto lo = _mm512_div_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(m_vec)), _mm512_cvtepi32_pd(_mm512_castsi512_si256(v.m_vec)));
+		auto hi = _mm512_div_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(m_vec, 1)), _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(v.m_vec, 1)));
+		m_vec = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(lo)), _mm512_cvttpd_epi32(hi), 1);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::hadd(const vector<std::int32_t, 16> &v) {
+		// Same lane layout as _mm256_hadd_epi32: A1+A2, A3+A4, B1+B2, B3+B4 per 128 bit lane
+		auto even = _mm512_castps_si512(_mm512_shuffle_ps(_mm512_castsi512_ps(m_vec), _mm512_castsi512_ps(v.m_vec), 0b10001000));
+		auto odd = _mm512_castps_si512(_mm512_shuffle_ps(_mm512_castsi512_ps(m_vec), _mm512_castsi512_ps(v.m_vec), 0b11011101));
+		m_vec = _mm512_add_epi32(even, odd);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::hsub(const vector<std::int32_t, 16> &v) {
+		auto even = _mm512_castps_si512(_mm512_shuffle_ps(_mm512_castsi512_ps(m_vec), _mm512_castsi512_ps(v.m_vec), 0b10001000));
+		auto odd = _mm512_castps_si512(_mm512_shuffle_ps(_mm512_castsi512_ps(m_vec), _mm512_castsi512_ps(v.m_vec), 0b11011101));
+		m_vec = _mm512_sub_epi32(even, odd);
+		return *this;
+	}
+
+	std::int32_t vector<std::int32_t, 16>::hadd() const {
+		return _mm512_reduce_add_epi32(m_vec);
+	}
+
+	std::int32_t vector<std::int32_t, 16>::hsub() const {
+		// Every lane with an odd number of set index bits ends up negated in the difference tree
+		return _mm512_reduce_add_epi32(_mm512_mask_sub_epi32(m_vec, 0x6996, _mm512_setzero_si512(), m_vec));
+	}
+
+	vector<std::int32_t, 16> hadd(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return v1.hadd(v2);
+	}
+
+	vector<std::int32_t, 16> hsub(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return v1.hsub(v2);
+	}
+
+	vector<std::int32_t, 16> operator+(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::int32_t, 16> operator-(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::int32_t, 16> operator*(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::int32_t, 16> operator/(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::int32_t, 16> mulhi(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		auto even = _mm512_mul_epi32(v1.m_vec, v2.m_vec);
+		auto odd = _mm512_mul_epi32(_mm512_srli_epi64(v1.m_vec, 32), _mm512_srli_epi64(v2.m_vec, 32));
+		return vector<std::int32_t, 16>(_mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd));
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::operator&=(const vector<std::int32_t, 16> &v) {
+		m_vec = _mm512_and_si512(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::operator|=(const vector<std::int32_t, 16> &v) {
+		m_vec = _mm512_or_si512(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::operator^=(const vector<std::int32_t, 16> &v) {
+		m_vec = _mm512_xor_si512(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> operator~(const vector<std::int32_t, 16> &v) {
+		return vector<std::int32_t, 16>(_mm512_xor_si512(v.m_vec, _mm512_set1_epi32(-1)));
+	}
+
+	vector<std::int32_t, 16> operator&(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::int32_t, 16> operator|(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::int32_t, 16> operator^(vector<std::int32_t, 16> v1, const vector<std::int32_t, 16> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::int32_t, 16> operator<<(const vector<std::int32_t, 16> &v, std::int32_t bits) {
+		return vector<std::int32_t, 16>(_mm512_sll_epi32(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::int32_t, 16> operator>>(const vector<std::int32_t, 16> &v, std::int32_t bits) {
+		return vector<std::int32_t, 16>(_mm512_sra_epi32(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	mask<std::int32_t, 16> operator==(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_cmp_epi32_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_EQ));
+	}
+
+	mask<std::int32_t, 16> operator!=(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_cmp_epi32_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_NE));
+	}
+
+	mask<std::int32_t, 16> operator>(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_cmp_epi32_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_NLE));
+	}
+
+	mask<std::int32_t, 16> operator>=(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_cmp_epi32_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_NLT));
+	}
+
+	mask<std::int32_t, 16> operator<(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_cmp_epi32_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_LT));
+	}
+
+	mask<std::int32_t, 16> operator<=(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_cmp_epi32_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_LE));
+	}
+
+	vector<std::int32_t, 16> &vector<std::int32_t, 16>::abs() {
+		m_vec = _mm512_abs_epi32(m_vec);
+		return *this;
+	}
+
+	vector<std::int32_t, 16> abs(vector<std::int32_t, 16> v) {
+		return v.abs();
+	}
+
+	vector<std::int32_t, 16> min(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return vector<std::int32_t, 16>(_mm512_min_epi32(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int32_t, 16> max(const vector<std::int32_t, 16> &v1, const vector<std::int32_t, 16> &v2) {
+		return vector<std::int32_t, 16>(_mm512_max_epi32(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int32_t, 16> select(const vector<std::int32_t, 16> &v, const vector<std::int32_t, 16> &alt, const mask<std::int32_t, 16> &condition) {
+		return vector<std::int32_t, 16>(_mm512_mask_blend_epi32(condition.native(), alt.m_vec, v.m_vec));
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::int32_t, 16> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::int32_t, 16> operator==(const mask<std::int32_t, 16> &v1, const mask<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_kxnor(v1.m_mask, v2.m_mask));
+	}
+
+	mask<std::int32_t, 16> operator!=(const mask<std::int32_t, 16> &v1, const mask<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_kxor(v1.m_mask, v2.m_mask));
+	}
+
+	mask<std::int32_t, 16> &mask<std::int32_t, 16>::operator&=(const mask<std::int32_t, 16> &v) {
+		m_mask = _mm512_kand(m_mask, v.m_mask);
+		return *this;
+	}
+
+	mask<std::int32_t, 16> &mask<std::int32_t, 16>::operator|=(const mask<std::int32_t, 16> &v) {
+		m_mask = _mm512_kor(m_mask, v.m_mask);
+		return *this;
+	}
+
+	mask<std::int32_t, 16> &mask<std::int32_t, 16>::operator^=(const mask<std::int32_t, 16> &v) {
+		m_mask = _mm512_kxor(m_mask, v.m_mask);
+		return *this;
+	}
+
+	mask<std::int32_t, 16> operator~(const mask<std::int32_t, 16> &v) {
+		return mask<std::int32_t, 16>(_mm512_knot(v.m_mask));
+	}
+
+	mask<std::int32_t, 16> operator&(mask<std::int32_t, 16> v1, const mask<std::int32_t, 16> &v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::int32_t, 16> operator|(mask<std::int32_t, 16> v1, const mask<std::int32_t, 16> &v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::int32_t, 16> operator^(mask<std::int32_t, 16> v1, const mask<std::int32_t, 16> &v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::int32_t, 16> andnot(const mask<std::int32_t, 16> &v1, const mask<std::int32_t, 16> &v2) {
+		return mask<std::int32_t, 16>(_mm512_kandn(v1.m_mask, v2.m_mask));
+	}
+
+	mask<std::int32_t, 16> mask<std::int32_t, 16>::first_n(size_t count) {
+		return mask<std::int32_t, 16>(static_cast<native_type>((1u << (count < width ? count : width)) - 1));
+	}
+
+	int mask<std::int32_t, 16>::get_mask() const {
+		return m_mask;
+	}
+
+	bool mask<std::int32_t, 16>::all() const {
+		return m_mask == 0xFFFF;
+	}
+
+	bool mask<std::int32_t, 16>::any() const {
+		return m_mask != 0;
+	}
+
+	bool mask<std::int32_t, 16>::none() const {
+		return m_mask == 0;
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const mask<std::int32_t, 16> &m) {
+		stream << '(';
+		for (size_t i = 0; i < m.width - 1; ++i) {
+			stream << m[i] << ' ';
+		}
+		stream << m[m.width - 1] << ')';
+		return stream;
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
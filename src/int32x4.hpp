@@ -7,10 +7,9 @@
 #include "simd.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 #if SIMD_SUPPORTS(SIMD_SSE2)
-	using int32x4 = vector<std::int32_t, 4>;
-
 	template <>
 	class vector<std::int32_t, 4> : public vector_base<std::int32_t, 4> {
 	public:
@@ -27,54 +26,66 @@ namespace simd {
 		explicit vector(const type *vals) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(vals))) {}
 #endif // SIMD_SUPPORTS(SIMD_SSE3)
 		explicit vector(const type *vals, aligned_load) : vector_base(_mm_load_si128(reinterpret_cast<const native_type *>(vals))) {}
-		explicit vector(const vector<float, 4> &v);
-		explicit vector(const vector<double, 2> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<float, 4> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<double, 2> &v);
 #if SIMD_SUPPORTS(SIMD_AVX)
-		explicit vector(const vector<double, 4> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<double, 4> &v);
 #endif // SIMD_SUPPORTS(SIMD_AVX)
 
-		vector<std::int32_t, 4> &operator+=(const vector<std::int32_t, 4> &v);
-		vector<std::int32_t, 4> &operator-=(const vector<std::int32_t, 4> &v);
-		vector<std::int32_t, 4> &operator*=(const vector<std::int32_t, 4> &v);
-		vector<std::int32_t, 4> &operator/=(const vector<std::int32_t, 4> &v);
-		friend vector<std::int32_t, 4> operator+(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator-(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator*(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator/(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-
-		vector<std::int32_t, 4> &operator&=(const vector<std::int32_t, 4> &v);
-		vector<std::int32_t, 4> &operator|=(const vector<std::int32_t, 4> &v);
-		vector<std::int32_t, 4> &operator^=(const vector<std::int32_t, 4> &v);
-		friend vector<std::int32_t, 4> operator~(const vector<std::int32_t, 4> &v);
-		friend vector<std::int32_t, 4> operator&(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator|(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator^(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-
-		friend vector<std::int32_t, 4> operator<<(const vector<std::int32_t, 4> &v, std::int32_t bits);
-		friend vector<std::int32_t, 4> operator>>(const vector<std::int32_t, 4> &v, std::int32_t bits);
-
-		friend vector<std::int32_t, 4> operator==(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator!=(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator>(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator>=(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator<(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> operator<=(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
-
-		vector<std::int32_t, 4> &hadd(const vector<std::int32_t, 4> &v);
-		vector<std::int32_t, 4> &hsub(const vector<std::int32_t, 4> &v);
-		type hadd() const;
-		type hsub() const;
-		friend vector<std::int32_t, 4> hadd(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> hsub(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
-
-		vector<std::int32_t, 4> &abs();
-		friend vector<std::int32_t, 4> abs(vector<std::int32_t, 4> v);
-		friend vector<std::int32_t, 4> min(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
-		friend vector<std::int32_t, 4> max(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
-
-		friend vector<std::int32_t, 4> select(const vector<std::int32_t, 4> &v, const vector<std::int32_t, 4> &alt, const mask<std::int32_t, 4> &condition);
-
-		friend std::ostream &operator<<(std::ostream &stream, const vector<std::int32_t, 4> &v);
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &operator+=(const vector<std::int32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &operator-=(const vector<std::int32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &operator*=(const vector<std::int32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &operator/=(const vector<std::int32_t, 4> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator+(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator-(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator*(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator/(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+		// High 32 bits of the 64 bit products
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> mulhi(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+		// Full 64 bit products of the even and the odd lanes respectively, see conversion.hpp
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> mul_even(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> mul_odd(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &operator&=(const vector<std::int32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &operator|=(const vector<std::int32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &operator^=(const vector<std::int32_t, 4> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator~(const vector<std::int32_t, 4> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator&(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator|(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator^(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator<<(const vector<std::int32_t, 4> &v, std::int32_t bits);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator>>(const vector<std::int32_t, 4> &v, std::int32_t bits);
+
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator==(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator!=(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator>(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator>=(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator<(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> operator<=(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &hadd(const vector<std::int32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &hsub(const vector<std::int32_t, 4> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> hadd(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> hsub(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 4> &abs();
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> abs(vector<std::int32_t, 4> v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> min(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> max(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int32_t, 4> select(const vector<std::int32_t, 4> &v, const vector<std::int32_t, 4> &alt, const mask<std::int32_t, 4> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::int32_t, 4> &v);
 	};
 
 	template <>
@@ -85,8 +96,9 @@ namespace simd {
 		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_set1_epi32(-static_cast<int>(b))) {}
 		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4) : vector_base(_mm_set_epi32(
 			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1))) {}
-		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[3], arr[2], arr[1], arr[0]) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3]) {}
 		explicit SIMD_FORCEINLINE mask(const vector<std::int32_t, 4> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::int32_t, 4> first_n(size_t count);
 
 		friend SIMD_FORCEINLINE mask<std::int32_t, 4> operator==(const mask<std::int32_t, 4> & v1, const mask<std::int32_t, 4> & v2);
 		friend SIMD_FORCEINLINE mask<std::int32_t, 4> operator!=(const mask<std::int32_t, 4> & v1, const mask<std::int32_t, 4> & v2);
@@ -107,6 +119,36 @@ namespace simd {
 		SIMD_FORCEINLINE bool none() const;
 	};
 
+	void vector<std::int32_t, 4>::store(type *vals) const {
+		_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int32_t, 4>::store(type *vals, aligned_store) const {
+		_mm_store_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int32_t, 4>::stream(type *vals) const {
+		_mm_stream_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int32_t, 4>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		switch(count) {
+		case 4:
+			_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+			break;
+		case 3:
+			vals[2] = _mm_cvtsi128_si32(_mm_shuffle_epi32(m_vec, 0b00000010));
+			[[fallthrough]];
+		case 2:
+			_mm_storel_epi64(reinterpret_cast<native_type *>(vals), m_vec);
+			break;
+		case 1:
+			vals[0] = _mm_cvtsi128_si32(m_vec);
+			break;
+		}
+	}
+
 	vector<std::int32_t, 4> &vector<std::int32_t, 4>::operator+=(const vector<std::int32_t, 4> &v) {
 		m_vec = _mm_add_epi32(m_vec, v.m_vec);
 		return *this;
@@ -119,52 +161,68 @@ namespace simd {
 
 	vector<std::int32_t, 4> &vector<std::int32_t, 4>::operator*=(const vector<std::int32_t, 4> &v) {
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
-		m_vec = _mm_mul_epi32(m_vec, v.m_vec);
+		m_vec = _mm_mullo_epi32(m_vec, v.m_vec);
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
+		// Multiply the even and the odd lanes into 64 bit and keep the low halves
+		auto even = _mm_mul_epu32(m_vec, v.m_vec);
+		auto odd = _mm_mul_epu32(_mm_srli_epi64(m_vec, 32), _mm_srli_epi64(v.m_vec, 32));
+		m_vec = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0b00001000), _mm_shuffle_epi32(odd, 0b00001000));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 		return *this;
 	}
 
 	vector<std::int32_t, 4> &vector<std::int32_t, 4>::operator/=(const vector<std::int32_t, 4> &v) {
-		// TODO: there's gotta be a better way
-		m_vec = _mm_cvtps_epi32(_mm_div_ps(_mm_cvtepi32_ps(m_vec), _mm_cvtepi32_ps(v.m_vec)));
+		// Doubles represent every 32 bit integer exactly, so dividing in double and truncating is exact
+#if SIMD_SUPPORTS(SIMD_AVX)
+		m_vec = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(m_vec), _mm256_cvtepi32_pd(v.m_vec)));
+#else // SIMD_SUPPORTS(SIMD_AVX)
+		auto lo = _mm_div_pd(_mm_cvtepi32_pd(m_vec), _mm_cvtepi32_pd(v.m_vec));
+		auto hi = _mm_div_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(m_vec, 0b00001110)), _mm_cvtepi32_pd(_mm_shuffle_epi32(v.m_vec, 0b00001110)));
+		m_vec = _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+#endif // SIMD_SUPPORTS(SIMD_AVX)
 		return *this;
 	}
 
 	vector<std::int32_t, 4> &vector<std::int32_t, 4>::hadd(const vector<std::int32_t, 4> &v) {
-#if SIMD_SUPPORTS(SIMD_SSE3)
+#if SIMD_SUPPORTS(SIMD_SSSE3)
 		m_vec = _mm_hadd_epi32(m_vec, v.m_vec);
-#else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE3)
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
+		// Gather the even and odd lanes of both vectors and combine them
+		auto even = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(m_vec), _mm_castsi128_ps(v.m_vec), 0b10001000));
+		auto odd = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(m_vec), _mm_castsi128_ps(v.m_vec), 0b11011101));
+		m_vec = _mm_add_epi32(even, odd);
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
 		return *this;
 	}
 
 	vector<std::int32_t, 4> &vector<std::int32_t, 4>::hsub(const vector<std::int32_t, 4> &v) {
-#if SIMD_SUPPORTS(SIMD_SSE3)
+#if SIMD_SUPPORTS(SIMD_SSSE3)
 		m_vec = _mm_hsub_epi32(m_vec, v.m_vec);
-#else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE3)
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
+		auto even = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(m_vec), _mm_castsi128_ps(v.m_vec), 0b10001000));
+		auto odd = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(m_vec), _mm_castsi128_ps(v.m_vec), 0b11011101));
+		m_vec = _mm_sub_epi32(even, odd);
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
 		return *this;
 	}
 
 	std::int32_t vector<std::int32_t, 4>::hadd() const {
-#if SIMD_SUPPORTS(SIMD_SSE3)
+#if SIMD_SUPPORTS(SIMD_SSSE3)
 		auto t1 = _mm_hadd_epi32(m_vec, m_vec);
 		return _mm_cvtsi128_si32(_mm_hadd_epi32(t1, t1));
-#else // SIMD_SUPPORTS(SIMD_SSE3)
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
 		// Compute A1+A3, A2+A4, ...
 		auto t1 = _mm_add_epi32(m_vec, _mm_shuffle_epi32(m_vec, 0b00001011));
 		// Compute A1+A2 w. shuffle
 		auto t2 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, 0b00000001));
 		return _mm_cvtsi128_si32(t2);
-#endif // SIMD_SUPPORTS(SIMD_SSE3)
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
 	}
 
 	std::int32_t vector<std::int32_t, 4>::hsub() const {
-		throw std::runtime_error("Operation not implemented");
+		// (A1-A2)-(A3-A4) == A1-A2-A3+A4, so negate A2 and A3 and sum up
+		auto negate = _mm_set_epi32(0, -1, -1, 0);
+		return vector<std::int32_t, 4>(_mm_sub_epi32(_mm_xor_si128(m_vec, negate), negate)).hadd();
 	}
 
 	vector<std::int32_t, 4> hadd(vector<std::int32_t, 4> v1, const vector<std::int32_t, 4> &v2) {
@@ -191,6 +249,22 @@ namespace simd {
 		return (v1 /= v2);
 	}
 
+	vector<std::int32_t, 4> mulhi(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		auto even = _mm_mul_epi32(v1.m_vec, v2.m_vec);
+		auto odd = _mm_mul_epi32(_mm_srli_epi64(v1.m_vec, 32), _mm_srli_epi64(v2.m_vec, 32));
+		return vector<std::int32_t, 4>(_mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0b11001100));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// Unsigned products, corrected by subtracting the other operand for each negative one
+		auto even = _mm_mul_epu32(v1.m_vec, v2.m_vec);
+		auto odd = _mm_mul_epu32(_mm_srli_epi64(v1.m_vec, 32), _mm_srli_epi64(v2.m_vec, 32));
+		auto hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0b00001101), _mm_shuffle_epi32(odd, 0b00001101));
+		auto correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(v1.m_vec, 31), v2.m_vec),
+										_mm_and_si128(_mm_srai_epi32(v2.m_vec, 31), v1.m_vec));
+		return vector<std::int32_t, 4>(_mm_sub_epi32(hi, correction));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
 	vector<std::int32_t, 4> &vector<std::int32_t, 4>::operator&=(const vector<std::int32_t, 4> &v) {
 		m_vec = _mm_and_si128(m_vec, v.m_vec);
 		return *this;
@@ -227,7 +301,7 @@ namespace simd {
 	}
 
 	vector<std::int32_t, 4> operator>>(const vector<std::int32_t, 4> &v, std::int32_t bits) {
-		return vector<std::int32_t, 4>(_mm_slli_epi32(v.m_vec, bits));
+		return vector<std::int32_t, 4>(_mm_sra_epi32(v.m_vec, _mm_cvtsi32_si128(bits)));
 	}
 
 	vector<std::int32_t, 4> operator==(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2) {
@@ -258,11 +332,12 @@ namespace simd {
 	}
 
 	vector<std::int32_t, 4> &vector<std::int32_t, 4>::abs() {
-#if SIMD_SUPPORTS(SIMD_SSE3)
+#if SIMD_SUPPORTS(SIMD_SSSE3)
 		m_vec = _mm_abs_epi32(m_vec);
-#else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE3)
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
+		auto sign = _mm_srai_epi32(m_vec, 31);
+		m_vec = _mm_sub_epi32(_mm_xor_si128(m_vec, sign), sign);
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
 		return *this;
 	}
 
@@ -271,27 +346,31 @@ namespace simd {
 	}
 
 	vector<std::int32_t, 4> min(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2) {
-#if SIMD_SUPPORTS(SIMD_SSE3)
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
 		return vector<std::int32_t, 4>(_mm_min_epi32(v1.m_vec, v2.m_vec));
-#else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE3)
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		auto gt = _mm_cmpgt_epi32(v1.m_vec, v2.m_vec);
+		return vector<std::int32_t, 4>(_mm_or_si128(_mm_and_si128(gt, v2.m_vec), _mm_andnot_si128(gt, v1.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 	}
 
 	vector<std::int32_t, 4> max(const vector<std::int32_t, 4> &v1, const vector<std::int32_t, 4> &v2) {
-#if SIMD_SUPPORTS(SIMD_SSE3)
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
 		return vector<std::int32_t, 4>(_mm_max_epi32(v1.m_vec, v2.m_vec));
-#else // SIMD_SUPPORTS(SIMD_SSE3)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE3)
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		auto gt = _mm_cmpgt_epi32(v1.m_vec, v2.m_vec);
+		return vector<std::int32_t, 4>(_mm_or_si128(_mm_and_si128(gt, v1.m_vec), _mm_andnot_si128(gt, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 	}
 
 	vector<std::int32_t, 4> select(const vector<std::int32_t, 4> &v, const vector<std::int32_t, 4> &alt, const mask<std::int32_t, 4> &condition) {
-		// TODO: this only works when mask is either 0 or -1 (because it's byte-wise)
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
-		return vector<std::int32_t, 4>(_mm_blendv_epi8(alt.m_vec, v.m_vec, condition.native()));
+		// The float blend picks whole lanes by their sign bits, unlike the byte-wise integer blend
+		return vector<std::int32_t, 4>(_mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(alt.m_vec), _mm_castsi128_ps(v.m_vec), _mm_castsi128_ps(condition.native()))));
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		return vector<std::int32_t, 4>(_mm_or_si128(_mm_and_si128(v.m_vec, condition.native()), _mm_andnot_si128(alt.m_vec, condition.native())));
+		// Only the sign bits count like for blendv, so spread them over their lanes
+		const auto sign = _mm_srai_epi32(condition.native(), 31);
+		return vector<std::int32_t, 4>(_mm_or_si128(_mm_and_si128(v.m_vec, sign), _mm_andnot_si128(sign, alt.m_vec)));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 	}
 
@@ -348,6 +427,11 @@ namespace simd {
 		return mask<std::int32_t, 4>(_mm_andnot_si128(v1.m_vec, v2.m_vec));
 	}
 
+	mask<std::int32_t, 4> mask<std::int32_t, 4>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<std::int32_t, 4>(_mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 1, 2, 3)));
+	}
+
 	int mask<std::int32_t, 4>::get_mask() const {
 		return _mm_movemask_epi8(m_vec);
 	}
@@ -367,4 +451,5 @@ namespace simd {
 
 #endif // SIMD_SUPPORTS(SIMD_SSE2)
 
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -7,11 +7,10 @@
 #include "simd.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 // Theoretically there is some support for this in AVX, but all the useful operations like +/- are in AVX2 only
 #if SIMD_SUPPORTS(SIMD_AVX2)
-	using int32x8 = vector<std::int32_t, 8>;
-
 	template <>
 	class vector<std::int32_t, 8> : public vector_base<std::int32_t, 8> {
 	public:
@@ -27,50 +26,62 @@ namespace simd {
 																						   arr[3], arr[2], arr[1], arr[0])) {}
 		explicit vector(const type *vals) : vector_base(_mm256_lddqu_si256(reinterpret_cast<const native_type *>(vals))) {}
 		explicit vector(const type *vals, aligned_load) : vector_base(_mm256_load_si256(reinterpret_cast<const native_type *>(vals))) {}
-		explicit vector(const vector<float, 8> &v);
-
-		vector<std::int32_t, 8> &operator+=(const vector<std::int32_t, 8> &v);
-		vector<std::int32_t, 8> &operator-=(const vector<std::int32_t, 8> &v);
-		vector<std::int32_t, 8> &operator*=(const vector<std::int32_t, 8> &v);
-		vector<std::int32_t, 8> &operator/=(const vector<std::int32_t, 8> &v);
-		friend vector<std::int32_t, 8> operator+(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator-(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator*(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator/(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-
-		vector<std::int32_t, 8> &operator&=(const vector<std::int32_t, 8> &v);
-		vector<std::int32_t, 8> &operator|=(const vector<std::int32_t, 8> &v);
-		vector<std::int32_t, 8> &operator^=(const vector<std::int32_t, 8> &v);
-		friend vector<std::int32_t, 8> operator~(const vector<std::int32_t, 8> &v);
-		friend vector<std::int32_t, 8> operator&(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator|(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator^(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-
-		friend vector<std::int32_t, 8> operator<<(const vector<std::int32_t, 8> &v, std::int32_t bits);
-		friend vector<std::int32_t, 8> operator>>(const vector<std::int32_t, 8> &v, std::int32_t bits);
-
-		friend vector<std::int32_t, 8> operator==(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator!=(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator>(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator>=(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator<(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> operator<=(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
-
-		vector<std::int32_t, 8> &hadd(const vector<std::int32_t, 8> &v);
-		vector<std::int32_t, 8> &hsub(const vector<std::int32_t, 8> &v);
-		type hadd() const;
-		type hsub() const;
-		friend vector<std::int32_t, 8> hadd(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> hsub(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
-
-		vector<std::int32_t, 8> &abs();
-		friend vector<std::int32_t, 8> abs(vector<std::int32_t, 8> v);
-		friend vector<std::int32_t, 8> min(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
-		friend vector<std::int32_t, 8> max(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
-
-		friend vector<std::int32_t, 8> select(const vector<std::int32_t, 8> &v, const vector<std::int32_t, 8> &alt, const mask<std::int32_t, 8> &condition);
-
-		friend std::ostream &operator<<(std::ostream &stream, const vector<std::int32_t, 8> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<float, 8> &v);
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &operator+=(const vector<std::int32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &operator-=(const vector<std::int32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &operator*=(const vector<std::int32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &operator/=(const vector<std::int32_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator+(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator-(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator*(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator/(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+		// High 32 bits of the 64 bit products
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> mulhi(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+		// Full 64 bit products of the even and the odd lanes respectively, see conversion.hpp
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> mul_even(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> mul_odd(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &operator&=(const vector<std::int32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &operator|=(const vector<std::int32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &operator^=(const vector<std::int32_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator~(const vector<std::int32_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator&(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator|(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator^(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator<<(const vector<std::int32_t, 8> &v, std::int32_t bits);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator>>(const vector<std::int32_t, 8> &v, std::int32_t bits);
+
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator==(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator!=(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator>(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator>=(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator<(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> operator<=(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &hadd(const vector<std::int32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &hsub(const vector<std::int32_t, 8> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> hadd(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> hsub(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::int32_t, 8> &abs();
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> abs(vector<std::int32_t, 8> v);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> min(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> max(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int32_t, 8> select(const vector<std::int32_t, 8> &v, const vector<std::int32_t, 8> &alt, const mask<std::int32_t, 8> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::int32_t, 8> &v);
 	};
 
 	template <>
@@ -82,8 +93,9 @@ namespace simd {
 		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7, bool b8) : vector_base(_mm256_set_epi32(
 			-static_cast<int>(b8), -static_cast<int>(b7), -static_cast<int>(b6), -static_cast<int>(b5),
 			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1))) {}
-		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[7], arr[6], arr[5], arr[4], arr[3], arr[2], arr[1], arr[0]) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3], arr[4], arr[5], arr[6], arr[7]) {}
 		explicit SIMD_FORCEINLINE mask(const vector<std::int32_t, 8> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::int32_t, 8> first_n(size_t count);
 
 		friend SIMD_FORCEINLINE mask<std::int32_t, 8> operator==(const mask<std::int32_t, 8> & v1, const mask<std::int32_t, 8> & v2);
 		friend SIMD_FORCEINLINE mask<std::int32_t, 8> operator!=(const mask<std::int32_t, 8> & v1, const mask<std::int32_t, 8> & v2);
@@ -104,6 +116,24 @@ namespace simd {
 		SIMD_FORCEINLINE bool none() const;
 	};
 
+	void vector<std::int32_t, 8>::store(type *vals) const {
+		_mm256_storeu_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int32_t, 8>::store(type *vals, aligned_store) const {
+		_mm256_store_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int32_t, 8>::stream(type *vals) const {
+		_mm256_stream_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int32_t, 8>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		const auto tail = _mm256_loadu_si256(reinterpret_cast<const native_type *>(detail::tail_mask_table + 8 - count));
+		_mm256_maskstore_epi32(reinterpret_cast<int *>(vals), tail, m_vec);
+	}
+
 	vector<std::int32_t, 8> &vector<std::int32_t, 8>::operator+=(const vector<std::int32_t, 8> &v) {
 		m_vec = _mm256_add_epi32(m_vec, v.m_vec);
 		return *this;
@@ -115,13 +145,15 @@ namespace simd {
 	}
 
 	vector<std::int32_t, 8> &vector<std::int32_t, 8>::operator*=(const vector<std::int32_t, 8> &v) {
-		m_vec = _mm256_mul_epi32(m_vec, v.m_vec);
+		m_vec = _mm256_mullo_epi32(m_vec, v.m_vec);
 		return *this;
 	}
 
 	vector<std::int32_t, 8> &vector<std::int32_t, 8>::operator/=(const vector<std::int32_t, 8> &v) {
-		// TODO: there's gotta be a better way
-		m_vec = _mm256_cvtps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(m_vec), _mm256_cvtepi32_ps(v.m_vec)));
+		// Doubles represent every 32 bit integer exactly, so dividing in double and truncating is exact
+		auto lo = _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(m_vec)), _mm256_cvtepi32_pd(_mm256_castsi256_si128(v.m_vec)));
+		auto hi = _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(m_vec, 1)), _mm256_cvtepi32_pd(_mm256_extracti128_si256(v.m_vec, 1)));
+		m_vec = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(lo)), _mm256_cvttpd_epi32(hi), 1);
 		return *this;
 	}
 
@@ -152,7 +184,11 @@ namespace simd {
 	}
 
 	std::int32_t vector<std::int32_t, 8>::hsub() const {
-		throw std::runtime_error("Operation not implemented");
+		// Results in A1-A2, A3-A4, ..., ..., A5-A6, A7-A8
+		auto t1 = _mm256_hsub_epi32(m_vec, m_vec);
+		// (A1-A2)-(A3-A4) and (A5-A6)-(A7-A8) in the first entry of each half
+		auto t2 = _mm256_hsub_epi32(t1, t1);
+		return _mm_cvtsi128_si32(_mm_sub_epi32(_mm256_castsi256_si128(t2), _mm256_extracti128_si256(t2, 1)));
 	}
 
 	vector<std::int32_t, 8> hadd(vector<std::int32_t, 8> v1, const vector<std::int32_t, 8> &v2) {
@@ -179,6 +215,12 @@ namespace simd {
 		return (v1 /= v2);
 	}
 
+	vector<std::int32_t, 8> mulhi(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2) {
+		auto even = _mm256_mul_epi32(v1.m_vec, v2.m_vec);
+		auto odd = _mm256_mul_epi32(_mm256_srli_epi64(v1.m_vec, 32), _mm256_srli_epi64(v2.m_vec, 32));
+		return vector<std::int32_t, 8>(_mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010));
+	}
+
 	vector<std::int32_t, 8> &vector<std::int32_t, 8>::operator&=(const vector<std::int32_t, 8> &v) {
 		m_vec = _mm256_and_si256(m_vec, v.m_vec);
 		return *this;
@@ -215,7 +257,7 @@ namespace simd {
 	}
 
 	vector<std::int32_t, 8> operator>>(const vector<std::int32_t, 8> &v, std::int32_t bits) {
-		return vector<std::int32_t, 8>(_mm256_slli_epi32(v.m_vec, bits));
+		return vector<std::int32_t, 8>(_mm256_sra_epi32(v.m_vec, _mm_cvtsi32_si128(bits)));
 	}
 
 	vector<std::int32_t, 8> operator==(const vector<std::int32_t, 8> &v1, const vector<std::int32_t, 8> &v2) {
@@ -323,6 +365,11 @@ namespace simd {
 		return mask<std::int32_t, 8>(_mm256_andnot_si256(v1.m_vec, v2.m_vec));
 	}
 
+	mask<std::int32_t, 8> mask<std::int32_t, 8>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<std::int32_t, 8>(_mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+	}
+
 	int mask<std::int32_t, 8>::get_mask() const {
 		return _mm256_movemask_epi8(m_vec);
 	}
@@ -342,4 +389,5 @@ namespace simd {
 
 #endif // SIMD_SUPPORTS(SIMD_AVX2)
 
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -1,14 +1,41 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <exception>
 #include "base_types.hpp"
 #include "simd.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 #if SIMD_SUPPORTS(SIMD_SSE2)
-	using int64x2 = vector<std::int64_t, 2>;
+	namespace detail {
+		inline __m128i cmpeq_epi64(__m128i a, __m128i b) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+			return _mm_cmpeq_epi64(a, b);
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+			// Both 32 bit halves have to match
+			auto eq = _mm_cmpeq_epi32(a, b);
+			return _mm_and_si128(eq, _mm_shuffle_epi32(eq, 0b10110001));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		}
+
+		inline __m128i cmpgt_epi64(__m128i a, __m128i b) {
+#if SIMD_SUPPORTS(SIMD_SSE4_2)
+			return _mm_cmpgt_epi64(a, b);
+#else // SIMD_SUPPORTS(SIMD_SSE4_2)
+			// Signed compare of the high halves, unsigned compare (via flipped sign bits) of the low halves
+			// if the high halves are equal. The result ends up in the high half and is copied to the low one.
+			auto flip = _mm_set1_epi64x(0x80000000);
+			auto gt = _mm_cmpgt_epi32(a, b);
+			auto lo_gt = _mm_cmpgt_epi32(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+			auto eq = _mm_cmpeq_epi32(a, b);
+			auto res = _mm_or_si128(gt, _mm_and_si128(eq, _mm_slli_epi64(lo_gt, 32)));
+			return _mm_shuffle_epi32(res, 0b11110101);
+#endif // SIMD_SUPPORTS(SIMD_SSE4_2)
+		}
+	} // namespace detail
 
 	template <>
 	class vector<std::int64_t, 2> : public vector_base<std::int64_t, 2> {
@@ -32,48 +59,57 @@ namespace simd {
 		//explicit vector(const vector<double, 4> &v);
 #endif // SIMD_SUPPORTS(SIMD_AVX)
 
-		vector<std::int64_t, 2> &operator+=(const vector<std::int64_t, 2> &v);
-		vector<std::int64_t, 2> &operator-=(const vector<std::int64_t, 2> &v);
-		vector<std::int64_t, 2> &operator*=(const vector<std::int64_t, 2> &v);
-		vector<std::int64_t, 2> &operator/=(const vector<std::int64_t, 2> &v);
-		friend vector<std::int64_t, 2> operator+(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator-(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator*(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator/(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-
-		vector<std::int64_t, 2> &operator&=(const vector<std::int64_t, 2> &v);
-		vector<std::int64_t, 2> &operator|=(const vector<std::int64_t, 2> &v);
-		vector<std::int64_t, 2> &operator^=(const vector<std::int64_t, 2> &v);
-		friend vector<std::int64_t, 2> operator~(const vector<std::int64_t, 2> &v);
-		friend vector<std::int64_t, 2> operator&(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator|(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator^(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-
-		friend vector<std::int64_t, 2> operator<<(const vector<std::int64_t, 2> &v, int bits);
-		friend vector<std::int64_t, 2> operator>>(const vector<std::int64_t, 2> &v, int bits);
-
-		friend vector<std::int64_t, 2> operator==(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator!=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator>(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator>=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator<(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> operator<=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
-
-		vector<std::int64_t, 2> &hadd(const vector<std::int64_t, 2> &v);
-		vector<std::int64_t, 2> &hsub(const vector<std::int64_t, 2> &v);
-		type hadd() const;
-		type hsub() const;
-		friend vector<std::int64_t, 2> hadd(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> hsub(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
-
-		vector<std::int64_t, 2> &abs();
-		friend vector<std::int64_t, 2> abs(vector<std::int64_t, 2> v);
-		friend vector<std::int64_t, 2> min(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
-		friend vector<std::int64_t, 2> max(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
-
-		friend vector<std::int64_t, 2> select(const vector<std::int64_t, 2> &v, const vector<std::int64_t, 2> &alt, const mask<std::int64_t, 2> &condition);
-
-		friend std::ostream &operator<<(std::ostream &stream, const vector<std::int64_t, 2> &v);
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &operator+=(const vector<std::int64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &operator-=(const vector<std::int64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &operator*=(const vector<std::int64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &operator/=(const vector<std::int64_t, 2> &v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator+(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator-(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator*(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator/(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+		// High 64 bits of the 128 bit products
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> mulhi(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &operator&=(const vector<std::int64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &operator|=(const vector<std::int64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &operator^=(const vector<std::int64_t, 2> &v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator~(const vector<std::int64_t, 2> &v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator&(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator|(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator^(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator<<(const vector<std::int64_t, 2> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator>>(const vector<std::int64_t, 2> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator==(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator!=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator>(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator>=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator<(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> operator<=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &hadd(const vector<std::int64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &hsub(const vector<std::int64_t, 2> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> hadd(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> hsub(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 2> &abs();
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> abs(vector<std::int64_t, 2> v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> min(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> max(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int64_t, 2> select(const vector<std::int64_t, 2> &v, const vector<std::int64_t, 2> &alt, const mask<std::int64_t, 2> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::int64_t, 2> &v);
 	};
 
 	template <>
@@ -83,8 +119,9 @@ namespace simd {
 		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
 		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_set1_epi64x(-static_cast<int>(b))) {}
 		explicit SIMD_FORCEINLINE mask(bool b1, bool b2) : vector_base(_mm_set_epi64x(-static_cast<int>(b2), -static_cast<int>(b1))) {}
-		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[1], arr[0]) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1]) {}
 		explicit SIMD_FORCEINLINE mask(const vector<std::int64_t, 2> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::int64_t, 2> first_n(size_t count);
 
 		friend SIMD_FORCEINLINE mask<std::int64_t, 2> operator==(const mask<std::int64_t, 2> & v1, const mask<std::int64_t, 2> & v2);
 		friend SIMD_FORCEINLINE mask<std::int64_t, 2> operator!=(const mask<std::int64_t, 2> & v1, const mask<std::int64_t, 2> & v2);
@@ -105,6 +142,30 @@ namespace simd {
 		SIMD_FORCEINLINE bool none() const;
 	};
 
+	void vector<std::int64_t, 2>::store(type *vals) const {
+		_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int64_t, 2>::store(type *vals, aligned_store) const {
+		_mm_store_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int64_t, 2>::stream(type *vals) const {
+		_mm_stream_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int64_t, 2>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		switch(count) {
+		case 2:
+			_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+			break;
+		case 1:
+			_mm_storel_epi64(reinterpret_cast<native_type *>(vals), m_vec);
+			break;
+		}
+	}
+
 	vector<std::int64_t, 2> &vector<std::int64_t, 2>::operator+=(const vector<std::int64_t, 2> &v) {
 		m_vec = _mm_add_epi64(m_vec, v.m_vec);
 		return *this;
@@ -116,39 +177,41 @@ namespace simd {
 	}
 
 	vector<std::int64_t, 2> &vector<std::int64_t, 2>::operator*=(const vector<std::int64_t, 2> &v) {
-		// TODO: there's gotta be a better way
-		// TODO: AVX 512
-		throw std::runtime_error("Operation not implemented");
-		//m_vec = _mm_cvtpd_epi64(_mm_mul_pd(_mm_cvtepi64_pd(m_vec), _mm_cvtepi64_pd(v.m_vec)));
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		m_vec = _mm_mullo_epi64(m_vec, v.m_vec);
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		// Low 64 bits of the product: lo*lo + ((lo*hi + hi*lo) << 32)
+		auto lo = _mm_mul_epu32(m_vec, v.m_vec);
+		auto cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(m_vec, 32), v.m_vec),
+								   _mm_mul_epu32(m_vec, _mm_srli_epi64(v.m_vec, 32)));
+		m_vec = _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
 		return *this;
 	}
 
 	vector<std::int64_t, 2> &vector<std::int64_t, 2>::operator/=(const vector<std::int64_t, 2> &v) {
-		// TODO: there's gotta be a better way
-		// TODO: AVX 512
-		throw std::runtime_error("Operation not implemented");
-		//m_vec = _mm_cvtps_epi64(_mm_div_ps(_mm_cvtepi32_ps(m_vec), _mm_cvtepi32_ps(v.m_vec)));
+		// There is no 64 bit integer division instruction and doubles cannot represent every operand exactly
+		for(size_t i = 0; i < width; ++i)
+			m_array[i] /= v.m_array[i];
 		return *this;
 	}
 
 	vector<std::int64_t, 2> &vector<std::int64_t, 2>::hadd(const vector<std::int64_t, 2> &v) {
-		throw std::runtime_error("Operation not implemented");
+		m_vec = _mm_add_epi64(_mm_unpacklo_epi64(m_vec, v.m_vec), _mm_unpackhi_epi64(m_vec, v.m_vec));
 		return *this;
 	}
 
 	vector<std::int64_t, 2> &vector<std::int64_t, 2>::hsub(const vector<std::int64_t, 2> &v) {
-		throw std::runtime_error("Operation not implemented");
+		m_vec = _mm_sub_epi64(_mm_unpacklo_epi64(m_vec, v.m_vec), _mm_unpackhi_epi64(m_vec, v.m_vec));
 		return *this;
 	}
 
 	std::int64_t vector<std::int64_t, 2>::hadd() const {
-		// Shuffle 32 bits due to lack of native intrinsic
-		return _mm_cvtsi128_si64(_mm_add_epi64(m_vec, _mm_shuffle_epi32(m_vec, 0b00001011)));
+		return _mm_cvtsi128_si64(_mm_add_epi64(m_vec, _mm_unpackhi_epi64(m_vec, m_vec)));
 	}
 
 	std::int64_t vector<std::int64_t, 2>::hsub() const {
-		// Shuffle 32 bits due to lack of native intrinsic
-		return _mm_cvtsi128_si64(_mm_sub_epi64(m_vec, _mm_shuffle_epi32(m_vec, 0b00001011)));
+		return _mm_cvtsi128_si64(_mm_sub_epi64(m_vec, _mm_unpackhi_epi64(m_vec, m_vec)));
 	}
 
 	vector<std::int64_t, 2> hadd(vector<std::int64_t, 2> v1, const vector<std::int64_t, 2> &v2) {
@@ -175,6 +238,20 @@ namespace simd {
 		return (v1 /= v2);
 	}
 
+	vector<std::int64_t, 2> mulhi(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
+		// Unsigned product from the 32 bit partial products, corrected by subtracting the other operand for each negative one
+		auto hi1 = _mm_srli_epi64(v1.m_vec, 32);
+		auto hi2 = _mm_srli_epi64(v2.m_vec, 32);
+		auto lo_lo = _mm_mul_epu32(v1.m_vec, v2.m_vec);
+		auto t = _mm_add_epi64(_mm_mul_epu32(hi1, v2.m_vec), _mm_srli_epi64(lo_lo, 32));
+		auto w = _mm_add_epi64(_mm_mul_epu32(v1.m_vec, hi2), _mm_and_si128(t, _mm_set1_epi64x(0xFFFFFFFF)));
+		auto hi = _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(hi1, hi2), _mm_srli_epi64(t, 32)), _mm_srli_epi64(w, 32));
+		auto sign1 = _mm_shuffle_epi32(_mm_srai_epi32(v1.m_vec, 31), 0b11110101);
+		auto sign2 = _mm_shuffle_epi32(_mm_srai_epi32(v2.m_vec, 31), 0b11110101);
+		auto correction = _mm_add_epi64(_mm_and_si128(sign1, v2.m_vec), _mm_and_si128(sign2, v1.m_vec));
+		return vector<std::int64_t, 2>(_mm_sub_epi64(hi, correction));
+	}
+
 	vector<std::int64_t, 2> &vector<std::int64_t, 2>::operator&=(const vector<std::int64_t, 2> &v) {
 		m_vec = _mm_and_si128(m_vec, v.m_vec);
 		return *this;
@@ -211,65 +288,52 @@ namespace simd {
 	}
 
 	vector<std::int64_t, 2> operator>>(const vector<std::int64_t, 2> &v, int bits) {
-		return vector<std::int64_t, 2>(_mm_slli_epi64(v.m_vec, bits));
+		auto count = _mm_cvtsi32_si128(bits);
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::int64_t, 2>(_mm_sra_epi64(v.m_vec, count));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		// Shift logically and sign extend from the shifted sign bit m via (x ^ m) - m
+		auto m = _mm_srl_epi64(_mm_set1_epi64x(INT64_MIN), count);
+		return vector<std::int64_t, 2>(_mm_sub_epi64(_mm_xor_si128(_mm_srl_epi64(v.m_vec, count), m), m));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
 	}
 
 	vector<std::int64_t, 2> operator==(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
-#if SIMD_SUPPORTS(SIMD_SSE4_1)
-		return vector<std::int64_t, 2>(_mm_cmpeq_epi64(v1.m_vec, v2.m_vec));
-#else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int64_t, 2>(detail::cmpeq_epi64(v1.m_vec, v2.m_vec));
 	}
 
 	vector<std::int64_t, 2> operator!=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
-#if SIMD_SUPPORTS(SIMD_SSE4_1)
 		// Invert because SSE doesn't have instruction for it
-		return vector<std::int64_t, 2>(_mm_xor_si128(_mm_cmpeq_epi64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
-#else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int64_t, 2>(_mm_xor_si128(detail::cmpeq_epi64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
 	}
 
 	vector<std::int64_t, 2> operator>(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
-#if SIMD_SUPPORTS(SIMD_SSE4_1)
-		return vector<std::int64_t, 2>(_mm_cmpgt_epi64(v1.m_vec, v2.m_vec));
-#else // SIMD_SUPPORTS(SIMD_SSE4_1)
-throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int64_t, 2>(detail::cmpgt_epi64(v1.m_vec, v2.m_vec));
 	}
 
 	vector<std::int64_t, 2> operator>=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
-#if SIMD_SUPPORTS(SIMD_SSE4_1)
 		// Invert because SSE doesn't have instruction for it (also note the switched operands!)
-		return vector<std::int64_t, 2>(_mm_xor_si128(_mm_cmpgt_epi64(v2.m_vec, v1.m_vec), _mm_set1_epi64x(-1)));
-#else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int64_t, 2>(_mm_xor_si128(detail::cmpgt_epi64(v2.m_vec, v1.m_vec), _mm_set1_epi64x(-1)));
 	}
 
 	vector<std::int64_t, 2> operator<(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
-#if SIMD_SUPPORTS(SIMD_SSE4_1)
 		// Note the switched operands!
-		return vector<std::int64_t, 2>(_mm_cmpgt_epi64(v2.m_vec, v1.m_vec));
-#else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int64_t, 2>(detail::cmpgt_epi64(v2.m_vec, v1.m_vec));
 	}
 
 	vector<std::int64_t, 2> operator<=(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
-#if SIMD_SUPPORTS(SIMD_SSE4_1)
 		// Invert because SSE doesn't have instruction for it
-		return vector<std::int64_t, 2>(_mm_xor_si128(_mm_cmpgt_epi64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
-#else // SIMD_SUPPORTS(SIMD_SSE4_1)
-throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int64_t, 2>(_mm_xor_si128(detail::cmpgt_epi64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
 	}
 
 	vector<std::int64_t, 2> &vector<std::int64_t, 2>::abs() {
-		// TODO: benchmark for most performant solution
-		// TODO: AVX 512
-		throw std::runtime_error("Operation not implemented");
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		m_vec = _mm_abs_epi64(m_vec);
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		// Broadcast the sign bit of the high half and use (x ^ sign) - sign
+		auto sign = _mm_shuffle_epi32(_mm_srai_epi32(m_vec, 31), 0b11110101);
+		m_vec = _mm_sub_epi64(_mm_xor_si128(m_vec, sign), sign);
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
 		return *this;
 	}
 
@@ -278,21 +342,31 @@ throw std::runtime_error("Operation not implemented");
 	}
 
 	vector<std::int64_t, 2> min(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
-		// TODO: AVX 512
-		throw std::runtime_error("Operation not implemented");
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::int64_t, 2>(_mm_min_epi64(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		auto gt = detail::cmpgt_epi64(v1.m_vec, v2.m_vec);
+		return vector<std::int64_t, 2>(_mm_or_si128(_mm_and_si128(gt, v2.m_vec), _mm_andnot_si128(gt, v1.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
 	}
 
 	vector<std::int64_t, 2> max(const vector<std::int64_t, 2> &v1, const vector<std::int64_t, 2> &v2) {
-		// TODO: AVX 512
-		throw std::runtime_error("Operation not implemented");
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::int64_t, 2>(_mm_max_epi64(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		auto gt = detail::cmpgt_epi64(v1.m_vec, v2.m_vec);
+		return vector<std::int64_t, 2>(_mm_or_si128(_mm_and_si128(gt, v1.m_vec), _mm_andnot_si128(gt, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
 	}
 
 	vector<std::int64_t, 2> select(const vector<std::int64_t, 2> &v, const vector<std::int64_t, 2> &alt, const mask<std::int64_t, 2> &condition) {
-		// TODO: this only works when mask is either 0 or -1 (because it's byte-wise)
 #if SIMD_SUPPORTS(SIMD_SSE4_1)
-		return vector<std::int64_t, 2>(_mm_blendv_epi8(alt.m_vec, v.m_vec, condition.native()));
+		// The float blend picks whole lanes by their sign bits, unlike the byte-wise integer blend
+		return vector<std::int64_t, 2>(_mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(alt.m_vec), _mm_castsi128_pd(v.m_vec), _mm_castsi128_pd(condition.native()))));
 #else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		return vector<std::int64_t, 2>(_mm_or_si128(_mm_and_si128(v.m_vec, condition.native()), _mm_andnot_si128(alt.m_vec, condition.native())));
+		// Only the sign bits count like for blendv, so spread them over their lanes
+		const auto sign = _mm_shuffle_epi32(_mm_srai_epi32(condition.native(), 31), _MM_SHUFFLE(3, 3, 1, 1));
+		return vector<std::int64_t, 2>(_mm_or_si128(_mm_and_si128(v.m_vec, sign), _mm_andnot_si128(sign, alt.m_vec)));
 #endif // SIMD_SUPPORTS(SIMD_SSE4_1)
 	}
 
@@ -306,20 +380,12 @@ throw std::runtime_error("Operation not implemented");
 	}
 
 	mask<std::int64_t, 2> operator==(const mask<std::int64_t, 2> & v1, const mask<std::int64_t, 2> & v2) {
-#if SIMD_SUPPORTS(SIMD_SSE4_1)
-		return mask<std::int64_t, 2>(_mm_cmpeq_epi64(v1.m_vec, v2.m_vec));
-#else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE4_1) 
+		return mask<std::int64_t, 2>(detail::cmpeq_epi64(v1.m_vec, v2.m_vec));
 	}
 
 	mask<std::int64_t, 2> operator!=(const mask<std::int64_t, 2> & v1, const mask<std::int64_t, 2> & v2) {
-#if SIMD_SUPPORTS(SIMD_SSE4_1)
 		// Invert because SSE doesn't have instruction for it
-		return mask<std::int64_t, 2>(_mm_xor_si128(_mm_cmpeq_epi64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
-#else // SIMD_SUPPORTS(SIMD_SSE4_1)
-		throw std::runtime_error("Operation not implemented");
-#endif // SIMD_SUPPORTS(SIMD_SSE4_1) 
+		return mask<std::int64_t, 2>(_mm_xor_si128(detail::cmpeq_epi64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
 	}
 
 	mask<std::int64_t, 2> & mask<std::int64_t, 2>::operator&=(const mask<std::int64_t, 2> & v) {
@@ -357,6 +423,11 @@ throw std::runtime_error("Operation not implemented");
 		return mask<std::int64_t, 2>(_mm_andnot_si128(v1.m_vec, v2.m_vec));
 	}
 
+	mask<std::int64_t, 2> mask<std::int64_t, 2>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<std::int64_t, 2>(_mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 0, 1, 1)));
+	}
+
 	int mask<std::int64_t, 2>::get_mask() const {
 		return _mm_movemask_epi8(m_vec);
 	}
@@ -376,4 +447,5 @@ throw std::runtime_error("Operation not implemented");
 
 #endif // SIMD_SUPPORTS(SIMD_SSE2)
 
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -7,10 +7,9 @@
 #include "simd.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 #if SIMD_SUPPORTS(SIMD_AVX2)
-	using int64x4 = vector<std::int64_t, 4>;
-
 	template <>
 	class vector<std::int64_t, 4> : public vector_base<std::int64_t, 4> {
 	public:
@@ -24,48 +23,57 @@ namespace simd {
 		explicit vector(const type* vals) : vector_base(_mm256_lddqu_si256(reinterpret_cast<const native_type*>(vals))) {}
 		explicit vector(const type* vals, aligned_load) : vector_base(_mm256_load_si256(reinterpret_cast<const native_type*>(vals))) {}
 
-		vector<std::int64_t, 4> & operator+=(const vector<std::int64_t, 4> & v);
-		vector<std::int64_t, 4> & operator-=(const vector<std::int64_t, 4> & v);
-		vector<std::int64_t, 4> & operator*=(const vector<std::int64_t, 4> & v);
-		vector<std::int64_t, 4> & operator/=(const vector<std::int64_t, 4> & v);
-		friend vector<std::int64_t, 4> operator+(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator-(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator*(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator/(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-
-		vector<std::int64_t, 4> & operator&=(const vector<std::int64_t, 4> & v);
-		vector<std::int64_t, 4> & operator|=(const vector<std::int64_t, 4> & v);
-		vector<std::int64_t, 4> & operator^=(const vector<std::int64_t, 4> & v);
-		friend vector<std::int64_t, 4> operator~(const vector<std::int64_t, 4> & v);
-		friend vector<std::int64_t, 4> operator&(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator|(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator^(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-
-		friend vector<std::int64_t, 4> operator<<(const vector<std::int64_t, 4> & v, int bits);
-		friend vector<std::int64_t, 4> operator>>(const vector<std::int64_t, 4> & v, int bits);
-
-		friend vector<std::int64_t, 4> operator==(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator!=(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator>(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator>=(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator<(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> operator<=(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
-
-		vector<std::int64_t, 4> & hadd(const vector<std::int64_t, 4> & v);
-		vector<std::int64_t, 4> & hsub(const vector<std::int64_t, 4> & v);
-		type hadd() const;
-		type hsub() const;
-		friend vector<std::int64_t, 4> hadd(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> hsub(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
-
-		vector<std::int64_t, 4> & abs();
-		friend vector<std::int64_t, 4> abs(vector<std::int64_t, 4> v);
-		friend vector<std::int64_t, 4> min(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
-		friend vector<std::int64_t, 4> max(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
-
-		friend vector<std::int64_t, 4> select(const vector<std::int64_t, 4> & v, const vector<std::int64_t, 4> & alt, const mask<std::int64_t, 4> & condition);
-
-		friend std::ostream& operator<<(std::ostream& stream, const vector<std::int64_t, 4> & v);
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & operator+=(const vector<std::int64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & operator-=(const vector<std::int64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & operator*=(const vector<std::int64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & operator/=(const vector<std::int64_t, 4> & v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator+(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator-(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator*(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator/(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+		// High 64 bits of the 128 bit products
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> mulhi(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & operator&=(const vector<std::int64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & operator|=(const vector<std::int64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & operator^=(const vector<std::int64_t, 4> & v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator~(const vector<std::int64_t, 4> & v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator&(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator|(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator^(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator<<(const vector<std::int64_t, 4> & v, int bits);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator>>(const vector<std::int64_t, 4> & v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator==(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator!=(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator>(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator>=(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator<(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> operator<=(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & hadd(const vector<std::int64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & hsub(const vector<std::int64_t, 4> & v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> hadd(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> hsub(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 4> & abs();
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> abs(vector<std::int64_t, 4> v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> min(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> max(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2);
+
+		friend SIMD_FORCEINLINE vector<std::int64_t, 4> select(const vector<std::int64_t, 4> & v, const vector<std::int64_t, 4> & alt, const mask<std::int64_t, 4> & condition);
+
+		friend inline std::ostream& operator<<(std::ostream& stream, const vector<std::int64_t, 4> & v);
 	};
 
 	template <>
@@ -76,8 +84,9 @@ namespace simd {
 		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm256_set1_epi64x(-static_cast<int>(b))) {}
 		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4) : vector_base(_mm256_set_epi64x(
 			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1))) {}
-		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[3], arr[2], arr[1], arr[0]) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3]) {}
 		explicit SIMD_FORCEINLINE mask(const vector<std::int64_t, 4> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::int64_t, 4> first_n(size_t count);
 
 		friend SIMD_FORCEINLINE mask<std::int64_t, 4> operator==(const mask<std::int64_t, 4> & v1, const mask<std::int64_t, 4> & v2);
 		friend SIMD_FORCEINLINE mask<std::int64_t, 4> operator!=(const mask<std::int64_t, 4> & v1, const mask<std::int64_t, 4> & v2);
@@ -98,6 +107,25 @@ namespace simd {
 		SIMD_FORCEINLINE bool none() const;
 	};
 
+	void vector<std::int64_t, 4>::store(type *vals) const {
+		_mm256_storeu_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int64_t, 4>::store(type *vals, aligned_store) const {
+		_mm256_store_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int64_t, 4>::stream(type *vals) const {
+		_mm256_stream_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int64_t, 4>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		// Two 32 bit mask entries per 64 bit lane
+		const auto tail = _mm256_loadu_si256(reinterpret_cast<const native_type *>(detail::tail_mask_table + 8 - 2 * count));
+		_mm256_maskstore_epi64(reinterpret_cast<long long *>(vals), tail, m_vec);
+	}
+
 	vector<std::int64_t, 4> & vector<std::int64_t, 4>::operator+=(const vector<std::int64_t, 4> & v) {
 		m_vec = _mm256_add_epi64(m_vec, v.m_vec);
 		return *this;
@@ -109,35 +137,46 @@ namespace simd {
 	}
 
 	vector<std::int64_t, 4> & vector<std::int64_t, 4>::operator*=(const vector<std::int64_t, 4> & v) {
-		// TODO: AVX 512
-		throw std::runtime_error("Operation not implemented");
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		m_vec = _mm256_mullo_epi64(m_vec, v.m_vec);
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		// Low 64 bits of the product: lo*lo + ((lo*hi + hi*lo) << 32)
+		auto lo = _mm256_mul_epu32(m_vec, v.m_vec);
+		auto cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(m_vec, 32), v.m_vec),
+									  _mm256_mul_epu32(m_vec, _mm256_srli_epi64(v.m_vec, 32)));
+		m_vec = _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
 		return *this;
 	}
 
 	vector<std::int64_t, 4> & vector<std::int64_t, 4>::operator/=(const vector<std::int64_t, 4> & v) {
-		// TODO: AVX 512
-		throw std::runtime_error("Operation not implemented");
+		// There is no 64 bit integer division instruction and doubles cannot represent every operand exactly
+		for(size_t i = 0; i < width; ++i)
+			m_array[i] /= v.m_array[i];
 		return *this;
 	}
 
 	vector<std::int64_t, 4> & vector<std::int64_t, 4>::hadd(const vector<std::int64_t, 4> & v) {
-		throw std::runtime_error("Operation not implemented");
+		// Same lane layout as _mm256_hadd_pd: A1+A2, B1+B2, A3+A4, B3+B4
+		m_vec = _mm256_add_epi64(_mm256_unpacklo_epi64(m_vec, v.m_vec), _mm256_unpackhi_epi64(m_vec, v.m_vec));
 		return *this;
 	}
 
 	vector<std::int64_t, 4> & vector<std::int64_t, 4>::hsub(const vector<std::int64_t, 4> & v) {
-		throw std::runtime_error("Operation not implemented");
+		m_vec = _mm256_sub_epi64(_mm256_unpacklo_epi64(m_vec, v.m_vec), _mm256_unpackhi_epi64(m_vec, v.m_vec));
 		return *this;
 	}
 
 	std::int64_t vector<std::int64_t, 4>::hadd() const {
-		// TODO: shuffle
-		throw std::runtime_error("Operation not implemented");
+		// Results in A1+A2, ..., A3+A4, ...
+		auto t1 = _mm256_add_epi64(m_vec, _mm256_shuffle_epi32(m_vec, 0b01001110));
+		return _mm_cvtsi128_si64(_mm_add_epi64(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1)));
 	}
 
 	std::int64_t vector<std::int64_t, 4>::hsub() const {
-		// TODO: shuffle
-		throw std::runtime_error("Operation not implemented");
+		// Results in A1-A2, ..., A3-A4, ...
+		auto t1 = _mm256_sub_epi64(m_vec, _mm256_shuffle_epi32(m_vec, 0b01001110));
+		return _mm_cvtsi128_si64(_mm_sub_epi64(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1)));
 	}
 
 	vector<std::int64_t, 4> hadd(vector<std::int64_t, 4> v1, const vector<std::int64_t, 4> & v2) {
@@ -164,6 +203,20 @@ namespace simd {
 		return (v1 /= v2);
 	}
 
+	vector<std::int64_t, 4> mulhi(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2) {
+		// Unsigned product from the 32 bit partial products, corrected by subtracting the other operand for each negative one
+		auto hi1 = _mm256_srli_epi64(v1.m_vec, 32);
+		auto hi2 = _mm256_srli_epi64(v2.m_vec, 32);
+		auto lo_lo = _mm256_mul_epu32(v1.m_vec, v2.m_vec);
+		auto t = _mm256_add_epi64(_mm256_mul_epu32(hi1, v2.m_vec), _mm256_srli_epi64(lo_lo, 32));
+		auto w = _mm256_add_epi64(_mm256_mul_epu32(v1.m_vec, hi2), _mm256_and_si256(t, _mm256_set1_epi64x(0xFFFFFFFF)));
+		auto hi = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(hi1, hi2), _mm256_srli_epi64(t, 32)), _mm256_srli_epi64(w, 32));
+		auto sign1 = _mm256_cmpgt_epi64(_mm256_setzero_si256(), v1.m_vec);
+		auto sign2 = _mm256_cmpgt_epi64(_mm256_setzero_si256(), v2.m_vec);
+		auto correction = _mm256_add_epi64(_mm256_and_si256(sign1, v2.m_vec), _mm256_and_si256(sign2, v1.m_vec));
+		return vector<std::int64_t, 4>(_mm256_sub_epi64(hi, correction));
+	}
+
 	vector<std::int64_t, 4> & vector<std::int64_t, 4>::operator&=(const vector<std::int64_t, 4> & v) {
 		m_vec = _mm256_and_si256(m_vec, v.m_vec);
 		return *this;
@@ -200,7 +253,14 @@ namespace simd {
 	}
 
 	vector<std::int64_t, 4> operator>>(const vector<std::int64_t, 4> & v, int bits) {
-		return vector<std::int64_t, 4>(_mm256_slli_epi64(v.m_vec, bits));
+		auto count = _mm_cvtsi32_si128(bits);
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::int64_t, 4>(_mm256_sra_epi64(v.m_vec, count));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		// Shift logically and sign extend from the shifted sign bit m via (x ^ m) - m
+		auto m = _mm256_srl_epi64(_mm256_set1_epi64x(INT64_MIN), count);
+		return vector<std::int64_t, 4>(_mm256_sub_epi64(_mm256_xor_si256(_mm256_srl_epi64(v.m_vec, count), m), m));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
 	}
 
 	vector<std::int64_t, 4> operator==(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2) {
@@ -232,9 +292,12 @@ namespace simd {
 	}
 
 	vector<std::int64_t, 4> & vector<std::int64_t, 4>::abs() {
-		// TODO: benchmark for most performant solution
-		// TODO: AVX 512
-		throw std::runtime_error("Operation not implemented");
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		m_vec = _mm256_abs_epi64(m_vec);
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		auto sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), m_vec);
+		m_vec = _mm256_sub_epi64(_mm256_xor_si256(m_vec, sign), sign);
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
 		return *this;
 	}
 
@@ -243,13 +306,19 @@ namespace simd {
 	}
 
 	vector<std::int64_t, 4> min(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2) {
-		throw std::runtime_error("Operation not implemented");
-		// TODO: AVX 512
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::int64_t, 4>(_mm256_min_epi64(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::int64_t, 4>(_mm256_blendv_epi8(v1.m_vec, v2.m_vec, _mm256_cmpgt_epi64(v1.m_vec, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
 	}
 
 	vector<std::int64_t, 4> max(const vector<std::int64_t, 4> & v1, const vector<std::int64_t, 4> & v2) {
-		throw std::runtime_error("Operation not implemented");
-		// TODO: AVX 512
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::int64_t, 4>(_mm256_max_epi64(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::int64_t, 4>(_mm256_blendv_epi8(v2.m_vec, v1.m_vec, _mm256_cmpgt_epi64(v1.m_vec, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
 	}
 
 	vector<std::int64_t, 4> select(const vector<std::int64_t, 4> & v, const vector<std::int64_t, 4> & alt, const mask<std::int64_t, 4> & condition) {
@@ -310,6 +379,11 @@ namespace simd {
 		return mask<std::int64_t, 4>(_mm256_andnot_si256(v1.m_vec, v2.m_vec));
 	}
 
+	mask<std::int64_t, 4> mask<std::int64_t, 4>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<std::int64_t, 4>(_mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3)));
+	}
+
 	int mask<std::int64_t, 4>::get_mask() const {
 		return _mm256_movemask_epi8(m_vec);
 	}
@@ -329,4 +403,5 @@ namespace simd {
 
 #endif // SIMD_SUPPORTS(SIMD_AVX2)
 
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -0,0 +1,424 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	template <>
+	class vector<std::int64_t, 8> : public vector_base<std::int64_t, 8> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+	public:
+		SIMD_FORCEINLINE vector() : vector_base() {}
+		explicit SIMD_FORCEINLINE vector(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE vector(type f) : vector_base(_mm512_set1_epi64(f)) {}
+		explicit SIMD_FORCEINLINE vector(type f1, type f2, type f3, type f4,
+										 type f5, type f6, type f7, type f8) : vector_base(_mm512_set_epi64(f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit SIMD_FORCEINLINE vector(const std::array<type, width> &arr) : vector_base(_mm512_loadu_si512(arr.data())) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals) : vector_base(_mm512_loadu_si512(vals)) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals, aligned_load) : vector_base(_mm512_load_si512(vals)) {}
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE vector(const vector<double, 8> &v);
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &operator+=(const vector<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &operator-=(const vector<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &operator*=(const vector<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &operator/=(const vector<std::int64_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator+(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator-(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator*(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator/(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+		// High 64 bits of the 128 bit products
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> mulhi(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &operator&=(const vector<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &operator|=(const vector<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &operator^=(const vector<std::int64_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator~(const vector<std::int64_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator&(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator|(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator^(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator<<(const vector<std::int64_t, 8> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> operator>>(const vector<std::int64_t, 8> &v, int bits);
+
+		// Comparisons produce k-register masks instead of vectors
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator==(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator!=(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator>(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator>=(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator<(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator<=(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &hadd(const vector<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &hsub(const vector<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		// Pairwise difference tree, i.e. ((A1-A2)-(A3-A4))-((A5-A6)-(A7-A8))-...
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> hadd(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> hsub(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::int64_t, 8> &abs();
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> abs(vector<std::int64_t, 8> v);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> min(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> max(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int64_t, 8> select(const vector<std::int64_t, 8> &v, const vector<std::int64_t, 8> &alt, const mask<std::int64_t, 8> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::int64_t, 8> &v);
+	};
+
+	template <>
+	class mask<std::int64_t, 8> {
+	public:
+		using type = std::int64_t;
+		static constexpr size_t width = 8;
+		using native_type = native_vector<type, width>::mask_type;
+
+		SIMD_FORCEINLINE mask() : m_mask(0) {}
+		explicit SIMD_FORCEINLINE mask(native_type m) : m_mask(m) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : m_mask(static_cast<native_type>(-static_cast<int>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7, bool b8) :
+			mask(std::array<bool, width>{ { b1, b2, b3, b4, b5, b6, b7, b8 } }) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width> &arr) : m_mask(0) {
+			for(size_t i = 0; i < width; ++i)
+				m_mask |= static_cast<native_type>(arr[i]) << i;
+		}
+		// Lanes with the sign bit set are considered true, like by the blendv and movemask based masks
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE mask(const vector<std::int64_t, 8> &v) : m_mask(_mm512_movepi64_mask(v.native())) {}
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		explicit SIMD_FORCEINLINE mask(const vector<std::int64_t, 8> &v) : m_mask(_mm512_cmplt_epi64_mask(v.native(), _mm512_setzero_si512())) {}
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		static SIMD_FORCEINLINE mask<std::int64_t, 8> first_n(size_t count);
+
+		SIMD_FORCEINLINE native_type &native() {
+			return m_mask;
+		}
+
+		SIMD_FORCEINLINE const native_type &native() const {
+			return m_mask;
+		}
+
+		SIMD_FORCEINLINE bool operator[](size_t index) const {
+			assert(index < width);
+			return (m_mask >> index) & 1;
+		}
+
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator==(const mask<std::int64_t, 8> &v1, const mask<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator!=(const mask<std::int64_t, 8> &v1, const mask<std::int64_t, 8> &v2);
+
+		SIMD_FORCEINLINE mask<std::int64_t, 8> &operator&=(const mask<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE mask<std::int64_t, 8> &operator|=(const mask<std::int64_t, 8> &v);
+		SIMD_FORCEINLINE mask<std::int64_t, 8> &operator^=(const mask<std::int64_t, 8> &v);
+
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator~(const mask<std::int64_t, 8> &v);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator&(mask<std::int64_t, 8> v1, const mask<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator|(mask<std::int64_t, 8> v1, const mask<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> operator^(mask<std::int64_t, 8> v1, const mask<std::int64_t, 8> &v2);
+		friend SIMD_FORCEINLINE mask<std::int64_t, 8> andnot(const mask<std::int64_t, 8> &v1, const mask<std::int64_t, 8> &v2);
+
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const mask<std::int64_t, 8> &m);
+
+	private:
+		native_type m_mask;
+	};
+
+	void vector<std::int64_t, 8>::store(type *vals) const {
+		_mm512_storeu_si512(vals, m_vec);
+	}
+
+	void vector<std::int64_t, 8>::store(type *vals, aligned_store) const {
+		_mm512_store_si512(vals, m_vec);
+	}
+
+	void vector<std::int64_t, 8>::stream(type *vals) const {
+		_mm512_stream_si512(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int64_t, 8>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		_mm512_mask_storeu_epi64(vals, static_cast<__mmask8>((1u << count) - 1u), m_vec);
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::operator+=(const vector<std::int64_t, 8> &v) {
+		m_vec = _mm512_add_epi64(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::operator-=(const vector<std::int64_t, 8> &v) {
+		m_vec = _mm512_sub_epi64(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::operator*=(const vector<std::int64_t, 8> &v) {
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		m_vec = _mm512_mullo_epi64(m_vec, v.m_vec);
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		// Low 64 bits of the product: lo*lo + ((lo*hi + hi*lo) << 32)
+		auto lo = _mm512_mul_epu32(m_vec, v.m_vec);
+		auto cross = _mm512_add_epi64(_mm512_mul_epu32(_mm512_srli_epi64(m_vec, 32), v.m_vec),
+									  _mm512_mul_epu32(m_vec, _mm512_srli_epi64(v.m_vec, 32)));
+		m_vec = _mm512_add_epi64(lo, _mm512_slli_epi64(cross, 32));
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		return *this;
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::operator/=(const vector<std::int64_t, 8> &v) {
+		// There is no 64 bit integer division instruction and doubles cannot represent every operand exactly
+		for(size_t i = 0; i < width; ++i)
+			m_array[i] /= v.m_array[i];
+		return *this;
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::hadd(const vector<std::int64_t, 8> &v) {
+		// Same lane layout as _mm256_hadd_pd: A1+A2, B1+B2 per 128 bit lane
+		auto even = _mm512_unpacklo_epi64(m_vec, v.m_vec);
+		auto odd = _mm512_unpackhi_epi64(m_vec, v.m_vec);
+		m_vec = _mm512_add_epi64(even, odd);
+		return *this;
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::hsub(const vector<std::int64_t, 8> &v) {
+		auto even = _mm512_unpacklo_epi64(m_vec, v.m_vec);
+		auto odd = _mm512_unpackhi_epi64(m_vec, v.m_vec);
+		m_vec = _mm512_sub_epi64(even, odd);
+		return *this;
+	}
+
+	std::int64_t vector<std::int64_t, 8>::hadd() const {
+		return _mm512_reduce_add_epi64(m_vec);
+	}
+
+	std::int64_t vector<std::int64_t, 8>::hsub() const {
+		// Every lane with an odd number of set index bits ends up negated in the difference tree
+		return _mm512_reduce_add_epi64(_mm512_mask_sub_epi64(m_vec, 0x96, _mm512_setzero_si512(), m_vec));
+	}
+
+	vector<std::int64_t, 8> hadd(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return v1.hadd(v2);
+	}
+
+	vector<std::int64_t, 8> hsub(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return v1.hsub(v2);
+	}
+
+	vector<std::int64_t, 8> operator+(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::int64_t, 8> operator-(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::int64_t, 8> operator*(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::int64_t, 8> operator/(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::int64_t, 8> mulhi(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		// Unsigned product from the 32 bit partial products, corrected by subtracting the other operand for each negative one
+		auto hi1 = _mm512_srli_epi64(v1.m_vec, 32);
+		auto hi2 = _mm512_srli_epi64(v2.m_vec, 32);
+		auto lo_lo = _mm512_mul_epu32(v1.m_vec, v2.m_vec);
+		auto t = _mm512_add_epi64(_mm512_mul_epu32(hi1, v2.m_vec), _mm512_srli_epi64(lo_lo, 32));
+		auto w = _mm512_add_epi64(_mm512_mul_epu32(v1.m_vec, hi2), _mm512_and_si512(t, _mm512_set1_epi64(0xFFFFFFFF)));
+		auto hi = _mm512_add_epi64(_mm512_add_epi64(_mm512_mul_epu32(hi1, hi2), _mm512_srli_epi64(t, 32)), _mm512_srli_epi64(w, 32));
+		auto correction = _mm512_add_epi64(_mm512_and_si512(_mm512_srai_epi64(v1.m_vec, 63), v2.m_vec),
+										   _mm512_and_si512(_mm512_srai_epi64(v2.m_vec, 63), v1.m_vec));
+		return vector<std::int64_t, 8>(_mm512_sub_epi64(hi, correction));
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::operator&=(const vector<std::int64_t, 8> &v) {
+		m_vec = _mm512_and_si512(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::operator|=(const vector<std::int64_t, 8> &v) {
+		m_vec = _mm512_or_si512(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::operator^=(const vector<std::int64_t, 8> &v) {
+		m_vec = _mm512_xor_si512(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int64_t, 8> operator~(const vector<std::int64_t, 8> &v) {
+		return vector<std::int64_t, 8>(_mm512_xor_si512(v.m_vec, _mm512_set1_epi64(-1)));
+	}
+
+	vector<std::int64_t, 8> operator&(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::int64_t, 8> operator|(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::int64_t, 8> operator^(vector<std::int64_t, 8> v1, const vector<std::int64_t, 8> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::int64_t, 8> operator<<(const vector<std::int64_t, 8> &v, int bits) {
+		return vector<std::int64_t, 8>(_mm512_sll_epi64(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::int64_t, 8> operator>>(const vector<std::int64_t, 8> &v, int bits) {
+		return vector<std::int64_t, 8>(_mm512_sra_epi64(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	mask<std::int64_t, 8> operator==(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(_mm512_cmp_epi64_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_EQ));
+	}
+
+	mask<std::int64_t, 8> operator!=(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(_mm512_cmp_epi64_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_NE));
+	}
+
+	mask<std::int64_t, 8> operator>(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(_mm512_cmp_epi64_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_NLE));
+	}
+
+	mask<std::int64_t, 8> operator>=(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(_mm512_cmp_epi64_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_NLT));
+	}
+
+	mask<std::int64_t, 8> operator<(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(_mm512_cmp_epi64_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_LT));
+	}
+
+	mask<std::int64_t, 8> operator<=(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(_mm512_cmp_epi64_mask(v1.m_vec, v2.m_vec, _MM_CMPINT_LE));
+	}
+
+	vector<std::int64_t, 8> &vector<std::int64_t, 8>::abs() {
+		m_vec = _mm512_abs_epi64(m_vec);
+		return *this;
+	}
+
+	vector<std::int64_t, 8> abs(vector<std::int64_t, 8> v) {
+		return v.abs();
+	}
+
+	vector<std::int64_t, 8> min(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		return vector<std::int64_t, 8>(_mm512_min_epi64(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int64_t, 8> max(const vector<std::int64_t, 8> &v1, const vector<std::int64_t, 8> &v2) {
+		return vector<std::int64_t, 8>(_mm512_max_epi64(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int64_t, 8> select(const vector<std::int64_t, 8> &v, const vector<std::int64_t, 8> &alt, const mask<std::int64_t, 8> &condition) {
+		return vector<std::int64_t, 8>(_mm512_mask_blend_epi64(condition.native(), alt.m_vec, v.m_vec));
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::int64_t, 8> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	// The 8 bit k-register instructions need AVX512DQ, plain integer operations on the mask do the same job
+	mask<std::int64_t, 8> operator==(const mask<std::int64_t, 8> &v1, const mask<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(static_cast<__mmask8>(~(v1.m_mask ^ v2.m_mask)));
+	}
+
+	mask<std::int64_t, 8> operator!=(const mask<std::int64_t, 8> &v1, const mask<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(static_cast<__mmask8>(v1.m_mask ^ v2.m_mask));
+	}
+
+	mask<std::int64_t, 8> &mask<std::int64_t, 8>::operator&=(const mask<std::int64_t, 8> &v) {
+		m_mask &= v.m_mask;
+		return *this;
+	}
+
+	mask<std::int64_t, 8> &mask<std::int64_t, 8>::operator|=(const mask<std::int64_t, 8> &v) {
+		m_mask |= v.m_mask;
+		return *this;
+	}
+
+	mask<std::int64_t, 8> &mask<std::int64_t, 8>::operator^=(const mask<std::int64_t, 8> &v) {
+		m_mask ^= v.m_mask;
+		return *this;
+	}
+
+	mask<std::int64_t, 8> operator~(const mask<std::int64_t, 8> &v) {
+		return mask<std::int64_t, 8>(static_cast<__mmask8>(~v.m_mask));
+	}
+
+	mask<std::int64_t, 8> operator&(mask<std::int64_t, 8> v1, const mask<std::int64_t, 8> &v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::int64_t, 8> operator|(mask<std::int64_t, 8> v1, const mask<std::int64_t, 8> &v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::int64_t, 8> operator^(mask<std::int64_t, 8> v1, const mask<std::int64_t, 8> &v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::int64_t, 8> andnot(const mask<std::int64_t, 8> &v1, const mask<std::int64_t, 8> &v2) {
+		return mask<std::int64_t, 8>(static_cast<__mmask8>(~v1.m_mask & v2.m_mask));
+	}
+
+	mask<std::int64_t, 8> mask<std::int64_t, 8>::first_n(size_t count) {
+		return mask<std::int64_t, 8>(static_cast<native_type>((1u << (count < width ? count : width)) - 1));
+	}
+
+	int mask<std::int64_t, 8>::get_mask() const {
+		return m_mask;
+	}
+
+	bool mask<std::int64_t, 8>::all() const {
+		return m_mask == 0xFF;
+	}
+
+	bool mask<std::int64_t, 8>::any() const {
+		return m_mask != 0;
+	}
+
+	bool mask<std::int64_t, 8>::none() const {
+		return m_mask == 0;
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const mask<std::int64_t, 8> &m) {
+		stream << '(';
+		for (size_t i = 0; i < m.width - 1; ++i) {
+			stream << m[i] << ' ';
+		}
+		stream << m[m.width - 1] << ')';
+		return stream;
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,402 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	// x86 has no byte multiplies, shifts or divisions, those go through 16 bit lanes (int16x8.hpp)
+	template <>
+	class vector<std::int8_t, 16> : public vector_base<std::int8_t, 16> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm_set1_epi8(f)) {}
+		explicit vector(type f1, type f2, type f3, type f4, type f5, type f6, type f7, type f8,
+						type f9, type f10, type f11, type f12, type f13, type f14, type f15, type f16) :
+			vector_base(_mm_set_epi8(f16, f15, f14, f13, f12, f11, f10, f9, f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(arr.data()))) {}
+#if SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_lddqu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#else // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#endif // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals, aligned_load) : vector_base(_mm_load_si128(reinterpret_cast<const native_type *>(vals))) {}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::int8_t, 16> &operator+=(const vector<std::int8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 16> &operator-=(const vector<std::int8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 16> &operator*=(const vector<std::int8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 16> &operator/=(const vector<std::int8_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator+(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator-(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2);
+		// Low 8 bits of the products
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator*(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator/(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2);
+		// Sums and differences clamped to the range of the lanes instead of wrapping around
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> add_sat(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> sub_sat(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+		// High 8 bits of the 16 bit products
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> mulhi(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+
+		SIMD_FORCEINLINE vector<std::int8_t, 16> &operator&=(const vector<std::int8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 16> &operator|=(const vector<std::int8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 16> &operator^=(const vector<std::int8_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator~(const vector<std::int8_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator&(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator|(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator^(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator<<(const vector<std::int8_t, 16> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator>>(const vector<std::int8_t, 16> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator==(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator!=(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator>(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator>=(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator<(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> operator<=(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+
+		SIMD_FORCEINLINE vector<std::int8_t, 16> &abs();
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> abs(vector<std::int8_t, 16> v);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> min(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> max(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int8_t, 16> select(const vector<std::int8_t, 16> &v, const vector<std::int8_t, 16> &alt, const mask<std::int8_t, 16> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::int8_t, 16> &v);
+	};
+
+	template <>
+	class mask<std::int8_t, 16> : public vector_base<std::int8_t, 16> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_set1_epi8(-static_cast<char>(b))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr);
+		explicit SIMD_FORCEINLINE mask(const vector<std::int8_t, 16> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::int8_t, 16> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::int8_t, 16> operator==(const mask<std::int8_t, 16> & v1, const mask<std::int8_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 16> operator!=(const mask<std::int8_t, 16> & v1, const mask<std::int8_t, 16> & v2);
+
+		SIMD_FORCEINLINE mask<std::int8_t, 16> & operator&=(const mask<std::int8_t, 16> & v);
+		SIMD_FORCEINLINE mask<std::int8_t, 16> & operator|=(const mask<std::int8_t, 16> & v);
+		SIMD_FORCEINLINE mask<std::int8_t, 16> & operator^=(const mask<std::int8_t, 16> & v);
+
+		friend SIMD_FORCEINLINE mask<std::int8_t, 16> operator~(const mask<std::int8_t, 16> & v);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 16> operator&(mask<std::int8_t, 16> v1, const mask<std::int8_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 16> operator|(mask<std::int8_t, 16> v1, const mask<std::int8_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 16> operator^(mask<std::int8_t, 16> v1, const mask<std::int8_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 16> andnot(const mask<std::int8_t, 16> & v1, const mask<std::int8_t, 16> & v2);
+
+		// Byte movemask, one bit per lane
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	namespace detail {
+
+		// Sign extended 16 bit halves of 8 bit lanes
+		SIMD_FORCEINLINE __m128i widen_lo_epi8(__m128i v) {
+			return _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8);
+		}
+
+		SIMD_FORCEINLINE __m128i widen_hi_epi8(__m128i v) {
+			return _mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8);
+		}
+
+		// Low 8 bits of 16 bit lanes, wrapping around like the scalar conversion
+		SIMD_FORCEINLINE __m128i narrow_epi16(__m128i lo, __m128i hi) {
+			const auto low_bytes = _mm_set1_epi16(0x00FF);
+			return _mm_packus_epi16(_mm_and_si128(lo, low_bytes), _mm_and_si128(hi, low_bytes));
+		}
+
+	} // namespace detail
+
+	void vector<std::int8_t, 16>::store(type *vals) const {
+		_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int8_t, 16>::store(type *vals, aligned_store) const {
+		_mm_store_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int8_t, 16>::stream(type *vals) const {
+		_mm_stream_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int8_t, 16>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		std::memcpy(vals, m_array.data(), count * sizeof(type));
+	}
+
+	vector<std::int8_t, 16> &vector<std::int8_t, 16>::operator+=(const vector<std::int8_t, 16> &v) {
+		m_vec = _mm_add_epi8(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 16> &vector<std::int8_t, 16>::operator-=(const vector<std::int8_t, 16> &v) {
+		m_vec = _mm_sub_epi8(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 16> &vector<std::int8_t, 16>::operator*=(const vector<std::int8_t, 16> &v) {
+		// The low byte of a 16 bit product only depends on the low bytes of the factors
+		auto even = _mm_mullo_epi16(m_vec, v.m_vec);
+		auto odd = _mm_mullo_epi16(_mm_srli_epi16(m_vec, 8), _mm_srli_epi16(v.m_vec, 8));
+		m_vec = _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0x00FF)), _mm_slli_epi16(odd, 8));
+		return *this;
+	}
+
+	vector<std::int8_t, 16> &vector<std::int8_t, 16>::operator/=(const vector<std::int8_t, 16> &v) {
+		auto lo = vector<std::int16_t, 8>(detail::widen_lo_epi8(m_vec)) / vector<std::int16_t, 8>(detail::widen_lo_epi8(v.m_vec));
+		auto hi = vector<std::int16_t, 8>(detail::widen_hi_epi8(m_vec)) / vector<std::int16_t, 8>(detail::widen_hi_epi8(v.m_vec));
+		m_vec = detail::narrow_epi16(lo.native(), hi.native());
+		return *this;
+	}
+
+	vector<std::int8_t, 16> operator+(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::int8_t, 16> operator-(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::int8_t, 16> operator*(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::int8_t, 16> operator/(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::int8_t, 16> add_sat(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		return vector<std::int8_t, 16>(_mm_adds_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 16> sub_sat(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		return vector<std::int8_t, 16>(_mm_subs_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 16> mulhi(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		// The high bytes of the products fit into 8 bits, so the saturating pack keeps them
+		auto lo = _mm_srai_epi16(_mm_mullo_epi16(detail::widen_lo_epi8(v1.m_vec), detail::widen_lo_epi8(v2.m_vec)), 8);
+		auto hi = _mm_srai_epi16(_mm_mullo_epi16(detail::widen_hi_epi8(v1.m_vec), detail::widen_hi_epi8(v2.m_vec)), 8);
+		return vector<std::int8_t, 16>(_mm_packs_epi16(lo, hi));
+	}
+
+	vector<std::int8_t, 16> &vector<std::int8_t, 16>::operator&=(const vector<std::int8_t, 16> &v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 16> &vector<std::int8_t, 16>::operator|=(const vector<std::int8_t, 16> &v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 16> &vector<std::int8_t, 16>::operator^=(const vector<std::int8_t, 16> &v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 16> operator~(const vector<std::int8_t, 16> &v) {
+		return vector<std::int8_t, 16>(_mm_xor_si128(v.m_vec, _mm_set1_epi32(-1)));
+	}
+
+	vector<std::int8_t, 16> operator&(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::int8_t, 16> operator|(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::int8_t, 16> operator^(vector<std::int8_t, 16> v1, const vector<std::int8_t, 16> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::int8_t, 16> operator<<(const vector<std::int8_t, 16> &v, int bits) {
+		// Shift 16 bit lanes and clear the bits moved in from the neighbouring byte
+		const auto count = _mm_cvtsi32_si128(bits);
+		const auto keep = _mm_set1_epi8(static_cast<char>(0xFF << bits));
+		return vector<std::int8_t, 16>(_mm_and_si128(_mm_sll_epi16(v.m_vec, count), keep));
+	}
+
+	vector<std::int8_t, 16> operator>>(const vector<std::int8_t, 16> &v, int bits) {
+		// Each byte in the high half of a 16 bit lane, shifted arithmetically by 8 more bits
+		const auto count = _mm_cvtsi32_si128(bits + 8);
+		auto lo = _mm_sra_epi16(_mm_unpacklo_epi8(v.m_vec, v.m_vec), count);
+		auto hi = _mm_sra_epi16(_mm_unpackhi_epi8(v.m_vec, v.m_vec), count);
+		return vector<std::int8_t, 16>(_mm_packs_epi16(lo, hi));
+	}
+
+	vector<std::int8_t, 16> operator==(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		return vector<std::int8_t, 16>(_mm_cmpeq_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 16> operator!=(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::int8_t, 16>(_mm_xor_si128(_mm_cmpeq_epi8(v1.m_vec, v2.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	vector<std::int8_t, 16> operator>(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		return vector<std::int8_t, 16>(_mm_cmpgt_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 16> operator>=(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::int8_t, 16>(_mm_xor_si128(_mm_cmplt_epi8(v1.m_vec, v2.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	vector<std::int8_t, 16> operator<(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		return vector<std::int8_t, 16>(_mm_cmplt_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 16> operator<=(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::int8_t, 16>(_mm_xor_si128(_mm_cmpgt_epi8(v1.m_vec, v2.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	vector<std::int8_t, 16> &vector<std::int8_t, 16>::abs() {
+#if SIMD_SUPPORTS(SIMD_SSSE3)
+		m_vec = _mm_abs_epi8(m_vec);
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
+		auto sign = _mm_cmplt_epi8(m_vec, _mm_setzero_si128());
+		m_vec = _mm_sub_epi8(_mm_xor_si128(m_vec, sign), sign);
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
+		return *this;
+	}
+
+	vector<std::int8_t, 16> abs(vector<std::int8_t, 16> v) {
+		return v.abs();
+	}
+
+	vector<std::int8_t, 16> min(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int8_t, 16>(_mm_min_epi8(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		auto gt = _mm_cmpgt_epi8(v1.m_vec, v2.m_vec);
+		return vector<std::int8_t, 16>(_mm_or_si128(_mm_and_si128(gt, v2.m_vec), _mm_andnot_si128(gt, v1.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<std::int8_t, 16> max(const vector<std::int8_t, 16> &v1, const vector<std::int8_t, 16> &v2) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int8_t, 16>(_mm_max_epi8(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		auto gt = _mm_cmpgt_epi8(v1.m_vec, v2.m_vec);
+		return vector<std::int8_t, 16>(_mm_or_si128(_mm_and_si128(gt, v1.m_vec), _mm_andnot_si128(gt, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<std::int8_t, 16> select(const vector<std::int8_t, 16> &v, const vector<std::int8_t, 16> &alt, const mask<std::int8_t, 16> &condition) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int8_t, 16>(_mm_blendv_epi8(alt.m_vec, v.m_vec, condition.native()));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::int8_t, 16>(_mm_or_si128(_mm_and_si128(v.m_vec, condition.native()), _mm_andnot_si128(condition.native(), alt.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::int8_t, 16> &v) {
+		// Promoted, characters would be printed otherwise
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << +v.m_array[i] << ' ';
+		}
+		stream << +v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::int8_t, 16>::mask(const std::array<bool, width>& arr) {
+		std::array<type, width> lanes;
+		for(size_t i = 0; i < width; ++i)
+			lanes[i] = -static_cast<type>(arr[i]);
+		m_vec = _mm_loadu_si128(reinterpret_cast<const native_type *>(lanes.data()));
+	}
+
+	mask<std::int8_t, 16> operator==(const mask<std::int8_t, 16> & v1, const mask<std::int8_t, 16> & v2) {
+		return mask<std::int8_t, 16>(_mm_cmpeq_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::int8_t, 16> operator!=(const mask<std::int8_t, 16> & v1, const mask<std::int8_t, 16> & v2) {
+		return mask<std::int8_t, 16>(_mm_xor_si128(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::int8_t, 16> & mask<std::int8_t, 16>::operator&=(const mask<std::int8_t, 16> & v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::int8_t, 16> & mask<std::int8_t, 16>::operator|=(const mask<std::int8_t, 16> & v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::int8_t, 16> & mask<std::int8_t, 16>::operator^=(const mask<std::int8_t, 16> & v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::int8_t, 16> operator~(const mask<std::int8_t, 16> & v) {
+		return mask<std::int8_t, 16>(_mm_xor_si128(v.m_vec, _mm_set1_epi32(-1)));
+	}
+
+	mask<std::int8_t, 16> operator&(mask<std::int8_t, 16> v1, const mask<std::int8_t, 16> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::int8_t, 16> operator|(mask<std::int8_t, 16> v1, const mask<std::int8_t, 16> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::int8_t, 16> operator^(mask<std::int8_t, 16> v1, const mask<std::int8_t, 16> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::int8_t, 16> andnot(const mask<std::int8_t, 16> & v1, const mask<std::int8_t, 16> & v2) {
+		return mask<std::int8_t, 16>(_mm_andnot_si128(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::int8_t, 16> mask<std::int8_t, 16>::first_n(size_t count) {
+		const char n = static_cast<char>(count < width ? count : width);
+		return mask<std::int8_t, 16>(_mm_cmpgt_epi8(_mm_set1_epi8(n), _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+	}
+
+	int mask<std::int8_t, 16>::get_mask() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::int8_t, 16>::all() const {
+		return _mm_movemask_epi8(m_vec) == 0xFFFF;
+	}
+
+	bool mask<std::int8_t, 16>::any() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::int8_t, 16>::none() const {
+		return !_mm_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
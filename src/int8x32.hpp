@@ -0,0 +1,378 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+	// Byte multiplies, shifts and divisions go through 16 bit lanes (int16x16.hpp) like in int8x16.hpp
+	template <>
+	class vector<std::int8_t, 32> : public vector_base<std::int8_t, 32> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm256_set1_epi8(f)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm256_loadu_si256(reinterpret_cast<const native_type *>(arr.data()))) {}
+		explicit vector(const type *vals) : vector_base(_mm256_lddqu_si256(reinterpret_cast<const native_type *>(vals))) {}
+		explicit vector(const type *vals, aligned_load) : vector_base(_mm256_load_si256(reinterpret_cast<const native_type *>(vals))) {}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::int8_t, 32> &operator+=(const vector<std::int8_t, 32> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 32> &operator-=(const vector<std::int8_t, 32> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 32> &operator*=(const vector<std::int8_t, 32> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 32> &operator/=(const vector<std::int8_t, 32> &v);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator+(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator-(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2);
+		// Low 8 bits of the products
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator*(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator/(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2);
+		// Sums and differences clamped to the range of the lanes instead of wrapping around
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> add_sat(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> sub_sat(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+		// High 8 bits of the 16 bit products
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> mulhi(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+
+		SIMD_FORCEINLINE vector<std::int8_t, 32> &operator&=(const vector<std::int8_t, 32> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 32> &operator|=(const vector<std::int8_t, 32> &v);
+		SIMD_FORCEINLINE vector<std::int8_t, 32> &operator^=(const vector<std::int8_t, 32> &v);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator~(const vector<std::int8_t, 32> &v);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator&(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator|(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator^(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator<<(const vector<std::int8_t, 32> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator>>(const vector<std::int8_t, 32> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator==(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator!=(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator>(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator>=(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator<(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> operator<=(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+
+		SIMD_FORCEINLINE vector<std::int8_t, 32> &abs();
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> abs(vector<std::int8_t, 32> v);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> min(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> max(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::int8_t, 32> select(const vector<std::int8_t, 32> &v, const vector<std::int8_t, 32> &alt, const mask<std::int8_t, 32> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::int8_t, 32> &v);
+	};
+
+	template <>
+	class mask<std::int8_t, 32> : public vector_base<std::int8_t, 32> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm256_set1_epi8(-static_cast<char>(b))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr);
+		explicit SIMD_FORCEINLINE mask(const vector<std::int8_t, 32> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::int8_t, 32> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::int8_t, 32> operator==(const mask<std::int8_t, 32> & v1, const mask<std::int8_t, 32> & v2);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 32> operator!=(const mask<std::int8_t, 32> & v1, const mask<std::int8_t, 32> & v2);
+
+		SIMD_FORCEINLINE mask<std::int8_t, 32> & operator&=(const mask<std::int8_t, 32> & v);
+		SIMD_FORCEINLINE mask<std::int8_t, 32> & operator|=(const mask<std::int8_t, 32> & v);
+		SIMD_FORCEINLINE mask<std::int8_t, 32> & operator^=(const mask<std::int8_t, 32> & v);
+
+		friend SIMD_FORCEINLINE mask<std::int8_t, 32> operator~(const mask<std::int8_t, 32> & v);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 32> operator&(mask<std::int8_t, 32> v1, const mask<std::int8_t, 32> & v2);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 32> operator|(mask<std::int8_t, 32> v1, const mask<std::int8_t, 32> & v2);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 32> operator^(mask<std::int8_t, 32> v1, const mask<std::int8_t, 32> & v2);
+		friend SIMD_FORCEINLINE mask<std::int8_t, 32> andnot(const mask<std::int8_t, 32> & v1, const mask<std::int8_t, 32> & v2);
+
+		// Byte movemask, one bit per lane
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	namespace detail {
+
+		// Sign extended 16 bit halves of the 8 bit lanes of each 128 bit block
+		SIMD_FORCEINLINE __m256i widen_lo_epi8(__m256i v) {
+			return _mm256_srai_epi16(_mm256_unpacklo_epi8(v, v), 8);
+		}
+
+		SIMD_FORCEINLINE __m256i widen_hi_epi8(__m256i v) {
+			return _mm256_srai_epi16(_mm256_unpackhi_epi8(v, v), 8);
+		}
+
+		// Inverse of the widening above, wrapping around like the scalar conversion
+		SIMD_FORCEINLINE __m256i narrow_epi16(__m256i lo, __m256i hi) {
+			const auto low_bytes = _mm256_set1_epi16(0x00FF);
+			return _mm256_packus_epi16(_mm256_and_si256(lo, low_bytes), _mm256_and_si256(hi, low_bytes));
+		}
+
+	} // namespace detail
+
+	void vector<std::int8_t, 32>::store(type *vals) const {
+		_mm256_storeu_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int8_t, 32>::store(type *vals, aligned_store) const {
+		_mm256_store_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int8_t, 32>::stream(type *vals) const {
+		_mm256_stream_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::int8_t, 32>::store_n(type *vals, size_t count) const {
+		// vpmaskmov only exists for 32 and 64 bit lanes
+		assert(count <= width);
+		std::memcpy(vals, m_array.data(), count * sizeof(type));
+	}
+
+	vector<std::int8_t, 32> &vector<std::int8_t, 32>::operator+=(const vector<std::int8_t, 32> &v) {
+		m_vec = _mm256_add_epi8(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 32> &vector<std::int8_t, 32>::operator-=(const vector<std::int8_t, 32> &v) {
+		m_vec = _mm256_sub_epi8(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 32> &vector<std::int8_t, 32>::operator*=(const vector<std::int8_t, 32> &v) {
+		// The low byte of a 16 bit product only depends on the low bytes of the factors
+		auto even = _mm256_mullo_epi16(m_vec, v.m_vec);
+		auto odd = _mm256_mullo_epi16(_mm256_srli_epi16(m_vec, 8), _mm256_srli_epi16(v.m_vec, 8));
+		m_vec = _mm256_or_si256(_mm256_and_si256(even, _mm256_set1_epi16(0x00FF)), _mm256_slli_epi16(odd, 8));
+		return *this;
+	}
+
+	vector<std::int8_t, 32> &vector<std::int8_t, 32>::operator/=(const vector<std::int8_t, 32> &v) {
+		auto lo = vector<std::int16_t, 16>(detail::widen_lo_epi8(m_vec)) / vector<std::int16_t, 16>(detail::widen_lo_epi8(v.m_vec));
+		auto hi = vector<std::int16_t, 16>(detail::widen_hi_epi8(m_vec)) / vector<std::int16_t, 16>(detail::widen_hi_epi8(v.m_vec));
+		m_vec = detail::narrow_epi16(lo.native(), hi.native());
+		return *this;
+	}
+
+	vector<std::int8_t, 32> operator+(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::int8_t, 32> operator-(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::int8_t, 32> operator*(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::int8_t, 32> operator/(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::int8_t, 32> add_sat(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		return vector<std::int8_t, 32>(_mm256_adds_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 32> sub_sat(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		return vector<std::int8_t, 32>(_mm256_subs_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 32> mulhi(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		// The high bytes of the products fit into 8 bits, so the saturating pack keeps them
+		auto lo = _mm256_srai_epi16(_mm256_mullo_epi16(detail::widen_lo_epi8(v1.m_vec), detail::widen_lo_epi8(v2.m_vec)), 8);
+		auto hi = _mm256_srai_epi16(_mm256_mullo_epi16(detail::widen_hi_epi8(v1.m_vec), detail::widen_hi_epi8(v2.m_vec)), 8);
+		return vector<std::int8_t, 32>(_mm256_packs_epi16(lo, hi));
+	}
+
+	vector<std::int8_t, 32> &vector<std::int8_t, 32>::operator&=(const vector<std::int8_t, 32> &v) {
+		m_vec = _mm256_and_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 32> &vector<std::int8_t, 32>::operator|=(const vector<std::int8_t, 32> &v) {
+		m_vec = _mm256_or_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 32> &vector<std::int8_t, 32>::operator^=(const vector<std::int8_t, 32> &v) {
+		m_vec = _mm256_xor_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 32> operator~(const vector<std::int8_t, 32> &v) {
+		return vector<std::int8_t, 32>(_mm256_xor_si256(v.m_vec, _mm256_set1_epi32(-1)));
+	}
+
+	vector<std::int8_t, 32> operator&(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::int8_t, 32> operator|(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::int8_t, 32> operator^(vector<std::int8_t, 32> v1, const vector<std::int8_t, 32> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::int8_t, 32> operator<<(const vector<std::int8_t, 32> &v, int bits) {
+		// Shift 16 bit lanes and clear the bits moved in from the neighbouring byte
+		const auto count = _mm_cvtsi32_si128(bits);
+		const auto keep = _mm256_set1_epi8(static_cast<char>(0xFF << bits));
+		return vector<std::int8_t, 32>(_mm256_and_si256(_mm256_sll_epi16(v.m_vec, count), keep));
+	}
+
+	vector<std::int8_t, 32> operator>>(const vector<std::int8_t, 32> &v, int bits) {
+		// Each byte in the high half of a 16 bit lane, shifted arithmetically by 8 more bits
+		const auto count = _mm_cvtsi32_si128(bits + 8);
+		auto lo = _mm256_sra_epi16(_mm256_unpacklo_epi8(v.m_vec, v.m_vec), count);
+		auto hi = _mm256_sra_epi16(_mm256_unpackhi_epi8(v.m_vec, v.m_vec), count);
+		return vector<std::int8_t, 32>(_mm256_packs_epi16(lo, hi));
+	}
+
+	vector<std::int8_t, 32> operator==(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		return vector<std::int8_t, 32>(_mm256_cmpeq_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 32> operator!=(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		// Invert because AVX2 doesn't have instruction for it
+		return vector<std::int8_t, 32>(_mm256_xor_si256(_mm256_cmpeq_epi8(v1.m_vec, v2.m_vec), _mm256_set1_epi32(-1)));
+	}
+
+	vector<std::int8_t, 32> operator>(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		return vector<std::int8_t, 32>(_mm256_cmpgt_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 32> operator>=(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		// Invert because AVX2 doesn't have instruction for it
+		return vector<std::int8_t, 32>(_mm256_xor_si256(_mm256_cmpgt_epi8(v2.m_vec, v1.m_vec), _mm256_set1_epi32(-1)));
+	}
+
+	vector<std::int8_t, 32> operator<(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		return vector<std::int8_t, 32>(_mm256_cmpgt_epi8(v2.m_vec, v1.m_vec));
+	}
+
+	vector<std::int8_t, 32> operator<=(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		// Invert because AVX2 doesn't have instruction for it
+		return vector<std::int8_t, 32>(_mm256_xor_si256(_mm256_cmpgt_epi8(v1.m_vec, v2.m_vec), _mm256_set1_epi32(-1)));
+	}
+
+	vector<std::int8_t, 32> &vector<std::int8_t, 32>::abs() {
+		m_vec = _mm256_abs_epi8(m_vec);
+		return *this;
+	}
+
+	vector<std::int8_t, 32> abs(vector<std::int8_t, 32> v) {
+		return v.abs();
+	}
+
+	vector<std::int8_t, 32> min(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		return vector<std::int8_t, 32>(_mm256_min_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 32> max(const vector<std::int8_t, 32> &v1, const vector<std::int8_t, 32> &v2) {
+		return vector<std::int8_t, 32>(_mm256_max_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::int8_t, 32> select(const vector<std::int8_t, 32> &v, const vector<std::int8_t, 32> &alt, const mask<std::int8_t, 32> &condition) {
+		return vector<std::int8_t, 32>(_mm256_blendv_epi8(alt.m_vec, v.m_vec, condition.native()));
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::int8_t, 32> &v) {
+		// Promoted, characters would be printed otherwise
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << +v.m_array[i] << ' ';
+		}
+		stream << +v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::int8_t, 32>::mask(const std::array<bool, width>& arr) {
+		std::array<type, width> lanes;
+		for(size_t i = 0; i < width; ++i)
+			lanes[i] = -static_cast<type>(arr[i]);
+		m_vec = _mm256_loadu_si256(reinterpret_cast<const native_type *>(lanes.data()));
+	}
+
+	mask<std::int8_t, 32> operator==(const mask<std::int8_t, 32> & v1, const mask<std::int8_t, 32> & v2) {
+		return mask<std::int8_t, 32>(_mm256_cmpeq_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::int8_t, 32> operator!=(const mask<std::int8_t, 32> & v1, const mask<std::int8_t, 32> & v2) {
+		return mask<std::int8_t, 32>(_mm256_xor_si256(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::int8_t, 32> & mask<std::int8_t, 32>::operator&=(const mask<std::int8_t, 32> & v) {
+		m_vec = _mm256_and_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::int8_t, 32> & mask<std::int8_t, 32>::operator|=(const mask<std::int8_t, 32> & v) {
+		m_vec = _mm256_or_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::int8_t, 32> & mask<std::int8_t, 32>::operator^=(const mask<std::int8_t, 32> & v) {
+		m_vec = _mm256_xor_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::int8_t, 32> operator~(const mask<std::int8_t, 32> & v) {
+		return mask<std::int8_t, 32>(_mm256_xor_si256(v.m_vec, _mm256_set1_epi32(-1)));
+	}
+
+	mask<std::int8_t, 32> operator&(mask<std::int8_t, 32> v1, const mask<std::int8_t, 32> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::int8_t, 32> operator|(mask<std::int8_t, 32> v1, const mask<std::int8_t, 32> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::int8_t, 32> operator^(mask<std::int8_t, 32> v1, const mask<std::int8_t, 32> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::int8_t, 32> andnot(const mask<std::int8_t, 32> & v1, const mask<std::int8_t, 32> & v2) {
+		return mask<std::int8_t, 32>(_mm256_andnot_si256(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::int8_t, 32> mask<std::int8_t, 32>::first_n(size_t count) {
+		const char n = static_cast<char>(count < width ? count : width);
+		return mask<std::int8_t, 32>(_mm256_cmpgt_epi8(_mm256_set1_epi8(n), _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+			16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31)));
+	}
+
+	int mask<std::int8_t, 32>::get_mask() const {
+		return _mm256_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::int8_t, 32>::all() const {
+		return _mm256_movemask_epi8(m_vec) == -1;
+	}
+
+	bool mask<std::int8_t, 32>::any() const {
+		return _mm256_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::int8_t, 32>::none() const {
+		return !_mm256_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstdint>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "float32x4.hpp"
+#include "float32x8.hpp"
+#include "float64x2.hpp"
+#include "float64x4.hpp"
+#include "int32x4.hpp"
+#include "int32x8.hpp"
+#include "int64x2.hpp"
+#include "int64x4.hpp"
+#include "float32x16.hpp"
+#include "float64x8.hpp"
+#include "int32x16.hpp"
+#include "int64x8.hpp"
+
+// Loads and stores of the lanes selected by a mask, so the tail of a loop can go through the same vector
+// code with mask<T, W>::first_n(remaining). Lanes outside the mask are neither read nor written, loads set
+// them to zero. AVX has vmaskmov for 128 and 256 bit vectors and AVX-512 masked moves for 512 bit vectors,
+// older instruction sets go through a full access when every lane is selected and single lanes otherwise.
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+		SIMD_FORCEINLINE vector<float, 4> load(const float *vals, const mask<float, 4> &condition) {
+			return vector<float, 4>(_mm_maskload_ps(vals, _mm_castps_si128(condition.native())));
+		}
+
+		SIMD_FORCEINLINE void store(float *vals, const vector<float, 4> &v, const mask<float, 4> &condition) {
+			_mm_maskstore_ps(vals, _mm_castps_si128(condition.native()), v.native());
+		}
+
+		SIMD_FORCEINLINE vector<double, 2> load(const double *vals, const mask<double, 2> &condition) {
+			return vector<double, 2>(_mm_maskload_pd(vals, _mm_castpd_si128(condition.native())));
+		}
+
+		SIMD_FORCEINLINE void store(double *vals, const vector<double, 2> &v, const mask<double, 2> &condition) {
+			_mm_maskstore_pd(vals, _mm_castpd_si128(condition.native()), v.native());
+		}
+
+		SIMD_FORCEINLINE vector<float, 8> load(const float *vals, const mask<float, 8> &condition) {
+			return vector<float, 8>(_mm256_maskload_ps(vals, _mm256_castps_si256(condition.native())));
+		}
+
+		SIMD_FORCEINLINE void store(float *vals, const vector<float, 8> &v, const mask<float, 8> &condition) {
+			_mm256_maskstore_ps(vals, _mm256_castps_si256(condition.native()), v.native());
+		}
+
+		SIMD_FORCEINLINE vector<double, 4> load(const double *vals, const mask<double, 4> &condition) {
+			return vector<double, 4>(_mm256_maskload_pd(vals, _mm256_castpd_si256(condition.native())));
+		}
+
+		SIMD_FORCEINLINE void store(double *vals, const vector<double, 4> &v, const mask<double, 4> &condition) {
+			_mm256_maskstore_pd(vals, _mm256_castpd_si256(condition.native()), v.native());
+		}
+
+		// AVX only has the floating point forms, which move the integers just the same
+		SIMD_FORCEINLINE vector<std::int32_t, 4> load(const std::int32_t *vals, const mask<std::int32_t, 4> &condition) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return vector<std::int32_t, 4>(_mm_maskload_epi32(reinterpret_cast<const int *>(vals), condition.native()));
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			return vector<std::int32_t, 4>(_mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float *>(vals), condition.native())));
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE void store(std::int32_t *vals, const vector<std::int32_t, 4> &v, const mask<std::int32_t, 4> &condition) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			_mm_maskstore_epi32(reinterpret_cast<int *>(vals), condition.native(), v.native());
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			_mm_maskstore_ps(reinterpret_cast<float *>(vals), condition.native(), _mm_castsi128_ps(v.native()));
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 2> load(const std::int64_t *vals, const mask<std::int64_t, 2> &condition) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return vector<std::int64_t, 2>(_mm_maskload_epi64(reinterpret_cast<const long long *>(vals), condition.native()));
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			return vector<std::int64_t, 2>(_mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double *>(vals), condition.native())));
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE void store(std::int64_t *vals, const vector<std::int64_t, 2> &v, const mask<std::int64_t, 2> &condition) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			_mm_maskstore_epi64(reinterpret_cast<long long *>(vals), condition.native(), v.native());
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			_mm_maskstore_pd(reinterpret_cast<double *>(vals), condition.native(), _mm_castsi128_pd(v.native()));
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+		SIMD_FORCEINLINE vector<std::int32_t, 8> load(const std::int32_t *vals, const mask<std::int32_t, 8> &condition) {
+			return vector<std::int32_t, 8>(_mm256_maskload_epi32(reinterpret_cast<const int *>(vals), condition.native()));
+		}
+
+		SIMD_FORCEINLINE void store(std::int32_t *vals, const vector<std::int32_t, 8> &v, const mask<std::int32_t, 8> &condition) {
+			_mm256_maskstore_epi32(reinterpret_cast<int *>(vals), condition.native(), v.native());
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 4> load(const std::int64_t *vals, const mask<std::int64_t, 4> &condition) {
+			return vector<std::int64_t, 4>(_mm256_maskload_epi64(reinterpret_cast<const long long *>(vals), condition.native()));
+		}
+
+		SIMD_FORCEINLINE void store(std::int64_t *vals, const vector<std::int64_t, 4> &v, const mask<std::int64_t, 4> &condition) {
+			_mm256_maskstore_epi64(reinterpret_cast<long long *>(vals), condition.native(), v.native());
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+		SIMD_FORCEINLINE vector<float, 16> load(const float *vals, const mask<float, 16> &condition) {
+			return vector<float, 16>(_mm512_maskz_loadu_ps(condition.native(), vals));
+		}
+
+		SIMD_FORCEINLINE void store(float *vals, const vector<float, 16> &v, const mask<float, 16> &condition) {
+			_mm512_mask_storeu_ps(vals, condition.native(), v.native());
+		}
+
+		SIMD_FORCEINLINE vector<double, 8> load(const double *vals, const mask<double, 8> &condition) {
+			return vector<double, 8>(_mm512_maskz_loadu_pd(condition.native(), vals));
+		}
+
+		SIMD_FORCEINLINE void store(double *vals, const vector<double, 8> &v, const mask<double, 8> &condition) {
+			_mm512_mask_storeu_pd(vals, condition.native(), v.native());
+		}
+
+		SIMD_FORCEINLINE vector<std::int32_t, 16> load(const std::int32_t *vals, const mask<std::int32_t, 16> &condition) {
+			return vector<std::int32_t, 16>(_mm512_maskz_loadu_epi32(condition.native(), vals));
+		}
+
+		SIMD_FORCEINLINE void store(std::int32_t *vals, const vector<std::int32_t, 16> &v, const mask<std::int32_t, 16> &condition) {
+			_mm512_mask_storeu_epi32(vals, condition.native(), v.native());
+		}
+
+		SIMD_FORCEINLINE vector<std::int64_t, 8> load(const std::int64_t *vals, const mask<std::int64_t, 8> &condition) {
+			return vector<std::int64_t, 8>(_mm512_maskz_loadu_epi64(condition.native(), vals));
+		}
+
+		SIMD_FORCEINLINE void store(std::int64_t *vals, const vector<std::int64_t, 8> &v, const mask<std::int64_t, 8> &condition) {
+			_mm512_mask_storeu_epi64(vals, condition.native(), v.native());
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+		// Native vectors without masked moves go through memory lane by lane (a full load followed by a blend
+		// could fault on the unselected lanes), composite vectors (composite.hpp) part by part
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> load(const T *vals, const mask<T, W> &condition);
+		template < class T, size_t W >
+		SIMD_FORCEINLINE void store(T *vals, const vector<T, W> &v, const mask<T, W> &condition);
+
+		template < class T, size_t W >
+		vector<T, W> load(const T *vals, const mask<T, W> &condition) {
+			if constexpr(W == 1) {
+				return vector<T, W>(condition.get_mask() ? vals[0] : T(0));
+			} else if constexpr(has_native_vector<T, W>::value) {
+				if(condition.all())
+					return vector<T, W>(vals);
+				alignas(64) T lanes[W] = {};
+				const int bits = condition.get_mask();
+				for(size_t i = 0; i < W; ++i)
+					if(lane_set<T, W>(bits, i))
+						lanes[i] = vals[i];
+				return vector<T, W>(lanes, aligned_load{});
+			} else {
+				vector<T, W> res;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					res.part(i) = detail::load(vals + i * vector<T, W>::part_width, condition.part(i));
+				return res;
+			}
+		}
+
+		template < class T, size_t W >
+		void store(T *vals, const vector<T, W> &v, const mask<T, W> &condition) {
+			if constexpr(W == 1) {
+				if(condition.get_mask())
+					vals[0] = v[0];
+			} else if constexpr(has_native_vector<T, W>::value) {
+				if(condition.all()) {
+					v.store(vals);
+					return;
+				}
+				alignas(64) T lanes[W];
+				v.store(lanes, aligned_store{});
+				const int bits = condition.get_mask();
+				for(size_t i = 0; i < W; ++i)
+					if(lane_set<T, W>(bits, i))
+						vals[i] = lanes[i];
+			} else {
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					detail::store(vals + i * vector<T, W>::part_width, v.part(i), condition.part(i));
+			}
+		}
+
+	} // namespace detail
+
+	// Loads the lanes selected by condition, the others are zero and their memory is not accessed
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> load(const T *vals, const mask<T, W> &condition) {
+		return detail::load(vals, condition);
+	}
+
+	// Stores the lanes selected by condition and leaves the memory of the others untouched
+	template < class T, size_t W >
+	SIMD_FORCEINLINE void store(T *vals, const vector<T, W> &v, const mask<T, W> &condition) {
+		detail::store(vals, v, condition);
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,557 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "float32x4.hpp"
+#include "float32x8.hpp"
+#include "float64x2.hpp"
+#include "float64x4.hpp"
+#include "float32x16.hpp"
+#include "float64x8.hpp"
+
+// Transcendental functions for the floating point vectors, evaluated with range reduction and polynomial
+// approximations instead of calling libm lane by lane. Maximum errors against the exact result, measured
+// over the whole domain unless stated otherwise (f = float, d = double lanes):
+//
+//   exp        f: 1 ulp     d: 1 ulp
+//   log        f: 1 ulp     d: 1 ulp
+//   sin, cos   f: 2.5 ulp   d: 1.5 ulp   |x| beyond 8192 (f) / 2^30 (d) is forwarded to std::sin / std::cos
+//   tan        f: 4 ulp     d: 4 ulp     same ranges as sin
+//   atan       f: 3 ulp     d: 1.5 ulp
+//   atan2      f: 3 ulp     d: 2 ulp
+//   erf        f: 2.5 ulp   d: 3 ulp
+//   pow        exp(y * log(x)), so the error grows with t = |y * log(x)| by about 1.5 ulp per unit:
+//              2 ulp for t < 1, 17 ulp for t < 10, 155 ulp for t < 100 (f and d)
+//
+// The variants in simd::fast skip the special values (infinities, NaN, subnormals) and the fallback for
+// large arguments. fast::exp and fast::log also use shorter polynomials, with relative errors below
+// 5e-6 (f) / 2e-12 (d).
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		// pow2i(n) = 2^n for integral n in the normal exponent range,
+		// split_exponent(x, e) = m with x = m * 2^e and m in [0.5, 1) for positive normal x
+#if SIMD_SUPPORTS(SIMD_SSE2)
+		SIMD_FORCEINLINE vector<float, 4> pow2i(const vector<float, 4> &n) {
+			const __m128i biased = _mm_add_epi32(_mm_cvtps_epi32(n.native()), _mm_set1_epi32(127));
+			return vector<float, 4>(_mm_castsi128_ps(_mm_slli_epi32(biased, 23)));
+		}
+
+		SIMD_FORCEINLINE vector<float, 4> split_exponent(const vector<float, 4> &x, vector<float, 4> &e) {
+			const __m128i bits = _mm_castps_si128(x.native());
+			e = vector<float, 4>(_mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126))));
+			return vector<float, 4>(_mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000))));
+		}
+
+		SIMD_FORCEINLINE vector<double, 2> pow2i(const vector<double, 2> &n) {
+			// The biased exponents are positive, so zero extending them to 64 bits is enough
+			const __m128i biased = _mm_add_epi32(_mm_cvtpd_epi32(n.native()), _mm_set1_epi32(1023));
+			return vector<double, 2>(_mm_castsi128_pd(_mm_slli_epi64(_mm_unpacklo_epi32(biased, _mm_setzero_si128()), 52)));
+		}
+
+		SIMD_FORCEINLINE vector<double, 2> split_exponent(const vector<double, 2> &x, vector<double, 2> &e) {
+			const __m128i bits = _mm_castpd_si128(x.native());
+			const __m128i exponent = _mm_shuffle_epi32(_mm_srli_epi64(bits, 52), _MM_SHUFFLE(3, 1, 2, 0));
+			e = vector<double, 2>(_mm_sub_pd(_mm_cvtepi32_pd(exponent), _mm_set1_pd(1022.0)));
+			return vector<double, 2>(_mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi64x(0x000fffffffffffff)),
+																   _mm_set1_epi64x(0x3fe0000000000000))));
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+		SIMD_FORCEINLINE vector<float, 8> pow2i(const vector<float, 8> &n) {
+			const __m256i biased = _mm256_add_epi32(_mm256_cvtps_epi32(n.native()), _mm256_set1_epi32(127));
+			return vector<float, 8>(_mm256_castsi256_ps(_mm256_slli_epi32(biased, 23)));
+		}
+
+		SIMD_FORCEINLINE vector<float, 8> split_exponent(const vector<float, 8> &x, vector<float, 8> &e) {
+			const __m256i bits = _mm256_castps_si256(x.native());
+			e = vector<float, 8>(_mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126))));
+			return vector<float, 8>(_mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)),
+																		_mm256_set1_epi32(0x3f000000))));
+		}
+
+		SIMD_FORCEINLINE vector<double, 4> pow2i(const vector<double, 4> &n) {
+			const __m128i biased = _mm_add_epi32(_mm256_cvtpd_epi32(n.native()), _mm_set1_epi32(1023));
+			return vector<double, 4>(_mm256_castsi256_pd(_mm256_slli_epi64(_mm256_cvtepu32_epi64(biased), 52)));
+		}
+
+		SIMD_FORCEINLINE vector<double, 4> split_exponent(const vector<double, 4> &x, vector<double, 4> &e) {
+			const __m256i bits = _mm256_castpd_si256(x.native());
+			const __m256i exponent = _mm256_permutevar8x32_epi32(_mm256_srli_epi64(bits, 52), _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+			e = vector<double, 4>(_mm256_sub_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(exponent)), _mm256_set1_pd(1022.0)));
+			return vector<double, 4>(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffff)),
+																		 _mm256_set1_epi64x(0x3fe0000000000000))));
+		}
+#elif SIMD_SUPPORTS(SIMD_AVX)
+		// No 256 bit integer instructions, so the halves go through the SSE2 versions
+		SIMD_FORCEINLINE vector<float, 8> pow2i(const vector<float, 8> &n) {
+			const auto lo = pow2i(vector<float, 4>(_mm256_castps256_ps128(n.native())));
+			const auto hi = pow2i(vector<float, 4>(_mm256_extractf128_ps(n.native(), 1)));
+			return vector<float, 8>(_mm256_insertf128_ps(_mm256_castps128_ps256(lo.native()), hi.native(), 1));
+		}
+
+		SIMD_FORCEINLINE vector<float, 8> split_exponent(const vector<float, 8> &x, vector<float, 8> &e) {
+			vector<float, 4> e_lo, e_hi;
+			const auto lo = split_exponent(vector<float, 4>(_mm256_castps256_ps128(x.native())), e_lo);
+			const auto hi = split_exponent(vector<float, 4>(_mm256_extractf128_ps(x.native(), 1)), e_hi);
+			e = vector<float, 8>(_mm256_insertf128_ps(_mm256_castps128_ps256(e_lo.native()), e_hi.native(), 1));
+			return vector<float, 8>(_mm256_insertf128_ps(_mm256_castps128_ps256(lo.native()), hi.native(), 1));
+		}
+
+		SIMD_FORCEINLINE vector<double, 4> pow2i(const vector<double, 4> &n) {
+			const auto lo = pow2i(vector<double, 2>(_mm256_castpd256_pd128(n.native())));
+			const auto hi = pow2i(vector<double, 2>(_mm256_extractf128_pd(n.native(), 1)));
+			return vector<double, 4>(_mm256_insertf128_pd(_mm256_castpd128_pd256(lo.native()), hi.native(), 1));
+		}
+
+		SIMD_FORCEINLINE vector<double, 4> split_exponent(const vector<double, 4> &x, vector<double, 4> &e) {
+			vector<double, 2> e_lo, e_hi;
+			const auto lo = split_exponent(vector<double, 2>(_mm256_castpd256_pd128(x.native())), e_lo);
+			const auto hi = split_exponent(vector<double, 2>(_mm256_extractf128_pd(x.native(), 1)), e_hi);
+			e = vector<double, 4>(_mm256_insertf128_pd(_mm256_castpd128_pd256(e_lo.native()), e_hi.native(), 1));
+			return vector<double, 4>(_mm256_insertf128_pd(_mm256_castpd128_pd256(lo.native()), hi.native(), 1));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+		SIMD_FORCEINLINE vector<float, 16> pow2i(const vector<float, 16> &n) {
+			return vector<float, 16>(_mm512_scalef_ps(_mm512_set1_ps(1.f), n.native()));
+		}
+
+		SIMD_FORCEINLINE vector<float, 16> split_exponent(const vector<float, 16> &x, vector<float, 16> &e) {
+			e = vector<float, 16>(_mm512_add_ps(_mm512_getexp_ps(x.native()), _mm512_set1_ps(1.f)));
+			return vector<float, 16>(_mm512_getmant_ps(x.native(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero));
+		}
+
+		SIMD_FORCEINLINE vector<double, 8> pow2i(const vector<double, 8> &n) {
+			return vector<double, 8>(_mm512_scalef_pd(_mm512_set1_pd(1.0), n.native()));
+		}
+
+		SIMD_FORCEINLINE vector<double, 8> split_exponent(const vector<double, 8> &x, vector<double, 8> &e) {
+			e = vector<double, 8>(_mm512_add_pd(_mm512_getexp_pd(x.native()), _mm512_set1_pd(1.0)));
+			return vector<double, 8>(_mm512_getmant_pd(x.native(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+		// Composite vectors go part by part, everything else lane by lane
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> pow2i(const vector<T, W> &n) {
+			vector<T, W> res;
+			if constexpr(W > 1 && !has_native_vector<T, W>::value) {
+				for(size_t i = 0; i < res.part_count; ++i)
+					res.part(i) = pow2i(n.part(i));
+			} else {
+				for(size_t i = 0; i < W; ++i)
+					res[i] = std::exp2(n[i]);
+			}
+			return res;
+		}
+
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> split_exponent(const vector<T, W> &x, vector<T, W> &e) {
+			vector<T, W> res;
+			if constexpr(W > 1 && !has_native_vector<T, W>::value) {
+				for(size_t i = 0; i < res.part_count; ++i)
+					res.part(i) = split_exponent(x.part(i), e.part(i));
+			} else {
+				for(size_t i = 0; i < W; ++i) {
+					int exponent = 0;
+					res[i] = std::frexp(x[i], &exponent);
+					e[i] = static_cast<T>(exponent);
+				}
+			}
+			return res;
+		}
+
+		template < class T, size_t W, class F >
+		SIMD_FORCEINLINE vector<T, W> apply_lanes(vector<T, W> v, F f) {
+			for(size_t i = 0; i < W; ++i)
+				v[i] = f(v[i]);
+			return v;
+		}
+
+		// Horner scheme, coefficients from the highest power down to the constant term
+		template < class V >
+		SIMD_FORCEINLINE V horner(const V &, const V &acc) {
+			return acc;
+		}
+
+		template < class V, class C, class... Cs >
+		SIMD_FORCEINLINE V horner(const V &x, const V &acc, C c, Cs... cs) {
+			return horner(x, fmadd(acc, x, V(static_cast<typename V::type>(c))), cs...);
+		}
+
+		template < class V, class C, class... Cs >
+		SIMD_FORCEINLINE V polynomial(const V &x, C c, Cs... cs) {
+			return horner(x, V(static_cast<typename V::type>(c)), cs...);
+		}
+
+		// ~a & b for comparison results, which are vectors or masks depending on the type
+		template < class M >
+		SIMD_FORCEINLINE M andnot_cond(const M &a, const M &b) {
+			return ~a & b;
+		}
+
+		template < class V >
+		SIMD_FORCEINLINE V sign_bit() {
+			return V(static_cast<typename V::type>(-0.0));
+		}
+
+		// e^r for |r| <= ln(2) / 2
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> exp_reduced(const vector<T, W> &r) {
+			using V = vector<T, W>;
+			V p;
+			if constexpr(std::is_same_v<T, float>) {
+				p = polynomial(r, 1.9875691500e-4, 1.3981999507e-3, 8.3334519073e-3, 4.1665795894e-2, 1.6666665459e-1, 5.0000001201e-1);
+			} else {
+				// Taylor series up to r^13
+				p = polynomial(r, 1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0,
+							   1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 0.5);
+			}
+			return V(T(1)) + fmadd(p, r * r, r);
+		}
+
+		// Splits x = r + n * ln(2) with integral n
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> reduce_ln2(const vector<T, W> &x, vector<T, W> &n) {
+			using V = vector<T, W>;
+			n = round(x * V(static_cast<T>(1.44269504088896340736)), 0);
+			// ln(2) in two parts, the first one has enough trailing zeros to make n * ln2_hi exact
+			if constexpr(std::is_same_v<T, float>)
+				return fnmadd(n, V(-2.12194440e-4f), fnmadd(n, V(0.693359375f), x));
+			else
+				return fnmadd(n, V(1.90821492927058770002e-10), fnmadd(n, V(6.93147180369123816490e-01), x));
+		}
+
+		// log(x) for positive normal x
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> log_normal(const vector<T, W> &x) {
+			using V = vector<T, W>;
+			V e;
+			V m = split_exponent(x, e);
+			// Moves m into [sqrt(0.5), sqrt(2)) to keep f = m - 1 small
+			const auto small = m < V(static_cast<T>(0.70710678118654752440));
+			e = e - select(V(T(1)), V(T(0)), small);
+			const V f = m + select(m, V(T(0)), small) - V(T(1));
+			if constexpr(std::is_same_v<T, float>) {
+				const V z = f * f;
+				V y = f * z * polynomial(f, 7.0376836292e-2, -1.1514610310e-1, 1.1676998740e-1, -1.2420140846e-1,
+										 1.4249322787e-1, -1.6668057665e-1, 2.0000714765e-1, -2.4999993993e-1, 3.3333331174e-1);
+				y = fmadd(e, V(-2.12194440e-4f), y);
+				y = fnmadd(V(0.5f), z, y);
+				return fmadd(e, V(0.693359375f), f + y);
+			} else {
+				// log(1 + f) = 2 atanh(s) with s = f / (2 + f)
+				const V s = f / (V(T(2)) + f);
+				const V z = s * s;
+				const V r = z * polynomial(z, 1.479819860511658591e-01, 1.531383769920937332e-01, 1.818357216161805012e-01,
+										   2.222219843214978396e-01, 2.857142874366239149e-01, 3.999999999940941908e-01, 6.666666666666735130e-01);
+				const V hfsq = V(0.5) * f * f;
+				const V lo = fmadd(s, hfsq + r, e * V(1.90821492927058770002e-10));
+				return fmsub(e, V(6.93147180369123816490e-01), (hfsq - lo) - f);
+			}
+		}
+
+		// Splits x = r + q * pi / 2 with integral q and |r| <= pi / 4. Accurate up to 8192 (float)
+		// and 2^30 (double), where q times the parts of pi / 2 stops being exact.
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> reduce_half_pi(const vector<T, W> &x, vector<T, W> &q) {
+			using V = vector<T, W>;
+			q = round(x * V(static_cast<T>(0.63661977236758134308)), 0);
+			if constexpr(std::is_same_v<T, float>) {
+				// Parts of at most 11 bits, so that q * part is exact even without FMA
+				V r = fnmadd(q, V(1.5703125f), x);
+				r = fnmadd(q, V(4.837512969970703125e-4f), r);
+				r = fnmadd(q, V(7.549533620476723e-8f), r);
+				r = fnmadd(q, V(2.5632829192545614e-12f), r);
+				return fnmadd(q, V(6.123234262925839e-17f), r);
+			} else {
+				V r = fnmadd(q, V(1.57079625129699707031e+00), x);
+				r = fnmadd(q, V(7.54978941586159635335e-08), r);
+				return fnmadd(q, V(5.39030285815811905290e-15), r);
+			}
+		}
+
+		template < class T >
+		constexpr T reduce_half_pi_limit = std::is_same_v<T, float> ? T(8192) : T(1073741824.0);
+
+		// sin(r) and cos(r) for |r| <= pi / 4
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> sin_reduced(const vector<T, W> &r) {
+			using V = vector<T, W>;
+			const V z = r * r;
+			if constexpr(std::is_same_v<T, float>)
+				return fmadd(polynomial(z, -1.9515295891e-4, 8.3321608736e-3, -1.6666654611e-1) * z, r, r);
+			else
+				return fmadd(polynomial(z, 1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6,
+										-1.98412698295895385996e-4, 8.33333333332211858878e-3, -1.66666666666666307295e-1) * z, r, r);
+		}
+
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> cos_reduced(const vector<T, W> &r) {
+			using V = vector<T, W>;
+			const V z = r * r;
+			V p;
+			if constexpr(std::is_same_v<T, float>)
+				p = polynomial(z, 2.443315711809948e-5, -1.388731625493765e-3, 4.166664568298827e-2);
+			else
+				p = polynomial(z, -1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7,
+							   2.48015872888517045348e-5, -1.38888888888730564116e-3, 4.16666666666665929218e-2);
+			return fmadd(p * z, z, fnmadd(V(static_cast<T>(0.5)), z, V(T(1))));
+		}
+
+		// Whether the integral q is odd
+		template < class T, size_t W >
+		SIMD_FORCEINLINE auto is_odd(const vector<T, W> &q) {
+			using V = vector<T, W>;
+			return fnmadd(V(T(2)), floor(q * V(static_cast<T>(0.5))), q) != V(T(0));
+		}
+
+		// sin(x) for quadrant offset 0, cos(x) for offset 1
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> sin_quadrant(const vector<T, W> &x, T offset) {
+			using V = vector<T, W>;
+			V q;
+			const V r = reduce_half_pi(x, q);
+			q = q + V(offset);
+			const V res = select(cos_reduced(r), sin_reduced(r), is_odd(q));
+			// Quadrants 2 and 3 are negated
+			return res ^ select(sign_bit<V>(), V(T(0)), is_odd(floor(q * V(static_cast<T>(0.5)))));
+		}
+
+		// atan(x) for x >= 0
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> atan_positive(const vector<T, W> &x) {
+			using V = vector<T, W>;
+			// atan(x) = pi / 2 + atan(-1 / x) above tan(3 pi / 8), pi / 4 + atan((x - 1) / (x + 1)) above the second bound
+			const auto big = x > V(static_cast<T>(2.41421356237309504880));
+			const auto medium = andnot_cond(big, x > V(std::is_same_v<T, float> ? T(0.41421356237309504880) : T(0.66)));
+			const V num = select(V(T(-1)), select(x - V(T(1)), x, medium), big);
+			const V den = select(x, select(x + V(T(1)), V(T(1)), medium), big);
+			const V y = num / den;
+			const V z = y * y;
+			V offset = select(V(static_cast<T>(1.57079632679489661923)), select(V(static_cast<T>(0.78539816339744830962)), V(T(0)), medium), big);
+			if constexpr(std::is_same_v<T, float>) {
+				return offset + fmadd(polynomial(z, 8.05374449538e-2, -1.38776856032e-1, 1.99777106478e-1, -3.33329491539e-1) * z, y, y);
+			} else {
+				// The offsets lack the bits of pi beyond double precision, added back separately
+				offset = offset + select(V(6.123233995736765886130e-17), select(V(3.061616997868382943065e-17), V(T(0)), medium), big);
+				const V p = polynomial(z, -8.750608600031904122785e-1, -1.615753718733365076637e1, -7.500855792314704667340e1,
+									   -1.228866684490136173410e2, -6.485021904942025371773e1);
+				const V q = polynomial(z, 1.0, 2.485846490142306297962e1, 1.650270098316988542046e2, 4.328810604912902668951e2,
+									   4.853903996359136964868e2, 1.945506571482613964425e2);
+				return offset + fmadd(z * p / q, y, y);
+			}
+		}
+
+	} // namespace detail
+
+	template < class T, size_t W >
+	vector<T, W> exp(const vector<T, W> &x) {
+		static_assert(std::is_floating_point_v<T>, "exp requires floating point lanes");
+		using V = vector<T, W>;
+		// Beyond these bounds the result over- or underflows anyway
+		const V lo(std::is_same_v<T, float> ? T(-104) : T(-746));
+		const V hi(std::is_same_v<T, float> ? T(89) : T(710));
+		V n;
+		const V r = detail::reduce_ln2(min(max(x, lo), hi), n);
+		// Scaling in two steps allows subnormal and infinite results
+		const V n1 = floor(n * V(static_cast<T>(0.5)));
+		const V res = detail::exp_reduced(r) * detail::pow2i(n1) * detail::pow2i(n - n1);
+		return select(res, x, x == x);
+	}
+
+	template < class T, size_t W >
+	vector<T, W> log(const vector<T, W> &x) {
+		static_assert(std::is_floating_point_v<T>, "log requires floating point lanes");
+		using V = vector<T, W>;
+		using limits = std::numeric_limits<T>;
+		// Subnormals are scaled into the normal range first
+		const T scale = std::is_same_v<T, float> ? T(16777216.0) : T(18014398509481984.0);
+		const T scale_log = std::is_same_v<T, float> ? T(16.6355323334) : T(37.429947750237046);
+		const auto subnormal = x < V(limits::min());
+		V res = detail::log_normal(select(x * V(scale), x, subnormal)) - select(V(scale_log), V(T(0)), subnormal);
+		res = select(V(-limits::infinity()), res, x == V(T(0)));
+		res = select(V(limits::quiet_NaN()), res, x < V(T(0)));
+		// +inf and NaN are returned as they are
+		return select(res, x, x < V(limits::infinity()));
+	}
+
+	template < class T, size_t W >
+	vector<T, W> sin(const vector<T, W> &x) {
+		static_assert(std::is_floating_point_v<T>, "sin requires floating point lanes");
+		using V = vector<T, W>;
+		if(mask<T, W>(abs(x) > V(detail::reduce_half_pi_limit<T>)).any())
+			return detail::apply_lanes(x, [](T v) { return std::sin(v); });
+		return detail::sin_quadrant(x, T(0));
+	}
+
+	template < class T, size_t W >
+	vector<T, W> cos(const vector<T, W> &x) {
+		static_assert(std::is_floating_point_v<T>, "cos requires floating point lanes");
+		using V = vector<T, W>;
+		if(mask<T, W>(abs(x) > V(detail::reduce_half_pi_limit<T>)).any())
+			return detail::apply_lanes(x, [](T v) { return std::cos(v); });
+		return detail::sin_quadrant(x, T(1));
+	}
+
+	template < class T, size_t W >
+	vector<T, W> tan(const vector<T, W> &x) {
+		static_assert(std::is_floating_point_v<T>, "tan requires floating point lanes");
+		using V = vector<T, W>;
+		if(mask<T, W>(abs(x) > V(detail::reduce_half_pi_limit<T>)).any())
+			return detail::apply_lanes(x, [](T v) { return std::tan(v); });
+		V q;
+		const V r = detail::reduce_half_pi(x, q);
+		const V s = detail::sin_reduced(r);
+		const V c = detail::cos_reduced(r);
+		// tan(r + pi / 2) = -cos(r) / sin(r)
+		const auto odd = detail::is_odd(q);
+		return select(c ^ detail::sign_bit<V>(), s, odd) / select(s, c, odd);
+	}
+
+	template < class T, size_t W >
+	vector<T, W> atan(const vector<T, W> &x) {
+		static_assert(std::is_floating_point_v<T>, "atan requires floating point lanes");
+		using V = vector<T, W>;
+		const V sign = x & detail::sign_bit<V>();
+		return detail::atan_positive(x ^ sign) ^ sign;
+	}
+
+	template < class T, size_t W >
+	vector<T, W> atan2(const vector<T, W> &y, const vector<T, W> &x) {
+		static_assert(std::is_floating_point_v<T>, "atan2 requires floating point lanes");
+		using V = vector<T, W>;
+		using limits = std::numeric_limits<T>;
+		const V ax = abs(x);
+		const V ay = abs(y);
+		// atan of the ratio in [0, 1], with 0 / 0 and inf / inf defined as 0 and 1
+		const V lo = min(ax, ay);
+		const V hi = max(ax, ay);
+		V t = select(V(T(0)), lo / hi, hi == V(T(0)));
+		t = select(V(T(1)), t, lo == V(limits::infinity()));
+		V res = detail::atan_positive(t);
+		res = select(V(static_cast<T>(1.57079632679489661923)) - res, res, ay > ax);
+		// Negative x, including -0, mirrors to the left half plane
+		const V x_sign = x & detail::sign_bit<V>();
+		res = select(V(static_cast<T>(3.14159265358979323846)) - res, res, (x_sign | V(T(1))) < V(T(0)));
+		res = res | (y & detail::sign_bit<V>());
+		return select(res, x + y, (x == x) & (y == y));
+	}
+
+	template < class T, size_t W >
+	vector<T, W> pow(const vector<T, W> &x, const vector<T, W> &y) {
+		static_assert(std::is_floating_point_v<T>, "pow requires floating point lanes");
+		using V = vector<T, W>;
+		using limits = std::numeric_limits<T>;
+		const V ax = abs(x);
+		V res = exp(y * log(ax));
+		// Negative bases only have real powers for integral exponents, odd ones keep the sign
+		const auto integral = round(y, 0) == y;
+		const V half_y = y * V(static_cast<T>(0.5));
+		const auto odd = integral & (round(half_y, 0) != half_y);
+		res = res ^ select(x & detail::sign_bit<V>(), V(T(0)), odd);
+		res = select(V(limits::quiet_NaN()), res, detail::andnot_cond(integral, (x < V(T(0))) & (x > V(-limits::infinity()))));
+		// pow(x, 0), pow(1, y) and pow(-1, +-inf) are 1 even for NaN arguments
+		const auto one = (y == V(T(0))) | (x == V(T(1))) | ((ax == V(T(1))) & (abs(y) == V(limits::infinity())));
+		return select(V(T(1)), res, one);
+	}
+
+	template < class T, size_t W >
+	vector<T, W> erf(const vector<T, W> &x) {
+		static_assert(std::is_floating_point_v<T>, "erf requires floating point lanes");
+		using V = vector<T, W>;
+		const V sign = x & detail::sign_bit<V>();
+		// erf(x) rounds to 1 beyond the upper bound
+		const V ax = min(x ^ sign, V(std::is_same_v<T, float> ? T(4) : T(6)));
+		const V z = ax * ax;
+		V small, big;
+		if constexpr(std::is_same_v<T, float>) {
+			small = ax * detail::polynomial(z, 7.853861353153693e-5, -8.010193625184903e-4, 5.188327685732524e-3,
+											-2.685381193529856e-2, 1.128358514861418e-1, -3.761262582423300e-1, 1.128379165726710e0);
+			// erfc(x) = exp(-x^2) * P(1 / x)
+			big = V(T(1)) - exp(V(T(0)) - z) * detail::polynomial(V(T(1)) / ax, 0.025032543253128068, -0.1478984450041981, 0.3608618613420344,
+															  -0.42983374993482565, 0.14547734879766663, 0.2825897930696084, -0.39485958770293583,
+															  0.02484752120200879, 0.561214637996948, 0.00015165568539201162);
+		} else {
+			small = ax * detail::polynomial(z, 9.60497373987051638749e0, 9.00260197203842689217e1, 2.23200534594684319226e3,
+											7.00332514112805075473e3, 5.55923013010394962768e4)
+				/ detail::polynomial(z, 1.0, 3.35617141647503099647e1, 5.21357949780152679795e2, 4.59432382970980127987e3,
+									 2.26290000613890934246e4, 4.92673942608635921086e4);
+			// erfc(x) = exp(-x^2) * P(x) / Q(x)
+			big = V(T(1)) - exp(V(T(0)) - z) * detail::polynomial(ax, 2.46196981473530512524e-10, 5.64189564831068821977e-1, 7.46321056442269912687e0,
+															 4.86371970985681366614e1, 1.96520832956077098242e2, 5.26445194995477358631e2,
+															 9.34528527171957607540e2, 1.02755188689515710272e3, 5.57535335369399327526e2)
+				/ detail::polynomial(ax, 1.0, 1.32281951154744992508e1, 8.67072140885989742329e1, 3.54937778887819891062e2,
+									 9.75708501743205489753e2, 1.82390916687909736289e3, 2.24633760818710981792e3,
+									 1.65666309194161350182e3, 5.57535340817727675546e2);
+		}
+		const V res = select(small, big, ax < V(T(1)));
+		return select(res ^ sign, x, x == x);
+	}
+
+	namespace fast {
+
+		// Inputs in [-87, 88] (float) / [-708, 709] (double), where the result is a normal number
+		template < class T, size_t W >
+		vector<T, W> exp(const vector<T, W> &x) {
+			static_assert(std::is_floating_point_v<T>, "exp requires floating point lanes");
+			using V = vector<T, W>;
+			V n;
+			const V r = detail::reduce_ln2(x, n);
+			V p;
+			if constexpr(std::is_same_v<T, float>)
+				p = detail::polynomial(r, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 0.5);
+			else
+				p = detail::polynomial(r, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0,
+									   1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 0.5);
+			return (V(T(1)) + fmadd(p, r * r, r)) * detail::pow2i(n);
+		}
+
+		// Positive normal inputs
+		template < class T, size_t W >
+		vector<T, W> log(const vector<T, W> &x) {
+			static_assert(std::is_floating_point_v<T>, "log requires floating point lanes");
+			using V = vector<T, W>;
+			V e;
+			const V m = detail::split_exponent(x, e);
+			const auto small = m < V(static_cast<T>(0.70710678118654752440));
+			e = e - select(V(T(1)), V(T(0)), small);
+			const V f = m + select(m, V(T(0)), small) - V(T(1));
+			// log(1 + f) = 2 atanh(s) with s = f / (2 + f)
+			const V s = f / (V(T(2)) + f);
+			const V z = s * s;
+			V p;
+			if constexpr(std::is_same_v<T, float>)
+				p = detail::polynomial(z, 2.0 / 7.0, 2.0 / 5.0, 2.0 / 3.0, 2.0);
+			else
+				p = detail::polynomial(z, 2.0 / 13.0, 2.0 / 11.0, 2.0 / 9.0, 2.0 / 7.0, 2.0 / 5.0, 2.0 / 3.0, 2.0);
+			return fmadd(e, V(static_cast<T>(0.69314718055994530942)), s * p);
+		}
+
+		// Inputs up to 8192 (float) / 2^30 (double) in magnitude
+		template < class T, size_t W >
+		vector<T, W> sin(const vector<T, W> &x) {
+			static_assert(std::is_floating_point_v<T>, "sin requires floating point lanes");
+			return detail::sin_quadrant(x, T(0));
+		}
+
+		template < class T, size_t W >
+		vector<T, W> cos(const vector<T, W> &x) {
+			static_assert(std::is_floating_point_v<T>, "cos requires floating point lanes");
+			return detail::sin_quadrant(x, T(1));
+		}
+
+	} // namespace fast
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
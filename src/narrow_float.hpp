@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+
+// The parts float16.hpp and bfloat16.hpp have in common: 16 bit floats in memory are only loaded into and
+// stored from vector<float, W>. The formats provide their conversions of a single value and kernels for the
+// native widths, narrow_float<S> picks between them and splits composite vectors and whole arrays.
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		template < class S >
+		struct narrow_float {
+			static_assert(sizeof(S) == sizeof(std::uint16_t), "16 bit float arrays have to be packed");
+
+			// W values widened to float with widen(h), composite vectors part by part with load(std::integral_constant<size_t, P>, src)
+			template < size_t W, class Load, class Widen >
+			static SIMD_FORCEINLINE vector<float, W> load(const S *src, Load load, Widen widen) {
+				if constexpr(W == 1 || has_native_vector<float, W>::value) {
+					std::array<float, W> vals;
+					for(size_t i = 0; i < W; ++i)
+						vals[i] = widen(src[i]);
+					return vector<float, W>(vals);
+				} else {
+					constexpr size_t pw = vector<float, W>::part_width;
+					vector<float, W> res;
+					for(size_t i = 0; i < vector<float, W>::part_count; ++i)
+						res.part(i) = load(std::integral_constant<size_t, pw>(), src + i * pw);
+					return res;
+				}
+			}
+
+			// Narrowed with narrow(f), composite vectors part by part with store(dst, part)
+			template < size_t W, class Store, class Narrow >
+			static SIMD_FORCEINLINE void store(S *dst, const vector<float, W> &v, Store store, Narrow narrow) {
+				if constexpr(W == 1 || has_native_vector<float, W>::value) {
+					std::array<float, W> vals;
+					v.store(vals.data());
+					for(size_t i = 0; i < W; ++i)
+						dst[i] = narrow(vals[i]);
+				} else {
+					constexpr size_t pw = vector<float, W>::part_width;
+					for(size_t i = 0; i < vector<float, W>::part_count; ++i)
+						store(dst + i * pw, v.part(i));
+				}
+			}
+
+			// Whole arrays, a native register at a time and the remaining values one by one
+			template < class Load, class Widen >
+			static void to_float(const S *src, float *dst, size_t count, Load load, Widen widen) {
+				constexpr size_t W = native_part_width<float, 16>::value;
+				size_t i = 0;
+				for(; i + W <= count; i += W)
+					load(std::integral_constant<size_t, W>(), src + i).store(dst + i);
+				for(; i < count; ++i)
+					dst[i] = widen(src[i]);
+			}
+
+			template < class Store, class Narrow >
+			static void from_float(const float *src, S *dst, size_t count, Store store, Narrow narrow) {
+				constexpr size_t W = native_part_width<float, 16>::value;
+				size_t i = 0;
+				for(; i + W <= count; i += W)
+					store(dst + i, vector<float, W>(src + i));
+				for(; i < count; ++i)
+					dst[i] = narrow(src[i]);
+			}
+		};
+
+	} // namespace detail
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include "shuffle.hpp"
+#include "int8x16.hpp"
+#include "int8x32.hpp"
+#include "int16x8.hpp"
+#include "int16x16.hpp"
+#include "uint8x16.hpp"
+#include "uint8x32.hpp"
+#include "uint16x8.hpp"
+#include "uint16x16.hpp"
+#include "uint32x4.hpp"
+#include "uint32x8.hpp"
+#include "uint64x2.hpp"
+#include "uint64x4.hpp"
+
+// Horizontal reductions of all lanes to a scalar. Vectors wider than 128 bits are folded in halves until a
+// single register is left (composite vectors part by part), which is then folded with in-register shuffles,
+// so a reduction of W lanes takes log2(W) operations instead of a chain of hadd.
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+		SIMD_FORCEINLINE std::pair<vector<float, 4>, vector<float, 4>> halves(const vector<float, 8> &v) {
+			return { vector<float, 4>(_mm256_castps256_ps128(v.native())), vector<float, 4>(_mm256_extractf128_ps(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<double, 2>, vector<double, 2>> halves(const vector<double, 4> &v) {
+			return { vector<double, 2>(_mm256_castpd256_pd128(v.native())), vector<double, 2>(_mm256_extractf128_pd(v.native(), 1)) };
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+		SIMD_FORCEINLINE std::pair<vector<std::int32_t, 4>, vector<std::int32_t, 4>> halves(const vector<std::int32_t, 8> &v) {
+			return { vector<std::int32_t, 4>(_mm256_castsi256_si128(v.native())), vector<std::int32_t, 4>(_mm256_extracti128_si256(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::int64_t, 2>, vector<std::int64_t, 2>> halves(const vector<std::int64_t, 4> &v) {
+			return { vector<std::int64_t, 2>(_mm256_castsi256_si128(v.native())), vector<std::int64_t, 2>(_mm256_extracti128_si256(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::int8_t, 16>, vector<std::int8_t, 16>> halves(const vector<std::int8_t, 32> &v) {
+			return { vector<std::int8_t, 16>(_mm256_castsi256_si128(v.native())), vector<std::int8_t, 16>(_mm256_extracti128_si256(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::int16_t, 8>, vector<std::int16_t, 8>> halves(const vector<std::int16_t, 16> &v) {
+			return { vector<std::int16_t, 8>(_mm256_castsi256_si128(v.native())), vector<std::int16_t, 8>(_mm256_extracti128_si256(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::uint8_t, 16>, vector<std::uint8_t, 16>> halves(const vector<std::uint8_t, 32> &v) {
+			return { vector<std::uint8_t, 16>(_mm256_castsi256_si128(v.native())), vector<std::uint8_t, 16>(_mm256_extracti128_si256(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::uint16_t, 8>, vector<std::uint16_t, 8>> halves(const vector<std::uint16_t, 16> &v) {
+			return { vector<std::uint16_t, 8>(_mm256_castsi256_si128(v.native())), vector<std::uint16_t, 8>(_mm256_extracti128_si256(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::uint32_t, 4>, vector<std::uint32_t, 4>> halves(const vector<std::uint32_t, 8> &v) {
+			return { vector<std::uint32_t, 4>(_mm256_castsi256_si128(v.native())), vector<std::uint32_t, 4>(_mm256_extracti128_si256(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::uint64_t, 2>, vector<std::uint64_t, 2>> halves(const vector<std::uint64_t, 4> &v) {
+			return { vector<std::uint64_t, 2>(_mm256_castsi256_si128(v.native())), vector<std::uint64_t, 2>(_mm256_extracti128_si256(v.native(), 1)) };
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+		SIMD_FORCEINLINE std::pair<vector<float, 8>, vector<float, 8>> halves(const vector<float, 16> &v) {
+			return { vector<float, 8>(_mm512_castps512_ps256(v.native())),
+					 vector<float, 8>(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v.native()), 1))) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<double, 4>, vector<double, 4>> halves(const vector<double, 8> &v) {
+			return { vector<double, 4>(_mm512_castpd512_pd256(v.native())), vector<double, 4>(_mm512_extractf64x4_pd(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::int32_t, 8>, vector<std::int32_t, 8>> halves(const vector<std::int32_t, 16> &v) {
+			return { vector<std::int32_t, 8>(_mm512_castsi512_si256(v.native())), vector<std::int32_t, 8>(_mm512_extracti64x4_epi64(v.native(), 1)) };
+		}
+
+		SIMD_FORCEINLINE std::pair<vector<std::int64_t, 4>, vector<std::int64_t, 4>> halves(const vector<std::int64_t, 8> &v) {
+			return { vector<std::int64_t, 4>(_mm512_castsi512_si256(v.native())), vector<std::int64_t, 4>(_mm512_extracti64x4_epi64(v.native(), 1)) };
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+		// Only defined for the native vectors wider than 128 bits above
+		template < class T, size_t W >
+		std::pair<vector<T, W / 2>, vector<T, W / 2>> halves(const vector<T, W> &v);
+
+		template < class T, size_t W, class F >
+		SIMD_FORCEINLINE T reduce(const vector<T, W> &v, F f);
+
+		// Folds the upper lanes onto the lower ones within a 128 bit register
+		template < size_t N, class T, size_t W, class F >
+		SIMD_FORCEINLINE T reduce_in_register(const vector<T, W> &v, F f) {
+			if constexpr(N == 1) {
+				return simd::extract<0>(v);
+			} else {
+				return detail::reduce_in_register<N / 2>(f(v, simd::rotate_lanes<static_cast<int>(N / 2)>(v)), f);
+			}
+		}
+
+		template < class T, size_t W, class F >
+		T reduce(const vector<T, W> &v, F f) {
+			if constexpr(W == 1) {
+				return v[0];
+			} else if constexpr(has_native_vector<T, W>::value) {
+				if constexpr(sizeof(T) * W > 16) {
+					const auto [lo, hi] = detail::halves(v);
+					return detail::reduce(f(lo, hi), f);
+				} else {
+					return detail::reduce_in_register<W>(v, f);
+				}
+			} else {
+				auto acc = v.part(0);
+				for(size_t i = 1; i < vector<T, W>::part_count; ++i)
+					acc = f(acc, v.part(i));
+				return detail::reduce(acc, f);
+			}
+		}
+
+		template < class T, size_t W >
+		SIMD_FORCEINLINE size_t first_set_lane(const mask<T, W> &m);
+
+		template < class T, size_t W >
+		size_t first_set_lane(const mask<T, W> &m) {
+			if constexpr(W == 1) {
+				return 0;
+			} else if constexpr(has_native_vector<T, W>::value) {
+				const int bits = m.get_mask();
+				for(size_t i = 0; i < W; ++i)
+					if(lane_set<T, W>(bits, i))
+						return i;
+				return 0;
+			} else {
+				constexpr size_t pw = vector<T, W>::part_width;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					if(m.part(i).any())
+						return i * pw + detail::first_set_lane(m.part(i));
+				return 0;
+			}
+		}
+
+	} // namespace detail
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE T reduce_add(const vector<T, W> &v) {
+		return detail::reduce(v, [](const auto &a, const auto &b) { return a + b; });
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE T reduce_mul(const vector<T, W> &v) {
+		return detail::reduce(v, [](const auto &a, const auto &b) { return a * b; });
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE T reduce_min(const vector<T, W> &v) {
+		return detail::reduce(v, [](const auto &a, const auto &b) { return min(a, b); });
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE T reduce_max(const vector<T, W> &v) {
+		return detail::reduce(v, [](const auto &a, const auto &b) { return max(a, b); });
+	}
+
+	// Bitwise reductions, float lanes are combined by their bit patterns
+	template < class T, size_t W >
+	SIMD_FORCEINLINE T reduce_and(const vector<T, W> &v) {
+		return detail::reduce(v, [](const auto &a, const auto &b) { return a & b; });
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE T reduce_or(const vector<T, W> &v) {
+		return detail::reduce(v, [](const auto &a, const auto &b) { return a | b; });
+	}
+
+	// Lowest lane holding the minimum (maximum), 0 if there is none because of NaNs
+	template < class T, size_t W >
+	SIMD_FORCEINLINE size_t reduce_min_index(const vector<T, W> &v) {
+		return detail::first_set_lane(mask<T, W>(v == vector<T, W>(reduce_min(v))));
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE size_t reduce_max_index(const vector<T, W> &v) {
+		return detail::first_set_lane(mask<T, W>(v == vector<T, W>(reduce_max(v))));
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
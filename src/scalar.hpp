@@ -0,0 +1,470 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "base_types.hpp"
+#include "vector.hpp"
+#include "util.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		template < size_t S >
+		struct unsigned_of_size;
+
+		template <>
+		struct unsigned_of_size<1> { using type = std::uint8_t; };
+
+		template <>
+		struct unsigned_of_size<2> { using type = std::uint16_t; };
+
+		template <>
+		struct unsigned_of_size<4> { using type = std::uint32_t; };
+
+		template <>
+		struct unsigned_of_size<8> { using type = std::uint64_t; };
+
+		template < class T >
+		using bits_type = typename unsigned_of_size<sizeof(T)>::type;
+
+		template < class T >
+		SIMD_FORCEINLINE bits_type<T> to_bits(T v) {
+			bits_type<T> b;
+			std::memcpy(&b, &v, sizeof(T));
+			return b;
+		}
+
+		template < class T >
+		SIMD_FORCEINLINE T from_bits(bits_type<T> b) {
+			T v;
+			std::memcpy(&v, &b, sizeof(T));
+			return v;
+		}
+
+		// Integer lanes wrap around on overflow like their SIMD counterparts. Lanes narrower than int
+		// are computed in unsigned int, they would be promoted to the signed int otherwise
+		template < class T, class F >
+		SIMD_FORCEINLINE T wrapping(T v1, T v2, F f) {
+			if constexpr(std::is_integral_v<T>) {
+				using U = std::conditional_t<(sizeof(T) < sizeof(unsigned)), unsigned, std::make_unsigned_t<T>>;
+				return static_cast<T>(f(static_cast<U>(v1), static_cast<U>(v2)));
+			} else {
+				return f(v1, v2);
+			}
+		}
+
+		// std::fma is only worth it if it is an instruction rather than a software emulation
+#ifdef FP_FAST_FMAF
+		constexpr bool fast_fma_float = true;
+#else // FP_FAST_FMAF
+		constexpr bool fast_fma_float = false;
+#endif // FP_FAST_FMAF
+#ifdef FP_FAST_FMA
+		constexpr bool fast_fma_double = true;
+#else // FP_FAST_FMA
+		constexpr bool fast_fma_double = false;
+#endif // FP_FAST_FMA
+
+		template < class T >
+		constexpr bool fast_fma = (std::is_same_v<T, float> && fast_fma_float) || (std::is_same_v<T, double> && fast_fma_double);
+
+		template < class T >
+		SIMD_FORCEINLINE T multiply_add(T v1, T v2, T v3) {
+			static_assert(std::is_floating_point_v<T>, "Multiply-add requires floating point lanes");
+			if constexpr(fast_fma<T>)
+				return std::fma(v1, v2, v3);
+			else
+				return v1 * v2 + v3;
+		}
+
+		template < class T >
+		SIMD_FORCEINLINE T mulhi(T v1, T v2) {
+			static_assert(std::is_integral_v<T>, "mulhi requires integer lanes");
+			if constexpr(sizeof(T) <= 4) {
+				using P = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+				return static_cast<T>((static_cast<P>(v1) * v2) >> (8 * sizeof(T)));
+			} else {
+				// Unsigned product from the 32 bit partial products, corrected by subtracting the other operand for each negative one
+				const auto a = static_cast<std::uint64_t>(v1), b = static_cast<std::uint64_t>(v2);
+				const auto t = (a >> 32) * (b & 0xFFFFFFFF) + (((a & 0xFFFFFFFF) * (b & 0xFFFFFFFF)) >> 32);
+				const auto w = (a & 0xFFFFFFFF) * (b >> 32) + (t & 0xFFFFFFFF);
+				auto hi = (a >> 32) * (b >> 32) + (t >> 32) + (w >> 32);
+				if constexpr(std::is_signed_v<T>) {
+					if(v1 < 0)
+						hi -= b;
+					if(v2 < 0)
+						hi -= a;
+				}
+				return static_cast<T>(hi);
+			}
+		}
+
+		// Exact sum or difference of 8 or 16 bit lanes clamped to their range
+		template < class T >
+		SIMD_FORCEINLINE T saturate(int v) {
+			static_assert(std::is_integral_v<T> && sizeof(T) <= 2, "Saturating arithmetic requires 8 or 16 bit integer lanes");
+			constexpr int lowest = std::numeric_limits<T>::min(), highest = std::numeric_limits<T>::max();
+			return static_cast<T>(v < lowest ? lowest : v > highest ? highest : v);
+		}
+
+	} // namespace detail
+
+	// Single lane implemented in plain C++. It is the part type composite vectors fall back to when the
+	// instruction set has no register for T (e.g. SIMD_NONE builds); loops over these parts are left to
+	// the autovectorizer.
+	template < class T >
+	class vector<T, 1> {
+	public:
+		using type = T;
+		static constexpr size_t width = 1;
+		static constexpr int required_version = SIMD_NONE;
+		static constexpr bool fused_multiply_add = detail::fast_fma<T>;
+
+		SIMD_FORCEINLINE vector() : m_val() {}
+		explicit SIMD_FORCEINLINE vector(type f) : m_val(f) {}
+		explicit SIMD_FORCEINLINE vector(const std::array<type, width> &arr) : m_val(arr[0]) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals) : m_val(*vals) {}
+		explicit SIMD_FORCEINLINE vector(const type *vals, aligned_load) : m_val(*vals) {}
+		template < class U >
+		explicit SIMD_FORCEINLINE vector(const vector<U, 1> &v) : m_val(static_cast<type>(v[0])) {}
+
+		SIMD_FORCEINLINE type &operator[]([[maybe_unused]] size_t index) {
+			assert(index < width);
+			return m_val;
+		}
+
+		SIMD_FORCEINLINE const type &operator[]([[maybe_unused]] size_t index) const {
+			assert(index < width);
+			return m_val;
+		}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<T, 1> &operator+=(const vector<T, 1> &v);
+		SIMD_FORCEINLINE vector<T, 1> &operator-=(const vector<T, 1> &v);
+		SIMD_FORCEINLINE vector<T, 1> &operator*=(const vector<T, 1> &v);
+		SIMD_FORCEINLINE vector<T, 1> &operator/=(const vector<T, 1> &v);
+		friend SIMD_FORCEINLINE vector<T, 1> operator+(vector<T, 1> v1, const vector<T, 1> &v2) {
+			return (v1 += v2);
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> operator-(vector<T, 1> v1, const vector<T, 1> &v2) {
+			return (v1 -= v2);
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> operator*(vector<T, 1> v1, const vector<T, 1> &v2) {
+			return (v1 *= v2);
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> operator/(vector<T, 1> v1, const vector<T, 1> &v2) {
+			return (v1 /= v2);
+		}
+		// v1 * v2 + v3, v1 * v2 - v3, -(v1 * v2) + v3 and -(v1 * v2) - v3, see is_fma_fused
+		friend SIMD_FORCEINLINE vector<T, 1> fmadd(const vector<T, 1> &v1, const vector<T, 1> &v2, const vector<T, 1> &v3) {
+			return vector<T, 1>(detail::multiply_add(v1.m_val, v2.m_val, v3.m_val));
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> fmsub(const vector<T, 1> &v1, const vector<T, 1> &v2, const vector<T, 1> &v3) {
+			return vector<T, 1>(detail::multiply_add(v1.m_val, v2.m_val, -v3.m_val));
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> fnmadd(const vector<T, 1> &v1, const vector<T, 1> &v2, const vector<T, 1> &v3) {
+			return vector<T, 1>(detail::multiply_add(-v1.m_val, v2.m_val, v3.m_val));
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> fnmsub(const vector<T, 1> &v1, const vector<T, 1> &v2, const vector<T, 1> &v3) {
+			return vector<T, 1>(detail::multiply_add(-v1.m_val, v2.m_val, -v3.m_val));
+		}
+		// High half of the double width product
+		friend SIMD_FORCEINLINE vector<T, 1> mulhi(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return vector<T, 1>(detail::mulhi(v1.m_val, v2.m_val));
+		}
+		// Sums and differences clamped to the range of the lanes, 8 and 16 bit integer lanes only
+		friend SIMD_FORCEINLINE vector<T, 1> add_sat(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return vector<T, 1>(detail::saturate<T>(v1.m_val + v2.m_val));
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> sub_sat(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return vector<T, 1>(detail::saturate<T>(v1.m_val - v2.m_val));
+		}
+
+		// Bitwise operations work on the lane's bit pattern, also for floating point types
+		SIMD_FORCEINLINE vector<T, 1> &operator&=(const vector<T, 1> &v);
+		SIMD_FORCEINLINE vector<T, 1> &operator|=(const vector<T, 1> &v);
+		SIMD_FORCEINLINE vector<T, 1> &operator^=(const vector<T, 1> &v);
+		friend SIMD_FORCEINLINE vector<T, 1> operator~(const vector<T, 1> &v) {
+			return vector<T, 1>(detail::from_bits<T>(static_cast<detail::bits_type<T>>(~detail::to_bits(v.m_val))));
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> operator&(vector<T, 1> v1, const vector<T, 1> &v2) {
+			return v1 &= v2;
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> operator|(vector<T, 1> v1, const vector<T, 1> &v2) {
+			return v1 |= v2;
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> operator^(vector<T, 1> v1, const vector<T, 1> &v2) {
+			return v1 ^= v2;
+		}
+
+		friend SIMD_FORCEINLINE vector<T, 1> operator<<(const vector<T, 1> &v, int bits) {
+			static_assert(std::is_integral_v<T>, "Shifts require integer lanes");
+			return vector<T, 1>(static_cast<T>(static_cast<std::make_unsigned_t<T>>(v.m_val) << bits));
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> operator>>(const vector<T, 1> &v, int bits) {
+			static_assert(std::is_integral_v<T>, "Shifts require integer lanes");
+			return vector<T, 1>(static_cast<T>(v.m_val >> bits));
+		}
+
+		friend SIMD_FORCEINLINE mask<T, 1> operator==(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return mask<T, 1>(v1.m_val == v2.m_val);
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator!=(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return mask<T, 1>(v1.m_val != v2.m_val);
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator>(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return mask<T, 1>(v1.m_val > v2.m_val);
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator>=(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return mask<T, 1>(v1.m_val >= v2.m_val);
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator<(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return mask<T, 1>(v1.m_val < v2.m_val);
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator<=(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return mask<T, 1>(v1.m_val <= v2.m_val);
+		}
+
+		SIMD_FORCEINLINE type hadd() const {
+			return m_val;
+		}
+		SIMD_FORCEINLINE type hsub() const {
+			return m_val;
+		}
+
+		SIMD_FORCEINLINE vector<T, 1> &abs();
+		friend SIMD_FORCEINLINE vector<T, 1> abs(vector<T, 1> v) {
+			return v.abs();
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> min(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return vector<T, 1>(v2.m_val < v1.m_val ? v2.m_val : v1.m_val);
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> max(const vector<T, 1> &v1, const vector<T, 1> &v2) {
+			return vector<T, 1>(v1.m_val < v2.m_val ? v2.m_val : v1.m_val);
+		}
+		SIMD_FORCEINLINE vector<T, 1> &ceil();
+		SIMD_FORCEINLINE vector<T, 1> &floor();
+		// mode takes the _MM_FROUND_TO_* values: 0 nearest, 1 down, 2 up, 3 towards zero
+		SIMD_FORCEINLINE vector<T, 1> &round(int mode);
+		friend SIMD_FORCEINLINE vector<T, 1> ceil(vector<T, 1> v) {
+			return v.ceil();
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> floor(vector<T, 1> v) {
+			return v.floor();
+		}
+		friend SIMD_FORCEINLINE vector<T, 1> round(vector<T, 1> v, int mode) {
+			return v.round(mode);
+		}
+
+		SIMD_FORCEINLINE vector<T, 1> sqrt() const;
+		SIMD_FORCEINLINE vector<T, 1> rsqrt() const;
+
+		friend SIMD_FORCEINLINE vector<T, 1> select(const vector<T, 1> &v, const vector<T, 1> &alt, const mask<T, 1> &condition) {
+			return condition[0] ? v : alt;
+		}
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<T, 1> &v) {
+			// Promoted, so 8 bit lanes print as numbers rather than characters
+			return stream << '(' << +v.m_val << ')';
+		}
+
+	private:
+		type m_val;
+	};
+
+	template < class T >
+	class mask<T, 1> {
+	public:
+		using type = T;
+		static constexpr size_t width = 1;
+
+		SIMD_FORCEINLINE mask() : m_mask(false) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : m_mask(b) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width> &arr) : m_mask(arr[0]) {}
+		// Lanes with the sign bit set are considered true, like for the native masks
+		explicit SIMD_FORCEINLINE mask(const vector<T, 1> &v) : m_mask((detail::to_bits(v[0]) >> (8 * sizeof(T) - 1)) != 0) {}
+
+		static SIMD_FORCEINLINE mask<T, 1> first_n(size_t count) {
+			return mask<T, 1>(count > 0);
+		}
+
+		SIMD_FORCEINLINE bool operator[]([[maybe_unused]] size_t index) const {
+			assert(index < width);
+			return m_mask;
+		}
+
+		friend SIMD_FORCEINLINE mask<T, 1> operator==(const mask<T, 1> &v1, const mask<T, 1> &v2) {
+			return mask<T, 1>(v1.m_mask == v2.m_mask);
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator!=(const mask<T, 1> &v1, const mask<T, 1> &v2) {
+			return mask<T, 1>(v1.m_mask != v2.m_mask);
+		}
+
+		SIMD_FORCEINLINE mask<T, 1> &operator&=(const mask<T, 1> &v) {
+			m_mask = m_mask && v.m_mask;
+			return *this;
+		}
+		SIMD_FORCEINLINE mask<T, 1> &operator|=(const mask<T, 1> &v) {
+			m_mask = m_mask || v.m_mask;
+			return *this;
+		}
+		SIMD_FORCEINLINE mask<T, 1> &operator^=(const mask<T, 1> &v) {
+			m_mask = m_mask != v.m_mask;
+			return *this;
+		}
+
+		friend SIMD_FORCEINLINE mask<T, 1> operator~(const mask<T, 1> &v) {
+			return mask<T, 1>(!v.m_mask);
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator&(mask<T, 1> v1, const mask<T, 1> &v2) {
+			return v1 &= v2;
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator|(mask<T, 1> v1, const mask<T, 1> &v2) {
+			return v1 |= v2;
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> operator^(mask<T, 1> v1, const mask<T, 1> &v2) {
+			return v1 ^= v2;
+		}
+		friend SIMD_FORCEINLINE mask<T, 1> andnot(const mask<T, 1> &v1, const mask<T, 1> &v2) {
+			return mask<T, 1>(!v1.m_mask && v2.m_mask);
+		}
+
+		SIMD_FORCEINLINE int get_mask() const {
+			return m_mask;
+		}
+		SIMD_FORCEINLINE bool all() const {
+			return m_mask;
+		}
+		SIMD_FORCEINLINE bool any() const {
+			return m_mask;
+		}
+		SIMD_FORCEINLINE bool none() const {
+			return !m_mask;
+		}
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const mask<T, 1> &m) {
+			return stream << '(' << m.m_mask << ')';
+		}
+
+	private:
+		bool m_mask;
+	};
+
+	template < class T >
+	void vector<T, 1>::store(type *vals) const {
+		*vals = m_val;
+	}
+
+	template < class T >
+	void vector<T, 1>::store(type *vals, aligned_store) const {
+		*vals = m_val;
+	}
+
+	template < class T >
+	void vector<T, 1>::stream(type *vals) const {
+		*vals = m_val;
+	}
+
+	template < class T >
+	void vector<T, 1>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		if(count > 0)
+			*vals = m_val;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::operator+=(const vector<T, 1> &v) {
+		m_val = detail::wrapping(m_val, v.m_val, [](auto a, auto b) { return a + b; });
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::operator-=(const vector<T, 1> &v) {
+		m_val = detail::wrapping(m_val, v.m_val, [](auto a, auto b) { return a - b; });
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::operator*=(const vector<T, 1> &v) {
+		m_val = detail::wrapping(m_val, v.m_val, [](auto a, auto b) { return a * b; });
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::operator/=(const vector<T, 1> &v) {
+		m_val /= v.m_val;
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::operator&=(const vector<T, 1> &v) {
+		m_val = detail::from_bits<T>(detail::to_bits(m_val) & detail::to_bits(v.m_val));
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::operator|=(const vector<T, 1> &v) {
+		m_val = detail::from_bits<T>(detail::to_bits(m_val) | detail::to_bits(v.m_val));
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::operator^=(const vector<T, 1> &v) {
+		m_val = detail::from_bits<T>(detail::to_bits(m_val) ^ detail::to_bits(v.m_val));
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::abs() {
+		if constexpr(std::is_floating_point_v<T>)
+			m_val = std::fabs(m_val);
+		else if constexpr(std::is_signed_v<T>)
+			m_val = m_val < 0 ? detail::wrapping(T(0), m_val, [](auto a, auto b) { return a - b; }) : m_val;
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::ceil() {
+		m_val = std::ceil(m_val);
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::floor() {
+		m_val = std::floor(m_val);
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> &vector<T, 1>::round(int mode) {
+		switch(mode & 0b11) {
+			case 0: m_val = std::nearbyint(m_val); break;
+			case 1: m_val = std::floor(m_val); break;
+			case 2: m_val = std::ceil(m_val); break;
+			default: m_val = std::trunc(m_val); break;
+		}
+		return *this;
+	}
+
+	template < class T >
+	vector<T, 1> vector<T, 1>::sqrt() const {
+		return vector<T, 1>(std::sqrt(m_val));
+	}
+
+	template < class T >
+	vector<T, 1> vector<T, 1>::rsqrt() const {
+		return vector<T, 1>(T(1) / std::sqrt(m_val));
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,372 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "int32x4.hpp"
+#include "int32x8.hpp"
+#include "int64x2.hpp"
+#include "int64x4.hpp"
+#include "int32x16.hpp"
+#include "int64x8.hpp"
+#include "int16x8.hpp"
+#include "int16x16.hpp"
+#include "int8x16.hpp"
+#include "int8x32.hpp"
+#include "uint32x4.hpp"
+#include "uint32x8.hpp"
+#include "uint64x2.hpp"
+#include "uint64x4.hpp"
+#include "uint16x8.hpp"
+#include "uint16x16.hpp"
+#include "uint8x16.hpp"
+#include "uint8x32.hpp"
+
+// Shifts of integer lanes by a count per lane (v << bits and v >> bits with a vector of counts), shifts by
+// counts known at compile time and bit rotates. AVX2 and AVX-512 shift 32 and 64 bit lanes by a vector of
+// counts directly, SSE shifts the register once per lane and picks every lane from its own shifted copy.
+// 8 and 16 bit lanes are shifted one by one, but rotated by a single count in registers. Like the AVX2
+// instructions, counts of at least the lane width shift out all bits, arithmetic right shifts leave the
+// sign in every bit then. The 128 and 256 bit forms of vpsrav for 64 bit lanes and of vprolv need
+// AVX512VL, which SIMD_AVX512BW stands in for since that level implies VL (see versions.hpp).
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		enum class shift_op { sll, srl, sra, rol };
+
+		// Logical right shift of the S byte lanes of a native register, defined for the registers below
+		template < size_t S, class N >
+		N srl_lanes(N v, int bits);
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+		// Shifts v once by the count of every lane and takes each lane from its own shifted copy
+		template < class F >
+		SIMD_FORCEINLINE __m128i shift_each_epi32(__m128i v, __m128i counts, F shift) {
+			const auto lo = _mm_unpacklo_epi32(counts, _mm_setzero_si128()), hi = _mm_unpackhi_epi32(counts, _mm_setzero_si128());
+			const auto r01 = _mm_unpacklo_epi64(shift(v, lo), shift(v, _mm_srli_si128(lo, 8)));
+			const auto r23 = _mm_unpackhi_epi64(shift(v, hi), shift(v, _mm_srli_si128(hi, 8)));
+			return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(r01), _mm_castsi128_ps(r23), _MM_SHUFFLE(3, 0, 3, 0)));
+		}
+
+		template < class F >
+		SIMD_FORCEINLINE __m128i shift_each_epi64(__m128i v, __m128i counts, F shift) {
+			const auto lo = shift(v, counts), hi = shift(v, _mm_unpackhi_epi64(counts, counts));
+			return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(hi), _mm_castsi128_pd(lo)));
+		}
+
+		SIMD_FORCEINLINE __m128i sllv_epi32(__m128i v, __m128i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return _mm_sllv_epi32(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			return shift_each_epi32(v, counts, [](__m128i a, __m128i n) { return _mm_sll_epi32(a, n); });
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE __m128i srlv_epi32(__m128i v, __m128i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return _mm_srlv_epi32(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			return shift_each_epi32(v, counts, [](__m128i a, __m128i n) { return _mm_srl_epi32(a, n); });
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE __m128i srav_epi32(__m128i v, __m128i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return _mm_srav_epi32(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			return shift_each_epi32(v, counts, [](__m128i a, __m128i n) { return _mm_sra_epi32(a, n); });
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE __m128i sllv_epi64(__m128i v, __m128i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return _mm_sllv_epi64(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			return shift_each_epi64(v, counts, [](__m128i a, __m128i n) { return _mm_sll_epi64(a, n); });
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE __m128i srlv_epi64(__m128i v, __m128i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return _mm_srlv_epi64(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			return shift_each_epi64(v, counts, [](__m128i a, __m128i n) { return _mm_srl_epi64(a, n); });
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		SIMD_FORCEINLINE __m128i srav_epi64(__m128i v, __m128i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+			return _mm_srav_epi64(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+			// Negative lanes are flipped, shifted logically and flipped back, so the vacated bits become ones
+			const auto sign = _mm_srai_epi32(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+			return _mm_xor_si128(srlv_epi64(_mm_xor_si128(v, sign), counts), sign);
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+		}
+
+		SIMD_FORCEINLINE __m128i rolv_epi32(__m128i v, __m128i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+			return _mm_rolv_epi32(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+			const auto n = _mm_and_si128(counts, _mm_set1_epi32(31));
+			return _mm_or_si128(sllv_epi32(v, n), srlv_epi32(v, _mm_sub_epi32(_mm_set1_epi32(32), n)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+		}
+
+		SIMD_FORCEINLINE __m128i rolv_epi64(__m128i v, __m128i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+			return _mm_rolv_epi64(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+			const auto n = _mm_and_si128(counts, _mm_set1_epi64x(63));
+			return _mm_or_si128(sllv_epi64(v, n), srlv_epi64(v, _mm_sub_epi64(_mm_set1_epi64x(64), n)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+		}
+
+		template < size_t S >
+		SIMD_FORCEINLINE __m128i srl_lanes(__m128i v, int bits) {
+			const auto count = _mm_cvtsi32_si128(bits);
+			if constexpr(S == 1)
+				// Shift 16 bit lanes and clear the bits moved in from the neighbouring byte
+				return _mm_and_si128(_mm_srl_epi16(v, count), _mm_set1_epi8(static_cast<char>(0xFF >> bits)));
+			else if constexpr(S == 2)
+				return _mm_srl_epi16(v, count);
+			else if constexpr(S == 4)
+				return _mm_srl_epi32(v, count);
+			else
+				return _mm_srl_epi64(v, count);
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+		SIMD_FORCEINLINE __m256i sllv_epi32(__m256i v, __m256i counts) {
+			return _mm256_sllv_epi32(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m256i srlv_epi32(__m256i v, __m256i counts) {
+			return _mm256_srlv_epi32(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m256i srav_epi32(__m256i v, __m256i counts) {
+			return _mm256_srav_epi32(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m256i sllv_epi64(__m256i v, __m256i counts) {
+			return _mm256_sllv_epi64(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m256i srlv_epi64(__m256i v, __m256i counts) {
+			return _mm256_srlv_epi64(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m256i srav_epi64(__m256i v, __m256i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+			return _mm256_srav_epi64(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+			const auto sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), v);
+			return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(v, sign), counts), sign);
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+		}
+
+		SIMD_FORCEINLINE __m256i rolv_epi32(__m256i v, __m256i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+			return _mm256_rolv_epi32(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+			const auto n = _mm256_and_si256(counts, _mm256_set1_epi32(31));
+			return _mm256_or_si256(_mm256_sllv_epi32(v, n), _mm256_srlv_epi32(v, _mm256_sub_epi32(_mm256_set1_epi32(32), n)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+		}
+
+		SIMD_FORCEINLINE __m256i rolv_epi64(__m256i v, __m256i counts) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+			return _mm256_rolv_epi64(v, counts);
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+			const auto n = _mm256_and_si256(counts, _mm256_set1_epi64x(63));
+			return _mm256_or_si256(_mm256_sllv_epi64(v, n), _mm256_srlv_epi64(v, _mm256_sub_epi64(_mm256_set1_epi64x(64), n)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+		}
+
+		template < size_t S >
+		SIMD_FORCEINLINE __m256i srl_lanes(__m256i v, int bits) {
+			const auto count = _mm_cvtsi32_si128(bits);
+			if constexpr(S == 1)
+				// Shift 16 bit lanes and clear the bits moved in from the neighbouring byte
+				return _mm256_and_si256(_mm256_srl_epi16(v, count), _mm256_set1_epi8(static_cast<char>(0xFF >> bits)));
+			else if constexpr(S == 2)
+				return _mm256_srl_epi16(v, count);
+			else if constexpr(S == 4)
+				return _mm256_srl_epi32(v, count);
+			else
+				return _mm256_srl_epi64(v, count);
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+		SIMD_FORCEINLINE __m512i sllv_epi32(__m512i v, __m512i counts) {
+			return _mm512_sllv_epi32(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m512i srlv_epi32(__m512i v, __m512i counts) {
+			return _mm512_srlv_epi32(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m512i srav_epi32(__m512i v, __m512i counts) {
+			return _mm512_srav_epi32(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m512i sllv_epi64(__m512i v, __m512i counts) {
+			return _mm512_sllv_epi64(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m512i srlv_epi64(__m512i v, __m512i counts) {
+			return _mm512_srlv_epi64(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m512i srav_epi64(__m512i v, __m512i counts) {
+			return _mm512_srav_epi64(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m512i rolv_epi32(__m512i v, __m512i counts) {
+			return _mm512_rolv_epi32(v, counts);
+		}
+
+		SIMD_FORCEINLINE __m512i rolv_epi64(__m512i v, __m512i counts) {
+			return _mm512_rolv_epi64(v, counts);
+		}
+
+		template < size_t S >
+		SIMD_FORCEINLINE __m512i srl_lanes(__m512i v, int bits) {
+			static_assert(S >= 4, "No native 512 bit vectors of 8 or 16 bit lanes");
+			const auto count = _mm_cvtsi32_si128(bits);
+			if constexpr(S == 4)
+				return _mm512_srl_epi32(v, count);
+			else
+				return _mm512_srl_epi64(v, count);
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+		template < shift_op Op, class T, size_t W >
+		vector<T, W> shift_lanes(const vector<T, W> &v, const vector<T, W> &counts) {
+			static_assert(std::is_integral_v<T>, "Shifts require integer lanes");
+			if constexpr(W == 1) {
+				using U = std::make_unsigned_t<T>;
+				constexpr U digits = 8 * sizeof(T);
+				const auto x = static_cast<U>(v[0]), n = static_cast<U>(counts[0]);
+				if constexpr(Op == shift_op::sll)
+					return vector<T, 1>(n < digits ? static_cast<T>(x << n) : T(0));
+				else if constexpr(Op == shift_op::srl)
+					return vector<T, 1>(n < digits ? static_cast<T>(x >> n) : T(0));
+				else if constexpr(Op == shift_op::sra)
+					return vector<T, 1>(static_cast<T>(v[0] >> (n < digits ? n : digits - 1)));
+				else
+					return vector<T, 1>(static_cast<T>((x << n % digits) | (x >> (digits - n % digits) % digits)));
+			} else if constexpr(has_native_vector<T, W>::value && sizeof(T) >= 4) {
+				const auto a = v.native(), n = counts.native();
+				if constexpr(Op == shift_op::sll)
+					return vector<T, W>(sizeof(T) == 4 ? sllv_epi32(a, n) : sllv_epi64(a, n));
+				else if constexpr(Op == shift_op::srl)
+					return vector<T, W>(sizeof(T) == 4 ? srlv_epi32(a, n) : srlv_epi64(a, n));
+				else if constexpr(Op == shift_op::sra)
+					return vector<T, W>(sizeof(T) == 4 ? srav_epi32(a, n) : srav_epi64(a, n));
+				else
+					return vector<T, W>(sizeof(T) == 4 ? rolv_epi32(a, n) : rolv_epi64(a, n));
+			} else if constexpr(has_native_vector<T, W>::value) {
+				std::array<T, W> a, n;
+				v.store(a.data());
+				counts.store(n.data());
+				for(size_t i = 0; i < W; ++i)
+					a[i] = detail::shift_lanes<Op>(vector<T, 1>(a[i]), vector<T, 1>(n[i]))[0];
+				return vector<T, W>(a);
+			} else {
+				vector<T, W> res;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					res.part(i) = detail::shift_lanes<Op>(v.part(i), counts.part(i));
+				return res;
+			}
+		}
+
+		// Rotate with one count for all lanes, a left and a logical right shift of the whole register
+		template < class T, size_t W >
+		vector<T, W> rotate_left(const vector<T, W> &v, int bits) {
+			static_assert(std::is_integral_v<T>, "Rotates require integer lanes");
+			constexpr int digits = 8 * sizeof(T);
+			bits &= digits - 1;
+			if constexpr(W > 1 && has_native_vector<T, W>::value) {
+				return (v << bits) | vector<T, W>(detail::srl_lanes<sizeof(T)>(v.native(), digits - bits));
+			} else if constexpr(W == 1 || has_native_vector<T, W>::value) {
+				return detail::shift_lanes<shift_op::rol>(v, vector<T, W>(static_cast<T>(bits)));
+			} else {
+				vector<T, W> res;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i)
+					res.part(i) = detail::rotate_left(v.part(i), bits);
+				return res;
+			}
+		}
+
+	} // namespace detail
+
+	// Lane i of v shifted by lane i of bits, arithmetically to the right for signed lanes
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> operator<<(const vector<T, W> &v, const vector<T, W> &bits) {
+		return detail::shift_lanes<detail::shift_op::sll>(v, bits);
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> operator>>(const vector<T, W> &v, const vector<T, W> &bits) {
+		return detail::shift_lanes<std::is_signed_v<T> ? detail::shift_op::sra : detail::shift_op::srl>(v, bits);
+	}
+
+	// Bit rotates of every lane, the counts are taken modulo the lane width
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> rotl(const vector<T, W> &v, int bits) {
+		return detail::rotate_left(v, bits);
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> rotr(const vector<T, W> &v, int bits) {
+		return detail::rotate_left(v, -bits);
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> rotl(const vector<T, W> &v, const vector<T, W> &bits) {
+		return detail::shift_lanes<detail::shift_op::rol>(v, bits);
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> rotr(const vector<T, W> &v, const vector<T, W> &bits) {
+		return detail::shift_lanes<detail::shift_op::rol>(v, vector<T, W>(T(0)) - bits);
+	}
+
+	// Shifts and rotates by a constant count, checked at compile time. The count folds into the immediate
+	// form of the native shift instructions (pslld xmm, imm and friends).
+	template < int B, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> shift_left(const vector<T, W> &v) {
+		static_assert(B >= 0 && B < 8 * static_cast<int>(sizeof(T)), "Shift count out of range");
+		return v << B;
+	}
+
+	template < int B, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> shift_right(const vector<T, W> &v) {
+		static_assert(B >= 0 && B < 8 * static_cast<int>(sizeof(T)), "Shift count out of range");
+		return v >> B;
+	}
+
+	template < int B, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> rotl(const vector<T, W> &v) {
+		static_assert(B >= 0 && B < 8 * static_cast<int>(sizeof(T)), "Rotate count out of range");
+		return detail::rotate_left(v, B);
+	}
+
+	template < int B, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> rotr(const vector<T, W> &v) {
+		static_assert(B >= 0 && B < 8 * static_cast<int>(sizeof(T)), "Rotate count out of range");
+		return detail::rotate_left(v, -B);
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,1131 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "float32x4.hpp"
+#include "float32x8.hpp"
+#include "float64x2.hpp"
+#include "float64x4.hpp"
+#include "int32x4.hpp"
+#include "int32x8.hpp"
+#include "int64x2.hpp"
+#include "int64x4.hpp"
+#include "float32x16.hpp"
+#include "float64x8.hpp"
+#include "int32x16.hpp"
+#include "int64x8.hpp"
+
+// Lane movement with the lane indices as template arguments: shuffle, broadcast, reverse, rotate_lanes,
+// blend, insert and extract. The pattern is known at compile time, so each call resolves to the cheapest
+// instruction of the instruction set for it (e.g. pshufd, shufps, vpermilps, vpermd or blendps). Patterns
+// without a dedicated instruction are composed of two permutations and a blend at most.
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		// Compile time properties of the lane indices of a shuffle. Two vector shuffles number the lanes
+		// of the second vector after those of the first one.
+		template < int... I >
+		struct lanes {
+			static constexpr int count = static_cast<int>(sizeof...(I));
+			static constexpr std::array<int, sizeof...(I)> index{ { I... } };
+
+			// Lane i reads lane i
+			static constexpr bool identity() {
+				for(int i = 0; i < count; ++i)
+					if(index[i] != i)
+						return false;
+				return true;
+			}
+
+			// Every lane reads lane l
+			static constexpr bool broadcast(int l) {
+				for(int i = 0; i < count; ++i)
+					if(index[i] != l)
+						return false;
+				return true;
+			}
+
+			// Bit i is set when lane i reads an index of at least n (the second vector for n = count)
+			static constexpr std::uint64_t above(int n) {
+				std::uint64_t m = 0;
+				for(int i = 0; i < count; ++i)
+					if(index[i] >= n)
+						m |= std::uint64_t(1) << i;
+				return m;
+			}
+
+			static constexpr std::uint64_t second() {
+				return above(count);
+			}
+
+			// Every lane reads from the group of g lanes (e.g. a 128 bit lane) at its own position of either
+			// vector; with repeated, all groups also share the same pattern
+			static constexpr bool in_groups(int g, bool repeated) {
+				for(int i = 0; i < count; ++i) {
+					const int l = index[i] % count;
+					if(l / g != i / g || (repeated && l % g != index[i % g] % count % g))
+						return false;
+				}
+				return true;
+			}
+
+			// Every group of g lanes has the same pattern within the groups it reads
+			static constexpr bool repeated(int g) {
+				for(int i = 0; i < count; ++i)
+					if(index[i] % g != index[i % g] % g)
+						return false;
+				return true;
+			}
+
+			// Every group of g lanes reads a single group, see group_source
+			static constexpr bool single_source_groups(int g) {
+				for(int i = 0; i < count; ++i)
+					if(index[i] / g != index[i - i % g] / g)
+						return false;
+				return true;
+			}
+
+			// Like single_source_groups, but keeping the order of the lanes of a group starting at a multiple of g
+			static constexpr bool whole_groups(int g) {
+				for(int i = 0; i < count; ++i)
+					if(index[i - i % g] % g != 0 || index[i] - i % g != index[i - i % g])
+						return false;
+				return true;
+			}
+
+			// Group of g lanes read by the given group, counting the groups of the second vector after those of the first
+			static constexpr int group_source(int g, int group) {
+				return index[group * g] / g;
+			}
+
+			// Every group of g lanes reads at most one group of each vector
+			static constexpr bool paired_groups(int g) {
+				for(int i = 0; i < count; ++i)
+					for(int j = i - i % g; j < i; ++j)
+						if((index[j] >= count) == (index[i] >= count) && index[j] / g != index[i] / g)
+							return false;
+				return true;
+			}
+
+			// Group of g lanes of the first or second vector read by the given group, zero if it reads none
+			static constexpr int paired_source(int g, int group, bool second) {
+				for(int i = group * g; i < (group + 1) * g; ++i)
+					if((index[i] >= count) == second)
+						return index[i] % count / g;
+				return 0;
+			}
+
+			// Lanes at position k of every group of g lanes read the second vector exactly for the set bits
+			// of pattern, e.g. 0b1100 for shufps
+			static constexpr bool sources(int g, std::uint64_t pattern) {
+				for(int i = 0; i < count; ++i)
+					if((index[i] >= count) != (((pattern >> (i % g)) & 1) != 0))
+						return false;
+				return true;
+			}
+
+			// Interleaved low (or high) halves of every group of g lanes as done by unpacklo (unpackhi),
+			// with the first vector in the even lanes unless swapped
+			static constexpr bool interleave(int g, bool high, bool swapped) {
+				for(int i = 0; i < count; ++i) {
+					const int k = i % g;
+					const int expected = i - k + (high ? g / 2 : 0) + k / 2 + ((k % 2 != 0) != swapped ? count : 0);
+					if(index[i] != expected)
+						return false;
+				}
+				return true;
+			}
+
+			// Immediate operand with the given bits per lane for n lanes starting at first, each holding
+			// the lane index modulo m
+			static constexpr int immediate(int first, int n, int bits, int m) {
+				int imm = 0;
+				for(int k = 0; k < n; ++k)
+					imm |= (index[first + k] % m) << (k * bits);
+				return imm;
+			}
+
+			// Immediate of pshufd moving the 64 bit lanes of the first 128 bit lane
+			static constexpr int qword_immediate() {
+				int imm = 0;
+				for(int k = 0; k < 2; ++k)
+					imm |= (2 * (index[k] % 2) | (2 * (index[k] % 2) + 1) << 2) << (4 * k);
+				return imm;
+			}
+
+			// Immediate with the given bits per group of g lanes, each holding its source group modulo m
+			static constexpr int group_immediate(int g, int bits, int m) {
+				int imm = 0;
+				for(int k = 0; k < count / g; ++k)
+					imm |= (group_source(g, k) % m) << (k * bits);
+				return imm;
+			}
+		};
+
+		template < size_t W >
+		constexpr std::uint64_t all_lanes = W >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << W) - 1;
+
+		// Intrinsics need their immediate operands folded even without optimization
+		template < int N >
+		constexpr int constant = N;
+
+		// Repeats every bit of a lane mask n times, for blends on narrower lanes
+		constexpr int widen_mask(std::uint64_t m, int n) {
+			int wide = 0;
+			for(int i = 0; m >> i != 0; ++i)
+				if((m >> i) & 1)
+					wide |= ((1 << n) - 1) << (i * n);
+			return wide;
+		}
+
+		// Lane by lane fallbacks
+		template < int... I, class V >
+		SIMD_FORCEINLINE V permute_lanes(const V &v) {
+			return V(std::array<typename V::type, V::width>{ { v[I]... } });
+		}
+
+		template < int... I, class V >
+		SIMD_FORCEINLINE V permute2_lanes(const V &a, const V &b) {
+			constexpr int w = static_cast<int>(V::width);
+			return V(std::array<typename V::type, V::width>{ { (I < w ? a[I] : b[I - w])... } });
+		}
+
+		template < std::uint64_t M, class V, size_t... L >
+		SIMD_FORCEINLINE V blend_lanes(const V &a, const V &b, std::index_sequence<L...>) {
+			return V(std::array<typename V::type, V::width>{ { ((M >> L) & 1 ? b[L] : a[L])... } });
+		}
+
+		// permute: one vector, blend: lanes of b for the set bits of M, permute2: two vectors with lanes from
+		// both of them and not in place (see shuffle_two). extract: a single lane as scalar.
+#if SIMD_SUPPORTS(SIMD_SSE)
+		template < int... I >
+		SIMD_FORCEINLINE vector<float, 4> permute(const vector<float, 4> &v) {
+			using L = lanes<I...>;
+			const __m128 x = v.native();
+			if constexpr(L::identity())
+				return v;
+#if SIMD_SUPPORTS(SIMD_SSE3)
+			else if constexpr(std::is_same_v<L, lanes<0, 0, 2, 2>>)
+				return vector<float, 4>(_mm_moveldup_ps(x));
+			else if constexpr(std::is_same_v<L, lanes<1, 1, 3, 3>>)
+				return vector<float, 4>(_mm_movehdup_ps(x));
+#endif // SIMD_SUPPORTS(SIMD_SSE3)
+			else if constexpr(std::is_same_v<L, lanes<0, 1, 0, 1>>)
+				return vector<float, 4>(_mm_movelh_ps(x, x));
+			else if constexpr(std::is_same_v<L, lanes<2, 3, 2, 3>>)
+				return vector<float, 4>(_mm_movehl_ps(x, x));
+			else if constexpr(std::is_same_v<L, lanes<0, 0, 1, 1>>)
+				return vector<float, 4>(_mm_unpacklo_ps(x, x));
+			else if constexpr(std::is_same_v<L, lanes<2, 2, 3, 3>>)
+				return vector<float, 4>(_mm_unpackhi_ps(x, x));
+#if SIMD_SUPPORTS(SIMD_AVX)
+			// vpermilps does not need the source in the destination register
+			else
+				return vector<float, 4>(_mm_permute_ps(x, constant<L::immediate(0, 4, 2, 4)>));
+#else // SIMD_SUPPORTS(SIMD_AVX)
+			else
+				return vector<float, 4>(_mm_shuffle_ps(x, x, constant<L::immediate(0, 4, 2, 4)>));
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<float, 4> blend(const vector<float, 4> &a, const vector<float, 4> &b) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+			return vector<float, 4>(_mm_blend_ps(a.native(), b.native(), static_cast<int>(M)));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+			if constexpr(M == 0b0001) {
+				return vector<float, 4>(_mm_move_ss(a.native(), b.native()));
+			} else {
+#if SIMD_SUPPORTS(SIMD_SSE2)
+				const __m128 m = _mm_castsi128_ps(_mm_setr_epi32(-static_cast<int>(M & 1), -static_cast<int>((M >> 1) & 1),
+																 -static_cast<int>((M >> 2) & 1), -static_cast<int>((M >> 3) & 1)));
+				return vector<float, 4>(_mm_or_ps(_mm_and_ps(m, b.native()), _mm_andnot_ps(m, a.native())));
+#else // SIMD_SUPPORTS(SIMD_SSE2)
+				return blend_lanes<M>(a, b, std::make_index_sequence<4>());
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+			}
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<float, 4> permute2(const vector<float, 4> &a, const vector<float, 4> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::sources(4, 0b1100))
+				return vector<float, 4>(_mm_shuffle_ps(a.native(), b.native(), constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::sources(4, 0b0011))
+				return vector<float, 4>(_mm_shuffle_ps(b.native(), a.native(), constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::interleave(4, false, false))
+				return vector<float, 4>(_mm_unpacklo_ps(a.native(), b.native()));
+			else if constexpr(L::interleave(4, false, true))
+				return vector<float, 4>(_mm_unpacklo_ps(b.native(), a.native()));
+			else if constexpr(L::interleave(4, true, false))
+				return vector<float, 4>(_mm_unpackhi_ps(a.native(), b.native()));
+			else if constexpr(L::interleave(4, true, true))
+				return vector<float, 4>(_mm_unpackhi_ps(b.native(), a.native()));
+			else
+				return detail::blend<L::second()>(detail::permute<(I % 4)...>(a), detail::permute<(I % 4)...>(b));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE float extract(const vector<float, 4> &v) {
+			if constexpr(L == 0)
+				return _mm_cvtss_f32(v.native());
+			else if constexpr(L == 2)
+				return _mm_cvtss_f32(_mm_movehl_ps(v.native(), v.native()));
+			else
+				return _mm_cvtss_f32(detail::permute<L, L, L, L>(v).native());
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE)
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+		template < int... I >
+		SIMD_FORCEINLINE vector<double, 2> permute(const vector<double, 2> &v) {
+			using L = lanes<I...>;
+			const __m128d x = v.native();
+			if constexpr(L::identity())
+				return v;
+#if SIMD_SUPPORTS(SIMD_SSE3)
+			else if constexpr(std::is_same_v<L, lanes<0, 0>>)
+				return vector<double, 2>(_mm_movedup_pd(x));
+#endif // SIMD_SUPPORTS(SIMD_SSE3)
+#if SIMD_SUPPORTS(SIMD_AVX)
+			else
+				return vector<double, 2>(_mm_permute_pd(x, constant<L::immediate(0, 2, 1, 2)>));
+#else // SIMD_SUPPORTS(SIMD_AVX)
+			else
+				return vector<double, 2>(_mm_shuffle_pd(x, x, constant<L::immediate(0, 2, 1, 2)>));
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<double, 2> blend(const vector<double, 2> &a, const vector<double, 2> &b) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+			return vector<double, 2>(_mm_blend_pd(a.native(), b.native(), static_cast<int>(M)));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+			// Only the low or the high lane is taken from b, everything else is a plain copy
+			if constexpr(M == 0b01)
+				return vector<double, 2>(_mm_move_sd(a.native(), b.native()));
+			else
+				return vector<double, 2>(_mm_move_sd(b.native(), a.native()));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<double, 2> permute2(const vector<double, 2> &a, const vector<double, 2> &b) {
+			using L = lanes<I...>;
+			// One lane of each vector
+			if constexpr(L::sources(2, 0b10))
+				return vector<double, 2>(_mm_shuffle_pd(a.native(), b.native(), constant<L::immediate(0, 2, 1, 2)>));
+			else
+				return vector<double, 2>(_mm_shuffle_pd(b.native(), a.native(), constant<L::immediate(0, 2, 1, 2)>));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE double extract(const vector<double, 2> &v) {
+			if constexpr(L == 0)
+				return _mm_cvtsd_f64(v.native());
+			else
+				return _mm_cvtsd_f64(_mm_unpackhi_pd(v.native(), v.native()));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int32_t, 4> permute(const vector<std::int32_t, 4> &v) {
+			using L = lanes<I...>;
+			if constexpr(L::identity())
+				return v;
+			else
+				return vector<std::int32_t, 4>(_mm_shuffle_epi32(v.native(), constant<L::immediate(0, 4, 2, 4)>));
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<std::int32_t, 4> blend(const vector<std::int32_t, 4> &a, const vector<std::int32_t, 4> &b) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return vector<std::int32_t, 4>(_mm_blend_epi32(a.native(), b.native(), static_cast<int>(M)));
+#elif SIMD_SUPPORTS(SIMD_SSE4_1)
+			return vector<std::int32_t, 4>(_mm_blend_epi16(a.native(), b.native(), constant<widen_mask(M, 2)>));
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			const __m128i m = _mm_setr_epi32(-static_cast<int>(M & 1), -static_cast<int>((M >> 1) & 1),
+											 -static_cast<int>((M >> 2) & 1), -static_cast<int>((M >> 3) & 1));
+			return vector<std::int32_t, 4>(_mm_or_si128(_mm_and_si128(m, b.native()), _mm_andnot_si128(m, a.native())));
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int32_t, 4> permute2(const vector<std::int32_t, 4> &a, const vector<std::int32_t, 4> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::interleave(4, false, false))
+				return vector<std::int32_t, 4>(_mm_unpacklo_epi32(a.native(), b.native()));
+			else if constexpr(L::interleave(4, false, true))
+				return vector<std::int32_t, 4>(_mm_unpacklo_epi32(b.native(), a.native()));
+			else if constexpr(L::interleave(4, true, false))
+				return vector<std::int32_t, 4>(_mm_unpackhi_epi32(a.native(), b.native()));
+			else if constexpr(L::interleave(4, true, true))
+				return vector<std::int32_t, 4>(_mm_unpackhi_epi32(b.native(), a.native()));
+			else if constexpr(std::is_same_v<L, lanes<0, 1, 4, 5>>)
+				return vector<std::int32_t, 4>(_mm_unpacklo_epi64(a.native(), b.native()));
+			else if constexpr(std::is_same_v<L, lanes<4, 5, 0, 1>>)
+				return vector<std::int32_t, 4>(_mm_unpacklo_epi64(b.native(), a.native()));
+			else if constexpr(std::is_same_v<L, lanes<2, 3, 6, 7>>)
+				return vector<std::int32_t, 4>(_mm_unpackhi_epi64(a.native(), b.native()));
+			else if constexpr(std::is_same_v<L, lanes<6, 7, 2, 3>>)
+				return vector<std::int32_t, 4>(_mm_unpackhi_epi64(b.native(), a.native()));
+			else if constexpr(L::sources(4, 0b1100))
+				return vector<std::int32_t, 4>(_mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a.native()), _mm_castsi128_ps(b.native()),
+																			  constant<L::immediate(0, 4, 2, 4)>)));
+			else if constexpr(L::sources(4, 0b0011))
+				return vector<std::int32_t, 4>(_mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(b.native()), _mm_castsi128_ps(a.native()),
+																			  constant<L::immediate(0, 4, 2, 4)>)));
+			else
+				return detail::blend<L::second()>(detail::permute<(I % 4)...>(a), detail::permute<(I % 4)...>(b));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE std::int32_t extract(const vector<std::int32_t, 4> &v) {
+			if constexpr(L == 0)
+				return _mm_cvtsi128_si32(v.native());
+			else
+				return _mm_cvtsi128_si32(_mm_shuffle_epi32(v.native(), static_cast<int>(L)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int64_t, 2> permute(const vector<std::int64_t, 2> &v) {
+			using L = lanes<I...>;
+			if constexpr(L::identity())
+				return v;
+			else
+				return vector<std::int64_t, 2>(_mm_shuffle_epi32(v.native(), constant<L::qword_immediate()>));
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<std::int64_t, 2> blend(const vector<std::int64_t, 2> &a, const vector<std::int64_t, 2> &b) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			return vector<std::int64_t, 2>(_mm_blend_epi32(a.native(), b.native(), constant<widen_mask(M, 2)>));
+#elif SIMD_SUPPORTS(SIMD_SSE4_1)
+			return vector<std::int64_t, 2>(_mm_blend_epi16(a.native(), b.native(), constant<widen_mask(M, 4)>));
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			const auto blended = detail::blend<M>(vector<double, 2>(_mm_castsi128_pd(a.native())), vector<double, 2>(_mm_castsi128_pd(b.native())));
+			return vector<std::int64_t, 2>(_mm_castpd_si128(blended.native()));
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int64_t, 2> permute2(const vector<std::int64_t, 2> &a, const vector<std::int64_t, 2> &b) {
+			using L = lanes<I...>;
+			if constexpr(std::is_same_v<L, lanes<0, 2>>)
+				return vector<std::int64_t, 2>(_mm_unpacklo_epi64(a.native(), b.native()));
+			else if constexpr(std::is_same_v<L, lanes<2, 0>>)
+				return vector<std::int64_t, 2>(_mm_unpacklo_epi64(b.native(), a.native()));
+			else if constexpr(std::is_same_v<L, lanes<1, 3>>)
+				return vector<std::int64_t, 2>(_mm_unpackhi_epi64(a.native(), b.native()));
+			else if constexpr(std::is_same_v<L, lanes<3, 1>>)
+				return vector<std::int64_t, 2>(_mm_unpackhi_epi64(b.native(), a.native()));
+#if SIMD_SUPPORTS(SIMD_SSSE3)
+			else if constexpr(std::is_same_v<L, lanes<1, 2>>)
+				return vector<std::int64_t, 2>(_mm_alignr_epi8(b.native(), a.native(), 8));
+			else
+				return vector<std::int64_t, 2>(_mm_alignr_epi8(a.native(), b.native(), 8));
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
+			else {
+				const auto shuffled = detail::permute2<I...>(vector<double, 2>(_mm_castsi128_pd(a.native())), vector<double, 2>(_mm_castsi128_pd(b.native())));
+				return vector<std::int64_t, 2>(_mm_castpd_si128(shuffled.native()));
+			}
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE std::int64_t extract(const vector<std::int64_t, 2> &v) {
+			if constexpr(L == 0)
+				return _mm_cvtsi128_si64(v.native());
+			else
+				return _mm_cvtsi128_si64(_mm_unpackhi_epi64(v.native(), v.native()));
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+		template < int... I >
+		SIMD_FORCEINLINE vector<float, 8> permute(const vector<float, 8> &v) {
+			using L = lanes<I...>;
+			const __m256 x = v.native();
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(std::is_same_v<L, lanes<0, 0, 2, 2, 4, 4, 6, 6>>)
+				return vector<float, 8>(_mm256_moveldup_ps(x));
+			else if constexpr(std::is_same_v<L, lanes<1, 1, 3, 3, 5, 5, 7, 7>>)
+				return vector<float, 8>(_mm256_movehdup_ps(x));
+			else if constexpr(L::in_groups(4, true))
+				return vector<float, 8>(_mm256_permute_ps(x, constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::whole_groups(4))
+				return vector<float, 8>(_mm256_permute2f128_ps(x, x, constant<L::group_immediate(4, 4, 2)>));
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			else if constexpr(L::broadcast(0))
+				return vector<float, 8>(_mm256_broadcastss_ps(_mm256_castps256_ps128(x)));
+			else
+				return vector<float, 8>(_mm256_permutevar8x32_ps(x, _mm256_setr_epi32(I...)));
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			else if constexpr(L::single_source_groups(4)) {
+				// Move the 128 bit lanes into place first, then permute within them
+				const __m256 t = constant<L::group_immediate(4, 4, 2)> == 0x10 ? x : _mm256_permute2f128_ps(x, x, constant<L::group_immediate(4, 4, 2)>);
+				if constexpr(L::repeated(4))
+					return vector<float, 8>(_mm256_permute_ps(t, constant<L::immediate(0, 4, 2, 4)>));
+				else
+					return vector<float, 8>(_mm256_permutevar_ps(t, _mm256_setr_epi32((I % 4)...)));
+			} else {
+				// No cross lane permutation: permute both halves duplicated into either 128 bit lane and blend them
+				const __m256i within = _mm256_setr_epi32((I % 4)...);
+				const __m256 lo = _mm256_permutevar_ps(_mm256_permute2f128_ps(x, x, 0x00), within);
+				const __m256 hi = _mm256_permutevar_ps(_mm256_permute2f128_ps(x, x, 0x11), within);
+				return vector<float, 8>(_mm256_blend_ps(lo, hi, constant<static_cast<int>(L::above(4))>));
+			}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<float, 8> blend(const vector<float, 8> &a, const vector<float, 8> &b) {
+			return vector<float, 8>(_mm256_blend_ps(a.native(), b.native(), static_cast<int>(M)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<float, 8> permute2(const vector<float, 8> &a, const vector<float, 8> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::sources(4, 0b1100) && L::in_groups(4, true))
+				return vector<float, 8>(_mm256_shuffle_ps(a.native(), b.native(), constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::sources(4, 0b0011) && L::in_groups(4, true))
+				return vector<float, 8>(_mm256_shuffle_ps(b.native(), a.native(), constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::interleave(4, false, false))
+				return vector<float, 8>(_mm256_unpacklo_ps(a.native(), b.native()));
+			else if constexpr(L::interleave(4, false, true))
+				return vector<float, 8>(_mm256_unpacklo_ps(b.native(), a.native()));
+			else if constexpr(L::interleave(4, true, false))
+				return vector<float, 8>(_mm256_unpackhi_ps(a.native(), b.native()));
+			else if constexpr(L::interleave(4, true, true))
+				return vector<float, 8>(_mm256_unpackhi_ps(b.native(), a.native()));
+			else if constexpr(L::whole_groups(4))
+				return vector<float, 8>(_mm256_permute2f128_ps(a.native(), b.native(), constant<L::group_immediate(4, 4, 4)>));
+			else
+				return detail::blend<L::second()>(detail::permute<(I % 8)...>(a), detail::permute<(I % 8)...>(b));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE float extract(const vector<float, 8> &v) {
+			if constexpr(L < 4)
+				return detail::extract<L>(vector<float, 4>(_mm256_castps256_ps128(v.native())));
+			else
+				return detail::extract<L - 4>(vector<float, 4>(_mm256_extractf128_ps(v.native(), 1)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<double, 4> permute(const vector<double, 4> &v) {
+			using L = lanes<I...>;
+			const __m256d x = v.native();
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(L::in_groups(2, false))
+				return vector<double, 4>(_mm256_permute_pd(x, constant<L::immediate(0, 4, 1, 2)>));
+			else if constexpr(L::whole_groups(2))
+				return vector<double, 4>(_mm256_permute2f128_pd(x, x, constant<L::group_immediate(2, 4, 2)>));
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			else if constexpr(L::broadcast(0))
+				return vector<double, 4>(_mm256_broadcastsd_pd(_mm256_castpd256_pd128(x)));
+			else
+				return vector<double, 4>(_mm256_permute4x64_pd(x, constant<L::immediate(0, 4, 2, 4)>));
+#else // SIMD_SUPPORTS(SIMD_AVX2)
+			else if constexpr(L::single_source_groups(2)) {
+				const __m256d t = constant<L::group_immediate(2, 4, 2)> == 0x10 ? x : _mm256_permute2f128_pd(x, x, constant<L::group_immediate(2, 4, 2)>);
+				return vector<double, 4>(_mm256_permute_pd(t, constant<L::immediate(0, 4, 1, 2)>));
+			} else {
+				const __m256d lo = _mm256_permute_pd(_mm256_permute2f128_pd(x, x, 0x00), constant<L::immediate(0, 4, 1, 2)>);
+				const __m256d hi = _mm256_permute_pd(_mm256_permute2f128_pd(x, x, 0x11), constant<L::immediate(0, 4, 1, 2)>);
+				return vector<double, 4>(_mm256_blend_pd(lo, hi, constant<static_cast<int>(L::above(2))>));
+			}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<double, 4> blend(const vector<double, 4> &a, const vector<double, 4> &b) {
+			return vector<double, 4>(_mm256_blend_pd(a.native(), b.native(), static_cast<int>(M)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<double, 4> permute2(const vector<double, 4> &a, const vector<double, 4> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::sources(2, 0b10) && L::in_groups(2, false))
+				return vector<double, 4>(_mm256_shuffle_pd(a.native(), b.native(), constant<L::immediate(0, 4, 1, 2)>));
+			else if constexpr(L::sources(2, 0b01) && L::in_groups(2, false))
+				return vector<double, 4>(_mm256_shuffle_pd(b.native(), a.native(), constant<L::immediate(0, 4, 1, 2)>));
+			else if constexpr(L::whole_groups(2))
+				return vector<double, 4>(_mm256_permute2f128_pd(a.native(), b.native(), constant<L::group_immediate(2, 4, 4)>));
+			else
+				return detail::blend<L::second()>(detail::permute<(I % 4)...>(a), detail::permute<(I % 4)...>(b));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE double extract(const vector<double, 4> &v) {
+			if constexpr(L < 2)
+				return detail::extract<L>(vector<double, 2>(_mm256_castpd256_pd128(v.native())));
+			else
+				return detail::extract<L - 2>(vector<double, 2>(_mm256_extractf128_pd(v.native(), 1)));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int32_t, 8> permute(const vector<std::int32_t, 8> &v) {
+			using L = lanes<I...>;
+			const __m256i x = v.native();
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(L::in_groups(4, true))
+				return vector<std::int32_t, 8>(_mm256_shuffle_epi32(x, constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::broadcast(0))
+				return vector<std::int32_t, 8>(_mm256_broadcastd_epi32(_mm256_castsi256_si128(x)));
+			else if constexpr(L::whole_groups(4))
+				return vector<std::int32_t, 8>(_mm256_permute2x128_si256(x, x, constant<L::group_immediate(4, 4, 2)>));
+			else if constexpr(L::whole_groups(2))
+				return vector<std::int32_t, 8>(_mm256_permute4x64_epi64(x, constant<L::group_immediate(2, 2, 4)>));
+			else
+				return vector<std::int32_t, 8>(_mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(I...)));
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<std::int32_t, 8> blend(const vector<std::int32_t, 8> &a, const vector<std::int32_t, 8> &b) {
+			return vector<std::int32_t, 8>(_mm256_blend_epi32(a.native(), b.native(), static_cast<int>(M)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int32_t, 8> permute2(const vector<std::int32_t, 8> &a, const vector<std::int32_t, 8> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::interleave(4, false, false))
+				return vector<std::int32_t, 8>(_mm256_unpacklo_epi32(a.native(), b.native()));
+			else if constexpr(L::interleave(4, false, true))
+				return vector<std::int32_t, 8>(_mm256_unpacklo_epi32(b.native(), a.native()));
+			else if constexpr(L::interleave(4, true, false))
+				return vector<std::int32_t, 8>(_mm256_unpackhi_epi32(a.native(), b.native()));
+			else if constexpr(L::interleave(4, true, true))
+				return vector<std::int32_t, 8>(_mm256_unpackhi_epi32(b.native(), a.native()));
+			else if constexpr(std::is_same_v<L, lanes<0, 1, 8, 9, 4, 5, 12, 13>>)
+				return vector<std::int32_t, 8>(_mm256_unpacklo_epi64(a.native(), b.native()));
+			else if constexpr(std::is_same_v<L, lanes<8, 9, 0, 1, 12, 13, 4, 5>>)
+				return vector<std::int32_t, 8>(_mm256_unpacklo_epi64(b.native(), a.native()));
+			else if constexpr(std::is_same_v<L, lanes<2, 3, 10, 11, 6, 7, 14, 15>>)
+				return vector<std::int32_t, 8>(_mm256_unpackhi_epi64(a.native(), b.native()));
+			else if constexpr(std::is_same_v<L, lanes<10, 11, 2, 3, 14, 15, 6, 7>>)
+				return vector<std::int32_t, 8>(_mm256_unpackhi_epi64(b.native(), a.native()));
+			else if constexpr(L::whole_groups(4))
+				return vector<std::int32_t, 8>(_mm256_permute2x128_si256(a.native(), b.native(), constant<L::group_immediate(4, 4, 4)>));
+			else if constexpr(L::sources(4, 0b1100) && L::in_groups(4, true))
+				return vector<std::int32_t, 8>(_mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a.native()), _mm256_castsi256_ps(b.native()),
+																					 constant<L::immediate(0, 4, 2, 4)>)));
+			else if constexpr(L::sources(4, 0b0011) && L::in_groups(4, true))
+				return vector<std::int32_t, 8>(_mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(b.native()), _mm256_castsi256_ps(a.native()),
+																					 constant<L::immediate(0, 4, 2, 4)>)));
+			else
+				return detail::blend<L::second()>(detail::permute<(I % 8)...>(a), detail::permute<(I % 8)...>(b));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE std::int32_t extract(const vector<std::int32_t, 8> &v) {
+			if constexpr(L < 4)
+				return detail::extract<L>(vector<std::int32_t, 4>(_mm256_castsi256_si128(v.native())));
+			else
+				return detail::extract<L - 4>(vector<std::int32_t, 4>(_mm256_extracti128_si256(v.native(), 1)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int64_t, 4> permute(const vector<std::int64_t, 4> &v) {
+			using L = lanes<I...>;
+			const __m256i x = v.native();
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(L::in_groups(2, true))
+				return vector<std::int64_t, 4>(_mm256_shuffle_epi32(x, constant<L::qword_immediate()>));
+			else if constexpr(L::broadcast(0))
+				return vector<std::int64_t, 4>(_mm256_broadcastq_epi64(_mm256_castsi256_si128(x)));
+			else if constexpr(L::whole_groups(2))
+				return vector<std::int64_t, 4>(_mm256_permute2x128_si256(x, x, constant<L::group_immediate(2, 4, 2)>));
+			else
+				return vector<std::int64_t, 4>(_mm256_permute4x64_epi64(x, constant<L::immediate(0, 4, 2, 4)>));
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<std::int64_t, 4> blend(const vector<std::int64_t, 4> &a, const vector<std::int64_t, 4> &b) {
+			return vector<std::int64_t, 4>(_mm256_blend_epi32(a.native(), b.native(), constant<widen_mask(M, 2)>));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int64_t, 4> permute2(const vector<std::int64_t, 4> &a, const vector<std::int64_t, 4> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::interleave(2, false, false))
+				return vector<std::int64_t, 4>(_mm256_unpacklo_epi64(a.native(), b.native()));
+			else if constexpr(L::interleave(2, false, true))
+				return vector<std::int64_t, 4>(_mm256_unpacklo_epi64(b.native(), a.native()));
+			else if constexpr(L::interleave(2, true, false))
+				return vector<std::int64_t, 4>(_mm256_unpackhi_epi64(a.native(), b.native()));
+			else if constexpr(L::interleave(2, true, true))
+				return vector<std::int64_t, 4>(_mm256_unpackhi_epi64(b.native(), a.native()));
+			else if constexpr(L::whole_groups(2))
+				return vector<std::int64_t, 4>(_mm256_permute2x128_si256(a.native(), b.native(), constant<L::group_immediate(2, 4, 4)>));
+			else if constexpr(L::sources(2, 0b10) && L::in_groups(2, false))
+				return vector<std::int64_t, 4>(_mm256_castpd_si256(_mm256_shuffle_pd(_mm256_castsi256_pd(a.native()), _mm256_castsi256_pd(b.native()),
+																					 constant<L::immediate(0, 4, 1, 2)>)));
+			else if constexpr(L::sources(2, 0b01) && L::in_groups(2, false))
+				return vector<std::int64_t, 4>(_mm256_castpd_si256(_mm256_shuffle_pd(_mm256_castsi256_pd(b.native()), _mm256_castsi256_pd(a.native()),
+																					 constant<L::immediate(0, 4, 1, 2)>)));
+			else
+				return detail::blend<L::second()>(detail::permute<(I % 4)...>(a), detail::permute<(I % 4)...>(b));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE std::int64_t extract(const vector<std::int64_t, 4> &v) {
+			if constexpr(L < 2)
+				return detail::extract<L>(vector<std::int64_t, 2>(_mm256_castsi256_si128(v.native())));
+			else
+				return detail::extract<L - 2>(vector<std::int64_t, 2>(_mm256_extracti128_si256(v.native(), 1)));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+		// Index operand of the variable permutations, _mm512_setr_epi32 is a macro in GCC and cannot take a pack
+		template < class T, int... I >
+		SIMD_FORCEINLINE __m512i index_vector() {
+			alignas(64) static constexpr T index[] = { static_cast<T>(I)... };
+			return _mm512_load_si512(index);
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<float, 16> permute(const vector<float, 16> &v) {
+			using L = lanes<I...>;
+			const __m512 x = v.native();
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(L::in_groups(4, true))
+				return vector<float, 16>(_mm512_permute_ps(x, constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::in_groups(4, false))
+				return vector<float, 16>(_mm512_permutevar_ps(x, index_vector<std::int32_t, (I % 4)...>()));
+			else if constexpr(L::broadcast(0))
+				return vector<float, 16>(_mm512_broadcastss_ps(_mm512_castps512_ps128(x)));
+			else if constexpr(L::whole_groups(4))
+				return vector<float, 16>(_mm512_shuffle_f32x4(x, x, constant<L::group_immediate(4, 2, 4)>));
+			else
+				return vector<float, 16>(_mm512_permutexvar_ps(index_vector<std::int32_t, I...>(), x));
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<float, 16> blend(const vector<float, 16> &a, const vector<float, 16> &b) {
+			return vector<float, 16>(_mm512_mask_blend_ps(static_cast<__mmask16>(M), a.native(), b.native()));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<float, 16> permute2(const vector<float, 16> &a, const vector<float, 16> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::sources(4, 0b1100) && L::in_groups(4, true))
+				return vector<float, 16>(_mm512_shuffle_ps(a.native(), b.native(), constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::sources(4, 0b0011) && L::in_groups(4, true))
+				return vector<float, 16>(_mm512_shuffle_ps(b.native(), a.native(), constant<L::immediate(0, 4, 2, 4)>));
+			else if constexpr(L::interleave(4, false, false))
+				return vector<float, 16>(_mm512_unpacklo_ps(a.native(), b.native()));
+			else if constexpr(L::interleave(4, false, true))
+				return vector<float, 16>(_mm512_unpacklo_ps(b.native(), a.native()));
+			else if constexpr(L::interleave(4, true, false))
+				return vector<float, 16>(_mm512_unpackhi_ps(a.native(), b.native()));
+			else if constexpr(L::interleave(4, true, true))
+				return vector<float, 16>(_mm512_unpackhi_ps(b.native(), a.native()));
+			else if constexpr(L::whole_groups(4) && L::sources(16, 0xff00))
+				return vector<float, 16>(_mm512_shuffle_f32x4(a.native(), b.native(), constant<L::group_immediate(4, 2, 4)>));
+			else if constexpr(L::whole_groups(4) && L::sources(16, 0x00ff))
+				return vector<float, 16>(_mm512_shuffle_f32x4(b.native(), a.native(), constant<L::group_immediate(4, 2, 4)>));
+			else
+				return vector<float, 16>(_mm512_permutex2var_ps(a.native(), index_vector<std::int32_t, I...>(), b.native()));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE float extract(const vector<float, 16> &v) {
+			if constexpr(L < 4)
+				return detail::extract<L>(vector<float, 4>(_mm512_castps512_ps128(v.native())));
+			else
+				return detail::extract<L % 4>(vector<float, 4>(_mm512_extractf32x4_ps(v.native(), L / 4)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<double, 8> permute(const vector<double, 8> &v) {
+			using L = lanes<I...>;
+			const __m512d x = v.native();
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(L::in_groups(2, false))
+				return vector<double, 8>(_mm512_permute_pd(x, constant<L::immediate(0, 8, 1, 2)>));
+			else if constexpr(L::broadcast(0))
+				return vector<double, 8>(_mm512_broadcastsd_pd(_mm512_castpd512_pd128(x)));
+			else if constexpr(L::whole_groups(2))
+				return vector<double, 8>(_mm512_shuffle_f64x2(x, x, constant<L::group_immediate(2, 2, 4)>));
+			else if constexpr(L::in_groups(4, true))
+				return vector<double, 8>(_mm512_permutex_pd(x, constant<L::immediate(0, 4, 2, 4)>));
+			else
+				return vector<double, 8>(_mm512_permutexvar_pd(index_vector<std::int64_t, I...>(), x));
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<double, 8> blend(const vector<double, 8> &a, const vector<double, 8> &b) {
+			return vector<double, 8>(_mm512_mask_blend_pd(static_cast<__mmask8>(M), a.native(), b.native()));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<double, 8> permute2(const vector<double, 8> &a, const vector<double, 8> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::sources(2, 0b10) && L::in_groups(2, false))
+				return vector<double, 8>(_mm512_shuffle_pd(a.native(), b.native(), constant<L::immediate(0, 8, 1, 2)>));
+			else if constexpr(L::sources(2, 0b01) && L::in_groups(2, false))
+				return vector<double, 8>(_mm512_shuffle_pd(b.native(), a.native(), constant<L::immediate(0, 8, 1, 2)>));
+			else if constexpr(L::whole_groups(2) && L::sources(8, 0xf0))
+				return vector<double, 8>(_mm512_shuffle_f64x2(a.native(), b.native(), constant<L::group_immediate(2, 2, 4)>));
+			else if constexpr(L::whole_groups(2) && L::sources(8, 0x0f))
+				return vector<double, 8>(_mm512_shuffle_f64x2(b.native(), a.native(), constant<L::group_immediate(2, 2, 4)>));
+			else
+				return vector<double, 8>(_mm512_permutex2var_pd(a.native(), index_vector<std::int64_t, I...>(), b.native()));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE double extract(const vector<double, 8> &v) {
+			if constexpr(L < 4)
+				return detail::extract<L>(vector<double, 4>(_mm512_castpd512_pd256(v.native())));
+			else
+				return detail::extract<L - 4>(vector<double, 4>(_mm512_extractf64x4_pd(v.native(), 1)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int32_t, 16> permute(const vector<std::int32_t, 16> &v) {
+			using L = lanes<I...>;
+			const __m512i x = v.native();
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(L::in_groups(4, true))
+				return vector<std::int32_t, 16>(_mm512_shuffle_epi32(x, static_cast<_MM_PERM_ENUM>(constant<L::immediate(0, 4, 2, 4)>)));
+			else if constexpr(L::broadcast(0))
+				return vector<std::int32_t, 16>(_mm512_broadcastd_epi32(_mm512_castsi512_si128(x)));
+			else if constexpr(L::whole_groups(4))
+				return vector<std::int32_t, 16>(_mm512_shuffle_i32x4(x, x, constant<L::group_immediate(4, 2, 4)>));
+			else
+				return vector<std::int32_t, 16>(_mm512_permutexvar_epi32(index_vector<std::int32_t, I...>(), x));
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<std::int32_t, 16> blend(const vector<std::int32_t, 16> &a, const vector<std::int32_t, 16> &b) {
+			return vector<std::int32_t, 16>(_mm512_mask_blend_epi32(static_cast<__mmask16>(M), a.native(), b.native()));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int32_t, 16> permute2(const vector<std::int32_t, 16> &a, const vector<std::int32_t, 16> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::interleave(4, false, false))
+				return vector<std::int32_t, 16>(_mm512_unpacklo_epi32(a.native(), b.native()));
+			else if constexpr(L::interleave(4, false, true))
+				return vector<std::int32_t, 16>(_mm512_unpacklo_epi32(b.native(), a.native()));
+			else if constexpr(L::interleave(4, true, false))
+				return vector<std::int32_t, 16>(_mm512_unpackhi_epi32(a.native(), b.native()));
+			else if constexpr(L::interleave(4, true, true))
+				return vector<std::int32_t, 16>(_mm512_unpackhi_epi32(b.native(), a.native()));
+			else if constexpr(L::whole_groups(4) && L::sources(16, 0xff00))
+				return vector<std::int32_t, 16>(_mm512_shuffle_i32x4(a.native(), b.native(), constant<L::group_immediate(4, 2, 4)>));
+			else if constexpr(L::whole_groups(4) && L::sources(16, 0x00ff))
+				return vector<std::int32_t, 16>(_mm512_shuffle_i32x4(b.native(), a.native(), constant<L::group_immediate(4, 2, 4)>));
+			else
+				return vector<std::int32_t, 16>(_mm512_permutex2var_epi32(a.native(), index_vector<std::int32_t, I...>(), b.native()));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE std::int32_t extract(const vector<std::int32_t, 16> &v) {
+			if constexpr(L < 4)
+				return detail::extract<L>(vector<std::int32_t, 4>(_mm512_castsi512_si128(v.native())));
+			else
+				return detail::extract<L % 4>(vector<std::int32_t, 4>(_mm512_extracti32x4_epi32(v.native(), L / 4)));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int64_t, 8> permute(const vector<std::int64_t, 8> &v) {
+			using L = lanes<I...>;
+			const __m512i x = v.native();
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(L::in_groups(2, true))
+				return vector<std::int64_t, 8>(_mm512_shuffle_epi32(x, static_cast<_MM_PERM_ENUM>(constant<L::qword_immediate()>)));
+			else if constexpr(L::broadcast(0))
+				return vector<std::int64_t, 8>(_mm512_broadcastq_epi64(_mm512_castsi512_si128(x)));
+			else if constexpr(L::whole_groups(2))
+				return vector<std::int64_t, 8>(_mm512_shuffle_i64x2(x, x, constant<L::group_immediate(2, 2, 4)>));
+			else if constexpr(L::in_groups(4, true))
+				return vector<std::int64_t, 8>(_mm512_permutex_epi64(x, constant<L::immediate(0, 4, 2, 4)>));
+			else
+				return vector<std::int64_t, 8>(_mm512_permutexvar_epi64(index_vector<std::int64_t, I...>(), x));
+		}
+
+		template < std::uint64_t M >
+		SIMD_FORCEINLINE vector<std::int64_t, 8> blend(const vector<std::int64_t, 8> &a, const vector<std::int64_t, 8> &b) {
+			return vector<std::int64_t, 8>(_mm512_mask_blend_epi64(static_cast<__mmask8>(M), a.native(), b.native()));
+		}
+
+		template < int... I >
+		SIMD_FORCEINLINE vector<std::int64_t, 8> permute2(const vector<std::int64_t, 8> &a, const vector<std::int64_t, 8> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::interleave(2, false, false))
+				return vector<std::int64_t, 8>(_mm512_unpacklo_epi64(a.native(), b.native()));
+			else if constexpr(L::interleave(2, false, true))
+				return vector<std::int64_t, 8>(_mm512_unpacklo_epi64(b.native(), a.native()));
+			else if constexpr(L::interleave(2, true, false))
+				return vector<std::int64_t, 8>(_mm512_unpackhi_epi64(a.native(), b.native()));
+			else if constexpr(L::interleave(2, true, true))
+				return vector<std::int64_t, 8>(_mm512_unpackhi_epi64(b.native(), a.native()));
+			else if constexpr(L::whole_groups(2) && L::sources(8, 0xf0))
+				return vector<std::int64_t, 8>(_mm512_shuffle_i64x2(a.native(), b.native(), constant<L::group_immediate(2, 2, 4)>));
+			else if constexpr(L::whole_groups(2) && L::sources(8, 0x0f))
+				return vector<std::int64_t, 8>(_mm512_shuffle_i64x2(b.native(), a.native(), constant<L::group_immediate(2, 2, 4)>));
+			else
+				return vector<std::int64_t, 8>(_mm512_permutex2var_epi64(a.native(), index_vector<std::int64_t, I...>(), b.native()));
+		}
+
+		template < size_t L >
+		SIMD_FORCEINLINE std::int64_t extract(const vector<std::int64_t, 8> &v) {
+			if constexpr(L < 4)
+				return detail::extract<L>(vector<std::int64_t, 4>(_mm512_castsi512_si256(v.native())));
+			else
+				return detail::extract<L - 4>(vector<std::int64_t, 4>(_mm512_extracti64x4_epi64(v.native(), 1)));
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+		// Unsigned lanes reuse the instructions of the signed vector in the same register
+		template < class T, size_t W >
+		SIMD_FORCEINLINE vector<std::make_signed_t<T>, W> as_signed(const vector<T, W> &v) {
+			return vector<std::make_signed_t<T>, W>(v.native());
+		}
+
+		// pshufb control moving lanes of S bytes, counting the bytes from the start of each 128 bit lane
+		template < class L, size_t S >
+		constexpr std::array<std::int8_t, L::count * S> byte_indices() {
+			constexpr int n = static_cast<int>(16 / S);
+			std::array<std::int8_t, L::count * S> bytes{};
+			for(int i = 0; i < L::count; ++i)
+				for(int k = 0; k < static_cast<int>(S); ++k)
+					bytes[i * S + k] = static_cast<std::int8_t>(L::index[i] % n * static_cast<int>(S) + k);
+			return bytes;
+		}
+
+		// 8 and 16 bit lanes: pshufb where every lane stays in its 128 bit lane, lane by lane otherwise
+		template < int... I, class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> permute_bytes(const vector<T, W> &v) {
+#if SIMD_SUPPORTS(SIMD_AVX2)
+			if constexpr(sizeof(T) * W == 32 && lanes<I...>::in_groups(static_cast<int>(16 / sizeof(T)), false)) {
+				static constexpr auto bytes = byte_indices<lanes<I...>, sizeof(T)>();
+				return vector<T, W>(_mm256_shuffle_epi8(v.native(), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes.data()))));
+			}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+#if SIMD_SUPPORTS(SIMD_SSSE3)
+			if constexpr(sizeof(T) * W == 16) {
+				static constexpr auto bytes = byte_indices<lanes<I...>, sizeof(T)>();
+				return vector<T, W>(_mm_shuffle_epi8(v.native(), _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes.data()))));
+			}
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
+			return permute_lanes<I...>(v);
+		}
+
+		// Composite vectors (composite.hpp) move whole parts where every part reads from at most one part
+		// of each vector, and go lane by lane otherwise. Scalar vectors only have the identity,
+		// native vectors without instructions of their own above use the signed ones or go lane by lane.
+		template < int... I, class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> permute(const vector<T, W> &v);
+		template < std::uint64_t M, class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> blend(const vector<T, W> &a, const vector<T, W> &b);
+		template < int... I, class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> permute2(const vector<T, W> &a, const vector<T, W> &b);
+
+		template < std::uint64_t M, class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> blend_or_copy(const vector<T, W> &a, const vector<T, W> &b) {
+			if constexpr(M == 0)
+				return a;
+			else if constexpr(M == all_lanes<W>)
+				return b;
+			else
+				return detail::blend<M>(a, b);
+		}
+
+		// Two vector shuffle, reduced to a permutation of one of them or a blend where the pattern allows
+		template < int... I, class T, size_t W >
+		SIMD_FORCEINLINE vector<T, W> shuffle_two(const vector<T, W> &a, const vector<T, W> &b) {
+			using L = lanes<I...>;
+			if constexpr(L::second() == 0)
+				return detail::permute<I...>(a);
+			else if constexpr(L::second() == all_lanes<W>)
+				return detail::permute<(I - static_cast<int>(W))...>(b);
+			else if constexpr(L::in_groups(1, false))
+				return detail::blend<L::second()>(a, b);
+			else
+				return detail::permute2<I...>(a, b);
+		}
+
+		template < class L, size_t P, class V, size_t... K >
+		SIMD_FORCEINLINE typename V::part_type permute_part(const V &v, std::index_sequence<K...>) {
+			constexpr int pw = static_cast<int>(V::part_width);
+			return detail::permute<(L::index[P * V::part_width + K] % pw)...>(v.part(L::group_source(pw, P)));
+		}
+
+		template < class L, size_t P, class V, size_t... K >
+		SIMD_FORCEINLINE typename V::part_type permute2_part(const V &a, const V &b, std::index_sequence<K...>) {
+			constexpr int pw = static_cast<int>(V::part_width);
+			return detail::shuffle_two<(L::index[P * V::part_width + K] % pw + (L::index[P * V::part_width + K] < L::count ? 0 : pw))...>(
+				a.part(L::paired_source(pw, P, false)), b.part(L::paired_source(pw, P, true)));
+		}
+
+		template < class L, class V, size_t... P >
+		SIMD_FORCEINLINE V permute_parts(const V &v, std::index_sequence<P...>) {
+			V r;
+			((r.part(P) = permute_part<L, P>(v, std::make_index_sequence<V::part_width>())), ...);
+			return r;
+		}
+
+		template < class L, class V, size_t... P >
+		SIMD_FORCEINLINE V permute2_parts(const V &a, const V &b, std::index_sequence<P...>) {
+			V r;
+			((r.part(P) = permute2_part<L, P>(a, b, std::make_index_sequence<V::part_width>())), ...);
+			return r;
+		}
+
+		template < std::uint64_t M, class V, size_t... P >
+		SIMD_FORCEINLINE V blend_parts(const V &a, const V &b, std::index_sequence<P...>) {
+			constexpr size_t pw = V::part_width;
+			V r;
+			((r.part(P) = detail::blend_or_copy<(M >> (P * pw)) & all_lanes<pw>>(a.part(P), b.part(P))), ...);
+			return r;
+		}
+
+		template < int... I, class T, size_t W >
+		vector<T, W> permute(const vector<T, W> &v) {
+			using L = lanes<I...>;
+			if constexpr(L::identity())
+				return v;
+			else if constexpr(has_native_vector<T, W>::value && std::is_unsigned_v<T>)
+				return vector<T, W>(detail::permute<I...>(detail::as_signed(v)).native());
+			else if constexpr(has_native_vector<T, W>::value)
+				return permute_bytes<I...>(v);
+			else if constexpr(L::single_source_groups(static_cast<int>(vector<T, W>::part_width)))
+				return permute_parts<L>(v, std::make_index_sequence<vector<T, W>::part_count>());
+			else
+				return permute_lanes<I...>(v);
+		}
+
+		template < std::uint64_t M, class T, size_t W >
+		vector<T, W> blend(const vector<T, W> &a, const vector<T, W> &b) {
+			if constexpr(W == 1)
+				return M ? b : a;
+			else if constexpr(has_native_vector<T, W>::value && std::is_unsigned_v<T>)
+				return vector<T, W>(detail::blend<M>(detail::as_signed(a), detail::as_signed(b)).native());
+			else if constexpr(has_native_vector<T, W>::value)
+				return blend_lanes<M>(a, b, std::make_index_sequence<W>());
+			else
+				return blend_parts<M>(a, b, std::make_index_sequence<vector<T, W>::part_count>());
+		}
+
+		template < int... I, class T, size_t W >
+		vector<T, W> permute2(const vector<T, W> &a, const vector<T, W> &b) {
+			using L = lanes<I...>;
+			if constexpr(has_native_vector<T, W>::value && std::is_unsigned_v<T>)
+				return vector<T, W>(detail::permute2<I...>(detail::as_signed(a), detail::as_signed(b)).native());
+			else if constexpr(has_native_vector<T, W>::value)
+				return permute2_lanes<I...>(a, b);
+			else if constexpr(L::paired_groups(static_cast<int>(vector<T, W>::part_width)))
+				return permute2_parts<L>(a, b, std::make_index_sequence<vector<T, W>::part_count>());
+			else
+				return permute2_lanes<I...>(a, b);
+		}
+
+		template < size_t L, class T, size_t W >
+		SIMD_FORCEINLINE T extract(const vector<T, W> &v) {
+			if constexpr(W == 1)
+				return v[0];
+			else if constexpr(has_native_vector<T, W>::value && std::is_unsigned_v<T>)
+				return static_cast<T>(detail::extract<L>(detail::as_signed(v)));
+			else if constexpr(has_native_vector<T, W>::value)
+				return v[L];
+			else
+				return detail::extract<L % vector<T, W>::part_width>(v.part(L / vector<T, W>::part_width));
+		}
+
+		template < int L, class V, size_t... K >
+		SIMD_FORCEINLINE V broadcast_lanes(const V &v, std::index_sequence<K...>) {
+			return detail::permute<(static_cast<int>(K) * 0 + L)...>(v);
+		}
+
+		template < class V, size_t... K >
+		SIMD_FORCEINLINE V reverse_lanes(const V &v, std::index_sequence<K...>) {
+			return detail::permute<static_cast<int>(V::width - 1 - K)...>(v);
+		}
+
+		template < int N, class V, size_t... K >
+		SIMD_FORCEINLINE V rotate_lanes(const V &v, std::index_sequence<K...>) {
+			constexpr int w = static_cast<int>(V::width);
+			return detail::permute<((static_cast<int>(K) + N % w + w) % w)...>(v);
+		}
+
+	} // namespace detail
+
+	// Lane i of the result is lane I_i of v, e.g. shuffle<1, 0, 3, 2>(v) swaps neighbouring lanes
+	template < int... I, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> shuffle(const vector<T, W> &v) {
+		static_assert(sizeof...(I) == W, "shuffle requires one index per lane");
+		static_assert(((I >= 0 && I < static_cast<int>(W)) && ...), "shuffle index out of range");
+		return detail::permute<I...>(v);
+	}
+
+	// Lane i of the result is lane I_i of the lanes of a followed by those of b, e.g.
+	// shuffle<0, 4, 1, 5>(a, b) interleaves the low halves of two vectors with four lanes
+	template < int... I, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> shuffle(const vector<T, W> &a, const vector<T, W> &b) {
+		static_assert(sizeof...(I) == W, "shuffle requires one index per lane");
+		static_assert(((I >= 0 && I < static_cast<int>(2 * W)) && ...), "shuffle index out of range");
+		return detail::shuffle_two<I...>(a, b);
+	}
+
+	// Every lane set to lane L of v
+	template < size_t L, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> broadcast(const vector<T, W> &v) {
+		static_assert(L < W, "lane out of range");
+		return detail::broadcast_lanes<static_cast<int>(L)>(v, std::make_index_sequence<W>());
+	}
+
+	template < class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> reverse(const vector<T, W> &v) {
+		return detail::reverse_lanes(v, std::make_index_sequence<W>());
+	}
+
+	// Lane i of the result is lane (i + N) mod W of v, so the lanes move N places towards lane 0
+	template < int N, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> rotate_lanes(const vector<T, W> &v) {
+		return detail::rotate_lanes<N>(v, std::make_index_sequence<W>());
+	}
+
+	// Lanes of b where bit i of M is set and lanes of a otherwise, the compile time version of select()
+	template < std::uint64_t M, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> blend(const vector<T, W> &a, const vector<T, W> &b) {
+		static_assert((M & ~detail::all_lanes<W>) == 0, "blend mask has bits beyond the lanes");
+		return detail::blend_or_copy<M>(a, b);
+	}
+
+	template < size_t L, class T, size_t W >
+	SIMD_FORCEINLINE T extract(const vector<T, W> &v) {
+		static_assert(L < W, "lane out of range");
+		return detail::extract<L>(v);
+	}
+
+	// Copy of v with lane L replaced by x
+	template < size_t L, class T, size_t W >
+	SIMD_FORCEINLINE vector<T, W> insert(const vector<T, W> &v, typename vector<T, W>::type x) {
+		static_assert(L < W, "lane out of range");
+		return detail::blend_or_copy<std::uint64_t(1) << L>(v, vector<T, W>(x));
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
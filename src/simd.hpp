@@ -1,6 +1,9 @@
 #pragma once
 
 #include "vector.hpp"
+#include "scalar.hpp"
+#include "composite.hpp"
+#include "dispatch.hpp"
 #include "conversion.hpp"
 #include "float32x4.hpp"
 #include "float32x8.hpp"
@@ -9,4 +12,34 @@
 #include "int32x4.hpp"
 #include "int32x8.hpp"
 #include "int64x2.hpp"
-#include "int64x4.hpp"
\ No newline at end of file
+#include "int64x4.hpp"
+#include "float32x16.hpp"
+#include "float64x8.hpp"
+#include "int32x16.hpp"
+#include "int64x8.hpp"
+#include "int16x8.hpp"
+#include "int16x16.hpp"
+#include "int8x16.hpp"
+#include "int8x32.hpp"
+#include "uint32x4.hpp"
+#include "uint32x8.hpp"
+#include "uint64x2.hpp"
+#include "uint64x4.hpp"
+#include "uint16x8.hpp"
+#include "uint16x16.hpp"
+#include "uint8x16.hpp"
+#include "uint8x32.hpp"
+#include "divider.hpp"
+#include "algorithm.hpp"
+#include "allocator.hpp"
+#include "expression.hpp"
+#include "float16.hpp"
+#include "bfloat16.hpp"
+#include "gather.hpp"
+#include "masked.hpp"
+#include "math.hpp"
+#include "reduce.hpp"
+#include "shift.hpp"
+#include "shuffle.hpp"
+#include "soa.hpp"
+#include "transpose.hpp"
\ No newline at end of file
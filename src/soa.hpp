@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "allocator.hpp"
+#include "algorithm.hpp"
+#include "transpose.hpp"
+
+// Structure of arrays: every field of the records lives in its own aligned column (allocator.hpp), so
+// consecutive records of a field load into one vector. Records stored as arrays of structs convert in blocks
+// of W records, which are K vectors for records of K fields, transposed in registers (transpose.hpp).
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		template < class V, size_t K, size_t... T >
+		SIMD_FORCEINLINE std::array<V, K> load_block(const typename V::type *vals, std::index_sequence<T...>) {
+			return { { V(vals + T * V::width)... } };
+		}
+
+		template < class V, size_t K, size_t... T >
+		SIMD_FORCEINLINE void store_block(typename V::type *vals, const std::array<V, K> &v, std::index_sequence<T...>) {
+			(v[T].store(vals + T * V::width), ...);
+		}
+
+		template < class V, size_t K, size_t... J >
+		SIMD_FORCEINLINE std::array<V, K> load_fields(const std::array<const typename V::type *, K> &columns, size_t index, std::index_sequence<J...>) {
+			return { { V(columns[J] + index)... } };
+		}
+
+		template < class V, size_t K, size_t... J >
+		SIMD_FORCEINLINE void store_fields(const std::array<typename V::type *, K> &columns, size_t index, const std::array<V, K> &v, std::index_sequence<J...>) {
+			(v[J].store(columns[J] + index), ...);
+		}
+
+		template < size_t K, class T >
+		void aos_to_soa(const T *aos, size_t count, const std::array<T *, K> &columns) {
+			constexpr size_t W = transpose_width<T>;
+			using V = vector<T, W>;
+			size_t i = 0;
+			for(; i + W <= count; i += W) {
+				const auto fields = detail::deinterleave(detail::load_block<V, K>(aos + i * K, std::make_index_sequence<K>()));
+				detail::store_fields(columns, i, fields, std::make_index_sequence<K>());
+			}
+			// The records and columns only look like T, so the tail copies each field as bytes
+			for(; i < count; ++i)
+				for(size_t j = 0; j < K; ++j)
+					std::memcpy(columns[j] + i, aos + i * K + j, sizeof(T));
+		}
+
+		template < size_t K, class T >
+		void soa_to_aos(const std::array<const T *, K> &columns, size_t count, T *aos) {
+			constexpr size_t W = transpose_width<T>;
+			using V = vector<T, W>;
+			size_t i = 0;
+			for(; i + W <= count; i += W) {
+				const auto records = detail::interleave(detail::load_fields<V>(columns, i, std::make_index_sequence<K>()));
+				detail::store_block(aos + i * K, records, std::make_index_sequence<K>());
+			}
+			for(; i < count; ++i)
+				for(size_t j = 0; j < K; ++j)
+					std::memcpy(aos + i * K + j, columns[j] + i, sizeof(T));
+		}
+
+		// Fields are moved as their bits, through float or double vectors of the same size
+		template < size_t Size >
+		using transpose_type = std::conditional_t<Size == 4, float, double>;
+
+	} // namespace detail
+
+	template < class... Fields >
+	class soa {
+	public:
+		static constexpr size_t field_count = sizeof...(Fields);
+
+		template < size_t I >
+		using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+		soa() = default;
+		explicit soa(size_t size) {
+			resize(size);
+		}
+
+		size_t size() const {
+			return m_size;
+		}
+
+		void resize(size_t size) {
+			std::apply([size](auto &... c) { (c.resize(size), ...); }, m_columns);
+			m_size = size;
+		}
+
+		void clear() {
+			resize(0);
+		}
+
+		void push_back(const Fields &... values) {
+			push_back(std::index_sequence_for<Fields...>(), values...);
+		}
+
+		template < size_t I >
+		field_type<I> *column() {
+			return std::get<I>(m_columns).data();
+		}
+
+		template < size_t I >
+		const field_type<I> *column() const {
+			return std::get<I>(m_columns).data();
+		}
+
+		template < size_t I >
+		field_type<I> &get(size_t index) {
+			return std::get<I>(m_columns)[index];
+		}
+
+		template < size_t I >
+		const field_type<I> &get(size_t index) const {
+			return std::get<I>(m_columns)[index];
+		}
+
+		// W elements of field I from index on, which has to be a multiple of W; the vector may reach past size()
+		// into the padding of the column
+		template < size_t I, size_t W = native_width<field_type<I>> >
+		vector<field_type<I>, W> load(size_t index) const {
+			static_assert(padded<field_type<I>, W>, "vectors have to fit into the column padding");
+			assert(index % W == 0);
+			return vector<field_type<I>, W>(column<I>() + index, aligned_load{});
+		}
+
+		template < size_t I, size_t W >
+		void store(size_t index, const vector<field_type<I>, W> &v) {
+			static_assert(padded<field_type<I>, W>, "vectors have to fit into the column padding");
+			assert(index % W == 0);
+			v.store(column<I>() + index, aligned_store{});
+		}
+
+		// Calls f with references to vectors of W elements of every field and stores them back. The last
+		// vectors reach into the padding of the columns, so there is no tail to handle.
+		template < size_t W, class F >
+		void for_each(F f) {
+			for(size_t i = 0; i < m_size; i += W)
+				for_each_at<W>(f, i, std::index_sequence_for<Fields...>());
+		}
+
+		// Replaces the contents with the records of aos, a struct made up of exactly the fields in order
+		template < class S >
+		void assign_aos(const S *aos, size_t count) {
+			using T = aos_type<S>;
+			resize(count);
+			detail::aos_to_soa<field_count>(reinterpret_cast<const T *>(aos), count,
+											std::apply([](auto &... c) { return std::array<T *, field_count>{ { reinterpret_cast<T *>(c.data())... } }; }, m_columns));
+		}
+
+		// Writes size() records to aos
+		template < class S >
+		void store_aos(S *aos) const {
+			using T = aos_type<S>;
+			detail::soa_to_aos<field_count>(
+				std::apply([](const auto &... c) { return std::array<const T *, field_count>{ { reinterpret_cast<const T *>(c.data())... } }; }, m_columns),
+				m_size, reinterpret_cast<T *>(aos));
+		}
+
+	private:
+		template < class T, size_t W >
+		static constexpr bool padded = aligned_allocator<T>::alignment % (W * sizeof(T)) == 0;
+
+		template < class S >
+		using aos_type = std::enable_if_t<((sizeof(Fields) == sizeof(field_type<0>)) && ...) && (sizeof(field_type<0>) == 4 || sizeof(field_type<0>) == 8) &&
+											  sizeof(S) == field_count * sizeof(field_type<0>) && std::is_trivially_copyable_v<S>,
+										  detail::transpose_type<sizeof(field_type<0>)>>;
+
+		template < size_t... I >
+		void push_back(std::index_sequence<I...>, const Fields &... values) {
+			(std::get<I>(m_columns).push_back(values), ...);
+			++m_size;
+		}
+
+		template < size_t W, class F, size_t... I >
+		void for_each_at(F &f, size_t index, std::index_sequence<I...>) {
+			auto v = std::make_tuple(load<I, W>(index)...);
+			f(std::get<I>(v)...);
+			(store<I, W>(index, std::get<I>(v)), ...);
+		}
+
+		std::tuple<aligned_vector<Fields>...> m_columns;
+		size_t m_size = 0;
+	};
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,322 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "algorithm.hpp"
+#include "shuffle.hpp"
+
+// Transposes of W vectors of W lanes in registers. The native vectors up to 256 bits use the unpack,
+// shufps and vperm2f128 sequences (8 instructions for 4x4, 24 for 8x8), other native vectors log2(W)
+// rounds of two vector shuffles and composite vectors (composite.hpp) the transposes of their parts.
+// The matrix transpose on top of them walks through tiles that stay in the L1 cache.
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+	namespace detail {
+
+		template < class V, size_t... I >
+		SIMD_FORCEINLINE std::pair<V, V> unzip(const V &a, const V &b, std::index_sequence<I...>) {
+			return { simd::shuffle<static_cast<int>(2 * I)...>(a, b), simd::shuffle<static_cast<int>(2 * I + 1)...>(a, b) };
+		}
+
+		template < class V, size_t... I >
+		SIMD_FORCEINLINE std::pair<V, V> zip(const V &a, const V &b, std::index_sequence<I...>) {
+			// Lane k of the interleaved a0 b0 a1 b1 ... is lane k / 2 of a or b
+			constexpr size_t W = V::width;
+			return { simd::shuffle<static_cast<int>(I / 2 + I % 2 * W)...>(a, b), simd::shuffle<static_cast<int>((W + I) / 2 + (W + I) % 2 * W)...>(a, b) };
+		}
+
+		// Splits every pair of vectors into the even and odd lanes of their concatenation: after log2(K) rounds
+		// vector j holds field j of K interleaved fields
+		template < class V, size_t K, size_t... P >
+		SIMD_FORCEINLINE std::array<V, K> unzip_round(const std::array<V, K> &v, std::index_sequence<P...>) {
+			const std::array<std::pair<V, V>, K / 2> halves{ { detail::unzip(v[2 * P], v[2 * P + 1], std::make_index_sequence<V::width>())... } };
+			return { { halves[P].first..., halves[P].second... } };
+		}
+
+		// Inverse of unzip_round
+		template < class V, size_t K, size_t... P >
+		SIMD_FORCEINLINE std::array<V, K> zip_round(const std::array<V, K> &v, std::index_sequence<P...>) {
+			const std::array<std::pair<V, V>, K / 2> halves{ { detail::zip(v[P], v[P + K / 2], std::make_index_sequence<V::width>())... } };
+			std::array<V, K> res;
+			((res[2 * P] = halves[P].first, res[2 * P + 1] = halves[P].second), ...);
+			return res;
+		}
+
+		template < size_t Round = 1, class V, size_t K >
+		SIMD_FORCEINLINE std::array<V, K> unzip_rounds(const std::array<V, K> &v) {
+			const auto res = detail::unzip_round(v, std::make_index_sequence<K / 2>());
+			if constexpr((size_t(1) << Round) < K)
+				return detail::unzip_rounds<Round + 1>(res);
+			else
+				return res;
+		}
+
+		template < size_t Round = 1, class V, size_t K >
+		SIMD_FORCEINLINE std::array<V, K> zip_rounds(const std::array<V, K> &c) {
+			const auto res = detail::zip_round(c, std::make_index_sequence<K / 2>());
+			if constexpr((size_t(1) << Round) < K)
+				return detail::zip_rounds<Round + 1>(res);
+			else
+				return res;
+		}
+
+		// Lane i of field j from K fields in vectors of W lanes is element e = i * K + j, in vector e / W.
+		// Every shuffle takes the lanes found in vector T and keeps the others of the previous step.
+		template < size_t K, size_t W >
+		constexpr int field_lane(size_t t, size_t j, size_t i) {
+			const size_t e = i * K + j;
+			return e / W == t ? static_cast<int>(W + e % W) : (t == 1 && e / W == 0 ? static_cast<int>(e % W) : static_cast<int>(i));
+		}
+
+		// Lane i of record vector t is element e = t * W + i, which is lane e / K of field e % K
+		template < size_t K, size_t W >
+		constexpr int record_lane(size_t t, size_t j, size_t i) {
+			const size_t e = t * W + i;
+			return e % K == j ? static_cast<int>(W + e / K) : (j == 1 && e % K == 0 ? static_cast<int>(e / K) : static_cast<int>(i));
+		}
+
+		template < size_t K, size_t J, size_t T, class V, size_t... I >
+		SIMD_FORCEINLINE V collect_field(const std::array<V, K> &v, const V &acc, std::index_sequence<I...> lanes) {
+			const V res = simd::shuffle<detail::field_lane<K, V::width>(T, J, I)...>(acc, v[T]);
+			if constexpr(T + 1 < K)
+				return detail::collect_field<K, J, T + 1>(v, res, lanes);
+			else
+				return res;
+		}
+
+		template < size_t K, size_t T, size_t J, class V, size_t... I >
+		SIMD_FORCEINLINE V collect_record(const std::array<V, K> &c, const V &acc, std::index_sequence<I...> lanes) {
+			const V res = simd::shuffle<detail::record_lane<K, V::width>(T, J, I)...>(acc, c[J]);
+			if constexpr(J + 1 < K)
+				return detail::collect_record<K, T, J + 1>(c, res, lanes);
+			else
+				return res;
+		}
+
+		template < class V, size_t K, size_t... J >
+		SIMD_FORCEINLINE std::array<V, K> collect_fields(const std::array<V, K> &v, std::index_sequence<J...>) {
+			return { { detail::collect_field<K, J, 1>(v, v[0], std::make_index_sequence<V::width>())... } };
+		}
+
+		template < class V, size_t K, size_t... T >
+		SIMD_FORCEINLINE std::array<V, K> collect_records(const std::array<V, K> &c, std::index_sequence<T...>) {
+			return { { detail::collect_record<K, T, 1>(c, c[0], std::make_index_sequence<V::width>())... } };
+		}
+
+#if SIMD_SUPPORTS(SIMD_SSE)
+		SIMD_FORCEINLINE std::array<vector<float, 4>, 4> transpose(const std::array<vector<float, 4>, 4> &r) {
+			const __m128 t0 = _mm_unpacklo_ps(r[0].native(), r[1].native());
+			const __m128 t1 = _mm_unpacklo_ps(r[2].native(), r[3].native());
+			const __m128 t2 = _mm_unpackhi_ps(r[0].native(), r[1].native());
+			const __m128 t3 = _mm_unpackhi_ps(r[2].native(), r[3].native());
+			return { { vector<float, 4>(_mm_movelh_ps(t0, t1)), vector<float, 4>(_mm_movehl_ps(t1, t0)), vector<float, 4>(_mm_movelh_ps(t2, t3)),
+					   vector<float, 4>(_mm_movehl_ps(t3, t2)) } };
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE)
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+		SIMD_FORCEINLINE std::array<vector<double, 2>, 2> transpose(const std::array<vector<double, 2>, 2> &r) {
+			return { { vector<double, 2>(_mm_unpacklo_pd(r[0].native(), r[1].native())), vector<double, 2>(_mm_unpackhi_pd(r[0].native(), r[1].native())) } };
+		}
+
+		SIMD_FORCEINLINE std::array<vector<std::int32_t, 4>, 4> transpose(const std::array<vector<std::int32_t, 4>, 4> &r) {
+			const __m128i t0 = _mm_unpacklo_epi32(r[0].native(), r[1].native());
+			const __m128i t1 = _mm_unpacklo_epi32(r[2].native(), r[3].native());
+			const __m128i t2 = _mm_unpackhi_epi32(r[0].native(), r[1].native());
+			const __m128i t3 = _mm_unpackhi_epi32(r[2].native(), r[3].native());
+			return { { vector<std::int32_t, 4>(_mm_unpacklo_epi64(t0, t1)), vector<std::int32_t, 4>(_mm_unpackhi_epi64(t0, t1)),
+					   vector<std::int32_t, 4>(_mm_unpacklo_epi64(t2, t3)), vector<std::int32_t, 4>(_mm_unpackhi_epi64(t2, t3)) } };
+		}
+
+		SIMD_FORCEINLINE std::array<vector<std::int64_t, 2>, 2> transpose(const std::array<vector<std::int64_t, 2>, 2> &r) {
+			return { { vector<std::int64_t, 2>(_mm_unpacklo_epi64(r[0].native(), r[1].native())),
+					   vector<std::int64_t, 2>(_mm_unpackhi_epi64(r[0].native(), r[1].native())) } };
+		}
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+		// Rows 0-3 and 4-7 are transposed as 4x4 blocks within the 128 bit halves, vperm2f128 swaps the
+		// off-diagonal blocks
+		SIMD_FORCEINLINE std::array<vector<float, 8>, 8> transpose(const std::array<vector<float, 8>, 8> &r) {
+			const __m256 t0 = _mm256_unpacklo_ps(r[0].native(), r[1].native());
+			const __m256 t1 = _mm256_unpackhi_ps(r[0].native(), r[1].native());
+			const __m256 t2 = _mm256_unpacklo_ps(r[2].native(), r[3].native());
+			const __m256 t3 = _mm256_unpackhi_ps(r[2].native(), r[3].native());
+			const __m256 t4 = _mm256_unpacklo_ps(r[4].native(), r[5].native());
+			const __m256 t5 = _mm256_unpackhi_ps(r[4].native(), r[5].native());
+			const __m256 t6 = _mm256_unpacklo_ps(r[6].native(), r[7].native());
+			const __m256 t7 = _mm256_unpackhi_ps(r[6].native(), r[7].native());
+			const __m256 s0 = _mm256_shuffle_ps(t0, t2, 0x44);
+			const __m256 s1 = _mm256_shuffle_ps(t0, t2, 0xee);
+			const __m256 s2 = _mm256_shuffle_ps(t1, t3, 0x44);
+			const __m256 s3 = _mm256_shuffle_ps(t1, t3, 0xee);
+			const __m256 s4 = _mm256_shuffle_ps(t4, t6, 0x44);
+			const __m256 s5 = _mm256_shuffle_ps(t4, t6, 0xee);
+			const __m256 s6 = _mm256_shuffle_ps(t5, t7, 0x44);
+			const __m256 s7 = _mm256_shuffle_ps(t5, t7, 0xee);
+			return { { vector<float, 8>(_mm256_permute2f128_ps(s0, s4, 0x20)), vector<float, 8>(_mm256_permute2f128_ps(s1, s5, 0x20)),
+					   vector<float, 8>(_mm256_permute2f128_ps(s2, s6, 0x20)), vector<float, 8>(_mm256_permute2f128_ps(s3, s7, 0x20)),
+					   vector<float, 8>(_mm256_permute2f128_ps(s0, s4, 0x31)), vector<float, 8>(_mm256_permute2f128_ps(s1, s5, 0x31)),
+					   vector<float, 8>(_mm256_permute2f128_ps(s2, s6, 0x31)), vector<float, 8>(_mm256_permute2f128_ps(s3, s7, 0x31)) } };
+		}
+
+		SIMD_FORCEINLINE std::array<vector<double, 4>, 4> transpose(const std::array<vector<double, 4>, 4> &r) {
+			const __m256d t0 = _mm256_unpacklo_pd(r[0].native(), r[1].native());
+			const __m256d t1 = _mm256_unpackhi_pd(r[0].native(), r[1].native());
+			const __m256d t2 = _mm256_unpacklo_pd(r[2].native(), r[3].native());
+			const __m256d t3 = _mm256_unpackhi_pd(r[2].native(), r[3].native());
+			return { { vector<double, 4>(_mm256_permute2f128_pd(t0, t2, 0x20)), vector<double, 4>(_mm256_permute2f128_pd(t1, t3, 0x20)),
+					   vector<double, 4>(_mm256_permute2f128_pd(t0, t2, 0x31)), vector<double, 4>(_mm256_permute2f128_pd(t1, t3, 0x31)) } };
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+		SIMD_FORCEINLINE std::array<vector<std::int32_t, 8>, 8> transpose(const std::array<vector<std::int32_t, 8>, 8> &r) {
+			const __m256i t0 = _mm256_unpacklo_epi32(r[0].native(), r[1].native());
+			const __m256i t1 = _mm256_unpackhi_epi32(r[0].native(), r[1].native());
+			const __m256i t2 = _mm256_unpacklo_epi32(r[2].native(), r[3].native());
+			const __m256i t3 = _mm256_unpackhi_epi32(r[2].native(), r[3].native());
+			const __m256i t4 = _mm256_unpacklo_epi32(r[4].native(), r[5].native());
+			const __m256i t5 = _mm256_unpackhi_epi32(r[4].native(), r[5].native());
+			const __m256i t6 = _mm256_unpacklo_epi32(r[6].native(), r[7].native());
+			const __m256i t7 = _mm256_unpackhi_epi32(r[6].native(), r[7].native());
+			const __m256i s0 = _mm256_unpacklo_epi64(t0, t2);
+			const __m256i s1 = _mm256_unpackhi_epi64(t0, t2);
+			const __m256i s2 = _mm256_unpacklo_epi64(t1, t3);
+			const __m256i s3 = _mm256_unpackhi_epi64(t1, t3);
+			const __m256i s4 = _mm256_unpacklo_epi64(t4, t6);
+			const __m256i s5 = _mm256_unpackhi_epi64(t4, t6);
+			const __m256i s6 = _mm256_unpacklo_epi64(t5, t7);
+			const __m256i s7 = _mm256_unpackhi_epi64(t5, t7);
+			return { { vector<std::int32_t, 8>(_mm256_permute2x128_si256(s0, s4, 0x20)), vector<std::int32_t, 8>(_mm256_permute2x128_si256(s1, s5, 0x20)),
+					   vector<std::int32_t, 8>(_mm256_permute2x128_si256(s2, s6, 0x20)), vector<std::int32_t, 8>(_mm256_permute2x128_si256(s3, s7, 0x20)),
+					   vector<std::int32_t, 8>(_mm256_permute2x128_si256(s0, s4, 0x31)), vector<std::int32_t, 8>(_mm256_permute2x128_si256(s1, s5, 0x31)),
+					   vector<std::int32_t, 8>(_mm256_permute2x128_si256(s2, s6, 0x31)), vector<std::int32_t, 8>(_mm256_permute2x128_si256(s3, s7, 0x31)) } };
+		}
+
+		SIMD_FORCEINLINE std::array<vector<std::int64_t, 4>, 4> transpose(const std::array<vector<std::int64_t, 4>, 4> &r) {
+			const __m256i t0 = _mm256_unpacklo_epi64(r[0].native(), r[1].native());
+			const __m256i t1 = _mm256_unpackhi_epi64(r[0].native(), r[1].native());
+			const __m256i t2 = _mm256_unpacklo_epi64(r[2].native(), r[3].native());
+			const __m256i t3 = _mm256_unpackhi_epi64(r[2].native(), r[3].native());
+			return { { vector<std::int64_t, 4>(_mm256_permute2x128_si256(t0, t2, 0x20)), vector<std::int64_t, 4>(_mm256_permute2x128_si256(t1, t3, 0x20)),
+					   vector<std::int64_t, 4>(_mm256_permute2x128_si256(t0, t2, 0x31)), vector<std::int64_t, 4>(_mm256_permute2x128_si256(t1, t3, 0x31)) } };
+		}
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+		template < class T, size_t W >
+		std::array<vector<T, W>, W> transpose(const std::array<vector<T, W>, W> &r) {
+			if constexpr(W == 1) {
+				return r;
+			} else if constexpr(has_native_vector<T, W>::value) {
+				return detail::unzip_rounds(r);
+			} else {
+				// Block (i, j) of parts moves to (j, i) and is transposed on its own
+				constexpr size_t pw = vector<T, W>::part_width;
+				std::array<vector<T, W>, W> res;
+				for(size_t i = 0; i < vector<T, W>::part_count; ++i) {
+					for(size_t j = 0; j < vector<T, W>::part_count; ++j) {
+						std::array<vector<T, pw>, pw> block;
+						for(size_t k = 0; k < pw; ++k)
+							block[k] = r[i * pw + k].part(j);
+						block = detail::transpose(block);
+						for(size_t k = 0; k < pw; ++k)
+							res[j * pw + k].part(i) = block[k];
+					}
+				}
+				return res;
+			}
+		}
+
+		// K vectors of interleaved records to K vectors of fields, and back. Records of W fields in vectors
+		// of W lanes are rows of a matrix, whose columns are the fields.
+		template < class V, size_t K >
+		SIMD_FORCEINLINE std::array<V, K> deinterleave(const std::array<V, K> &v) {
+			if constexpr(K == 1)
+				return v;
+			else if constexpr(K == V::width)
+				return detail::transpose(v);
+			else if constexpr((K & (K - 1)) == 0)
+				return detail::unzip_rounds(v);
+			else
+				return detail::collect_fields(v, std::make_index_sequence<K>());
+		}
+
+		template < class V, size_t K >
+		SIMD_FORCEINLINE std::array<V, K> interleave(const std::array<V, K> &c) {
+			if constexpr(K == 1)
+				return c;
+			else if constexpr(K == V::width)
+				return detail::transpose(c);
+			else if constexpr((K & (K - 1)) == 0)
+				return detail::zip_rounds(c);
+			else
+				return detail::collect_records(c, std::make_index_sequence<K>());
+		}
+
+		// Widest vector with a transpose of its own, float32x8 or float32x4 (int32 likewise) where available
+		template < class T >
+		constexpr size_t transpose_width = native_width<T> < 8 ? native_width<T> : 8;
+
+		// Square tiles of 256 bytes per row, 16 KiB for floats
+		template < class T >
+		constexpr size_t transpose_tile = 256 / sizeof(T);
+
+		// W rows of in from column j on, written as W rows of out
+		template < class V, size_t... R >
+		SIMD_FORCEINLINE void transpose_block(const typename V::type *in, size_t in_stride, typename V::type *out, size_t out_stride,
+											  std::index_sequence<R...>) {
+			const auto t = detail::transpose(std::array<V, V::width>{ { V(in + R * in_stride)... } });
+			(t[R].store(out + R * out_stride), ...);
+		}
+
+		template < class T >
+		void transpose_tile_at(const T *in, size_t rows, size_t cols, T *out, size_t i0, size_t i1, size_t j0, size_t j1) {
+			constexpr size_t W = transpose_width<T>;
+			size_t i = i0;
+			for(; i + W <= i1; i += W) {
+				size_t j = j0;
+				for(; j + W <= j1; j += W)
+					detail::transpose_block<vector<T, W>>(in + i * cols + j, cols, out + j * rows + i, rows, std::make_index_sequence<W>());
+				for(; j < j1; ++j)
+					for(size_t k = i; k < i + W; ++k)
+						out[j * rows + k] = in[k * cols + j];
+			}
+			for(; i < i1; ++i)
+				for(size_t j = j0; j < j1; ++j)
+					out[j * rows + i] = in[i * cols + j];
+		}
+
+	} // namespace detail
+
+	// Replaces the W rows of W lanes in r with the columns, e.g. lane i of r[j] becomes lane j of r[i]
+	template < class T, size_t W >
+	SIMD_FORCEINLINE void transpose(std::array<vector<T, W>, W> &r) {
+		r = detail::transpose(r);
+	}
+
+	// The same for rows passed one by one, e.g. transpose(r0, r1, r2, r3) for four float32x4
+	template < class T, size_t W, class... R >
+	SIMD_FORCEINLINE void transpose(vector<T, W> &r0, R &... rows) {
+		static_assert(sizeof...(R) + 1 == W && (std::is_same_v<R, vector<T, W>> && ...), "transpose needs W vectors of W lanes");
+		const auto t = detail::transpose(std::array<vector<T, W>, W>{ { r0, rows... } });
+		r0 = t[0];
+		size_t i = 1;
+		((rows = t[i++]), ...);
+	}
+
+	// Out of place transpose of the row-major rows x cols matrix in to the cols x rows matrix out
+	template < class T >
+	void transpose(const T *in, size_t rows, size_t cols, T *out) {
+		constexpr size_t tile = detail::transpose_tile<T>;
+		for(size_t i = 0; i < rows; i += tile)
+			for(size_t j = 0; j < cols; j += tile)
+				detail::transpose_tile_at(in, rows, cols, out, i, i + tile < rows ? i + tile : rows, j, j + tile < cols ? j + tile : cols);
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
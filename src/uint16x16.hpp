@@ -0,0 +1,355 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+	template <>
+	class vector<std::uint16_t, 16> : public vector_base<std::uint16_t, 16> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+	public:
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm256_set1_epi16(f)) {}
+		explicit vector(type f1, type f2, type f3, type f4, type f5, type f6, type f7, type f8,
+						type f9, type f10, type f11, type f12, type f13, type f14, type f15, type f16) :
+			vector_base(_mm256_set_epi16(f16, f15, f14, f13, f12, f11, f10, f9, f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm256_loadu_si256(reinterpret_cast<const native_type *>(arr.data()))) {}
+		explicit vector(const type *vals) : vector_base(_mm256_lddqu_si256(reinterpret_cast<const native_type *>(vals))) {}
+		explicit vector(const type *vals, aligned_load) : vector_base(_mm256_load_si256(reinterpret_cast<const native_type *>(vals))) {}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::uint16_t, 16> &operator+=(const vector<std::uint16_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 16> &operator-=(const vector<std::uint16_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 16> &operator*=(const vector<std::uint16_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 16> &operator/=(const vector<std::uint16_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator+(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator-(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2);
+		// Low 16 bits of the products (vpmullw)
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator*(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator/(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2);
+		// Sums and differences clamped to the range of the lanes instead of wrapping around
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> add_sat(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> sub_sat(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+		// High 16 bits of the 32 bit products
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> mulhi(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint16_t, 16> &operator&=(const vector<std::uint16_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 16> &operator|=(const vector<std::uint16_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 16> &operator^=(const vector<std::uint16_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator~(const vector<std::uint16_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator&(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator|(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator^(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator<<(const vector<std::uint16_t, 16> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator>>(const vector<std::uint16_t, 16> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator==(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator!=(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator>(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator>=(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator<(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> operator<=(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> min(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> max(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 16> select(const vector<std::uint16_t, 16> &v, const vector<std::uint16_t, 16> &alt, const mask<std::uint16_t, 16> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::uint16_t, 16> &v);
+	};
+
+	template <>
+	class mask<std::uint16_t, 16> : public vector_base<std::uint16_t, 16> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm256_set1_epi16(-static_cast<short>(b))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr);
+		explicit SIMD_FORCEINLINE mask(const vector<std::uint16_t, 16> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::uint16_t, 16> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 16> operator==(const mask<std::uint16_t, 16> & v1, const mask<std::uint16_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 16> operator!=(const mask<std::uint16_t, 16> & v1, const mask<std::uint16_t, 16> & v2);
+
+		SIMD_FORCEINLINE mask<std::uint16_t, 16> & operator&=(const mask<std::uint16_t, 16> & v);
+		SIMD_FORCEINLINE mask<std::uint16_t, 16> & operator|=(const mask<std::uint16_t, 16> & v);
+		SIMD_FORCEINLINE mask<std::uint16_t, 16> & operator^=(const mask<std::uint16_t, 16> & v);
+
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 16> operator~(const mask<std::uint16_t, 16> & v);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 16> operator&(mask<std::uint16_t, 16> v1, const mask<std::uint16_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 16> operator|(mask<std::uint16_t, 16> v1, const mask<std::uint16_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 16> operator^(mask<std::uint16_t, 16> v1, const mask<std::uint16_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 16> andnot(const mask<std::uint16_t, 16> & v1, const mask<std::uint16_t, 16> & v2);
+
+		// Byte movemask, two bits per lane
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	namespace detail {
+
+		// Zero extended 32 bit halves of the 16 bit lanes of each 128 bit block
+		SIMD_FORCEINLINE __m256i widen_lo_epu16(__m256i v) {
+			return _mm256_unpacklo_epi16(v, _mm256_setzero_si256());
+		}
+
+		SIMD_FORCEINLINE __m256i widen_hi_epu16(__m256i v) {
+			return _mm256_unpackhi_epi16(v, _mm256_setzero_si256());
+		}
+
+		SIMD_FORCEINLINE __m256i cmpgt_epu16(__m256i a, __m256i b) {
+			auto flip = _mm256_set1_epi16(INT16_MIN);
+			return _mm256_cmpgt_epi16(_mm256_xor_si256(a, flip), _mm256_xor_si256(b, flip));
+		}
+
+	} // namespace detail
+
+	void vector<std::uint16_t, 16>::store(type *vals) const {
+		_mm256_storeu_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint16_t, 16>::store(type *vals, aligned_store) const {
+		_mm256_store_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint16_t, 16>::stream(type *vals) const {
+		_mm256_stream_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint16_t, 16>::store_n(type *vals, size_t count) const {
+		// vpmaskmov only exists for 32 and 64 bit lanes
+		assert(count <= width);
+		std::memcpy(vals, m_array.data(), count * sizeof(type));
+	}
+
+	vector<std::uint16_t, 16> &vector<std::uint16_t, 16>::operator+=(const vector<std::uint16_t, 16> &v) {
+		m_vec = _mm256_add_epi16(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 16> &vector<std::uint16_t, 16>::operator-=(const vector<std::uint16_t, 16> &v) {
+		m_vec = _mm256_sub_epi16(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 16> &vector<std::uint16_t, 16>::operator*=(const vector<std::uint16_t, 16> &v) {
+		m_vec = _mm256_mullo_epi16(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 16> &vector<std::uint16_t, 16>::operator/=(const vector<std::uint16_t, 16> &v) {
+		// Quotients of 16 bit integers are at least 2^-16 away from the next integer, far more than float rounding
+		auto lo = _mm256_div_ps(_mm256_cvtepi32_ps(detail::widen_lo_epu16(m_vec)), _mm256_cvtepi32_ps(detail::widen_lo_epu16(v.m_vec)));
+		auto hi = _mm256_div_ps(_mm256_cvtepi32_ps(detail::widen_hi_epu16(m_vec)), _mm256_cvtepi32_ps(detail::widen_hi_epu16(v.m_vec)));
+		m_vec = detail::narrow_epi32(_mm256_cvttps_epi32(lo), _mm256_cvttps_epi32(hi));
+		return *this;
+	}
+
+	vector<std::uint16_t, 16> operator+(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::uint16_t, 16> operator-(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::uint16_t, 16> operator*(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::uint16_t, 16> operator/(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::uint16_t, 16> add_sat(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(_mm256_adds_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 16> sub_sat(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(_mm256_subs_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 16> mulhi(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(_mm256_mulhi_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 16> &vector<std::uint16_t, 16>::operator&=(const vector<std::uint16_t, 16> &v) {
+		m_vec = _mm256_and_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 16> &vector<std::uint16_t, 16>::operator|=(const vector<std::uint16_t, 16> &v) {
+		m_vec = _mm256_or_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 16> &vector<std::uint16_t, 16>::operator^=(const vector<std::uint16_t, 16> &v) {
+		m_vec = _mm256_xor_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 16> operator~(const vector<std::uint16_t, 16> &v) {
+		return vector<std::uint16_t, 16>(_mm256_xor_si256(v.m_vec, _mm256_set1_epi32(-1)));
+	}
+
+	vector<std::uint16_t, 16> operator&(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::uint16_t, 16> operator|(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::uint16_t, 16> operator^(vector<std::uint16_t, 16> v1, const vector<std::uint16_t, 16> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::uint16_t, 16> operator<<(const vector<std::uint16_t, 16> &v, int bits) {
+		return vector<std::uint16_t, 16>(_mm256_sll_epi16(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::uint16_t, 16> operator>>(const vector<std::uint16_t, 16> &v, int bits) {
+		return vector<std::uint16_t, 16>(_mm256_srl_epi16(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::uint16_t, 16> operator==(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(_mm256_cmpeq_epi16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 16> operator!=(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		// Invert because AVX2 doesn't have instruction for it
+		return vector<std::uint16_t, 16>(_mm256_xor_si256(_mm256_cmpeq_epi16(v1.m_vec, v2.m_vec), _mm256_set1_epi32(-1)));
+	}
+
+	vector<std::uint16_t, 16> operator>(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(detail::cmpgt_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 16> operator>=(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		// v1 is the maximum exactly if v1 >= v2
+		return vector<std::uint16_t, 16>(_mm256_cmpeq_epi16(_mm256_max_epu16(v1.m_vec, v2.m_vec), v1.m_vec));
+	}
+
+	vector<std::uint16_t, 16> operator<(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(detail::cmpgt_epu16(v2.m_vec, v1.m_vec));
+	}
+
+	vector<std::uint16_t, 16> operator<=(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(_mm256_cmpeq_epi16(_mm256_min_epu16(v1.m_vec, v2.m_vec), v1.m_vec));
+	}
+
+	vector<std::uint16_t, 16> min(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(_mm256_min_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 16> max(const vector<std::uint16_t, 16> &v1, const vector<std::uint16_t, 16> &v2) {
+		return vector<std::uint16_t, 16>(_mm256_max_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 16> select(const vector<std::uint16_t, 16> &v, const vector<std::uint16_t, 16> &alt, const mask<std::uint16_t, 16> &condition) {
+		// Only the sign bits count, so spread them over both bytes of their lanes
+		return vector<std::uint16_t, 16>(_mm256_blendv_epi8(alt.m_vec, v.m_vec, _mm256_srai_epi16(condition.native(), 15)));
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::uint16_t, 16> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::uint16_t, 16>::mask(const std::array<bool, width>& arr) {
+		std::array<type, width> lanes;
+		for(size_t i = 0; i < width; ++i)
+			lanes[i] = -static_cast<type>(arr[i]);
+		m_vec = _mm256_loadu_si256(reinterpret_cast<const native_type *>(lanes.data()));
+	}
+
+	mask<std::uint16_t, 16> operator==(const mask<std::uint16_t, 16> & v1, const mask<std::uint16_t, 16> & v2) {
+		return mask<std::uint16_t, 16>(_mm256_cmpeq_epi16(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint16_t, 16> operator!=(const mask<std::uint16_t, 16> & v1, const mask<std::uint16_t, 16> & v2) {
+		return mask<std::uint16_t, 16>(_mm256_xor_si256(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint16_t, 16> & mask<std::uint16_t, 16>::operator&=(const mask<std::uint16_t, 16> & v) {
+		m_vec = _mm256_and_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint16_t, 16> & mask<std::uint16_t, 16>::operator|=(const mask<std::uint16_t, 16> & v) {
+		m_vec = _mm256_or_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint16_t, 16> & mask<std::uint16_t, 16>::operator^=(const mask<std::uint16_t, 16> & v) {
+		m_vec = _mm256_xor_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint16_t, 16> operator~(const mask<std::uint16_t, 16> & v) {
+		return mask<std::uint16_t, 16>(_mm256_xor_si256(v.m_vec, _mm256_set1_epi32(-1)));
+	}
+
+	mask<std::uint16_t, 16> operator&(mask<std::uint16_t, 16> v1, const mask<std::uint16_t, 16> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::uint16_t, 16> operator|(mask<std::uint16_t, 16> v1, const mask<std::uint16_t, 16> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::uint16_t, 16> operator^(mask<std::uint16_t, 16> v1, const mask<std::uint16_t, 16> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::uint16_t, 16> andnot(const mask<std::uint16_t, 16> & v1, const mask<std::uint16_t, 16> & v2) {
+		return mask<std::uint16_t, 16>(_mm256_andnot_si256(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint16_t, 16> mask<std::uint16_t, 16>::first_n(size_t count) {
+		const short n = static_cast<short>(count < width ? count : width);
+		return mask<std::uint16_t, 16>(_mm256_cmpgt_epi16(_mm256_set1_epi16(n), _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+	}
+
+	int mask<std::uint16_t, 16>::get_mask() const {
+		return _mm256_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint16_t, 16>::all() const {
+		return _mm256_movemask_epi8(m_vec) == -1;
+	}
+
+	bool mask<std::uint16_t, 16>::any() const {
+		return _mm256_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint16_t, 16>::none() const {
+		return !_mm256_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
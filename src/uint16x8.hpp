@@ -0,0 +1,368 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	template <>
+	class vector<std::uint16_t, 8> : public vector_base<std::uint16_t, 8> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm_set1_epi16(f)) {}
+		explicit vector(type f1, type f2, type f3, type f4, type f5, type f6, type f7, type f8) :
+			vector_base(_mm_set_epi16(f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(arr.data()))) {}
+#if SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_lddqu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#else // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#endif // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals, aligned_load) : vector_base(_mm_load_si128(reinterpret_cast<const native_type *>(vals))) {}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::uint16_t, 8> &operator+=(const vector<std::uint16_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 8> &operator-=(const vector<std::uint16_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 8> &operator*=(const vector<std::uint16_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 8> &operator/=(const vector<std::uint16_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator+(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator-(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2);
+		// Low 16 bits of the products (pmullw)
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator*(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator/(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2);
+		// Sums and differences clamped to the range of the lanes instead of wrapping around
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> add_sat(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> sub_sat(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+		// High 16 bits of the 32 bit products
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> mulhi(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint16_t, 8> &operator&=(const vector<std::uint16_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 8> &operator|=(const vector<std::uint16_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint16_t, 8> &operator^=(const vector<std::uint16_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator~(const vector<std::uint16_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator&(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator|(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator^(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator<<(const vector<std::uint16_t, 8> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator>>(const vector<std::uint16_t, 8> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator==(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator!=(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator>(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator>=(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator<(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> operator<=(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> min(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> max(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint16_t, 8> select(const vector<std::uint16_t, 8> &v, const vector<std::uint16_t, 8> &alt, const mask<std::uint16_t, 8> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::uint16_t, 8> &v);
+	};
+
+	template <>
+	class mask<std::uint16_t, 8> : public vector_base<std::uint16_t, 8> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_set1_epi16(-static_cast<short>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7, bool b8) : vector_base(_mm_set_epi16(
+			-static_cast<short>(b8), -static_cast<short>(b7), -static_cast<short>(b6), -static_cast<short>(b5),
+			-static_cast<short>(b4), -static_cast<short>(b3), -static_cast<short>(b2), -static_cast<short>(b1))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3], arr[4], arr[5], arr[6], arr[7]) {}
+		explicit SIMD_FORCEINLINE mask(const vector<std::uint16_t, 8> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::uint16_t, 8> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 8> operator==(const mask<std::uint16_t, 8> & v1, const mask<std::uint16_t, 8> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 8> operator!=(const mask<std::uint16_t, 8> & v1, const mask<std::uint16_t, 8> & v2);
+
+		SIMD_FORCEINLINE mask<std::uint16_t, 8> & operator&=(const mask<std::uint16_t, 8> & v);
+		SIMD_FORCEINLINE mask<std::uint16_t, 8> & operator|=(const mask<std::uint16_t, 8> & v);
+		SIMD_FORCEINLINE mask<std::uint16_t, 8> & operator^=(const mask<std::uint16_t, 8> & v);
+
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 8> operator~(const mask<std::uint16_t, 8> & v);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 8> operator&(mask<std::uint16_t, 8> v1, const mask<std::uint16_t, 8> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 8> operator|(mask<std::uint16_t, 8> v1, const mask<std::uint16_t, 8> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 8> operator^(mask<std::uint16_t, 8> v1, const mask<std::uint16_t, 8> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint16_t, 8> andnot(const mask<std::uint16_t, 8> & v1, const mask<std::uint16_t, 8> & v2);
+
+		// Byte movemask, two bits per lane
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	namespace detail {
+
+		// Zero extended 32 bit halves of 16 bit lanes
+		SIMD_FORCEINLINE __m128i widen_lo_epu16(__m128i v) {
+			return _mm_unpacklo_epi16(v, _mm_setzero_si128());
+		}
+
+		SIMD_FORCEINLINE __m128i widen_hi_epu16(__m128i v) {
+			return _mm_unpackhi_epi16(v, _mm_setzero_si128());
+		}
+
+		SIMD_FORCEINLINE __m128i cmpgt_epu16(__m128i a, __m128i b) {
+			auto flip = _mm_set1_epi16(INT16_MIN);
+			return _mm_cmpgt_epi16(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+		}
+
+	} // namespace detail
+
+	void vector<std::uint16_t, 8>::store(type *vals) const {
+		_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint16_t, 8>::store(type *vals, aligned_store) const {
+		_mm_store_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint16_t, 8>::stream(type *vals) const {
+		_mm_stream_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint16_t, 8>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		std::memcpy(vals, m_array.data(), count * sizeof(type));
+	}
+
+	vector<std::uint16_t, 8> &vector<std::uint16_t, 8>::operator+=(const vector<std::uint16_t, 8> &v) {
+		m_vec = _mm_add_epi16(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 8> &vector<std::uint16_t, 8>::operator-=(const vector<std::uint16_t, 8> &v) {
+		m_vec = _mm_sub_epi16(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 8> &vector<std::uint16_t, 8>::operator*=(const vector<std::uint16_t, 8> &v) {
+		m_vec = _mm_mullo_epi16(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 8> &vector<std::uint16_t, 8>::operator/=(const vector<std::uint16_t, 8> &v) {
+		// Quotients of 16 bit integers are at least 2^-16 away from the next integer, far more than float rounding
+		auto lo = _mm_div_ps(_mm_cvtepi32_ps(detail::widen_lo_epu16(m_vec)), _mm_cvtepi32_ps(detail::widen_lo_epu16(v.m_vec)));
+		auto hi = _mm_div_ps(_mm_cvtepi32_ps(detail::widen_hi_epu16(m_vec)), _mm_cvtepi32_ps(detail::widen_hi_epu16(v.m_vec)));
+		m_vec = detail::narrow_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
+		return *this;
+	}
+
+	vector<std::uint16_t, 8> operator+(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::uint16_t, 8> operator-(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::uint16_t, 8> operator*(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::uint16_t, 8> operator/(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::uint16_t, 8> add_sat(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		return vector<std::uint16_t, 8>(_mm_adds_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 8> sub_sat(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		return vector<std::uint16_t, 8>(_mm_subs_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 8> mulhi(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		return vector<std::uint16_t, 8>(_mm_mulhi_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 8> &vector<std::uint16_t, 8>::operator&=(const vector<std::uint16_t, 8> &v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 8> &vector<std::uint16_t, 8>::operator|=(const vector<std::uint16_t, 8> &v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 8> &vector<std::uint16_t, 8>::operator^=(const vector<std::uint16_t, 8> &v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint16_t, 8> operator~(const vector<std::uint16_t, 8> &v) {
+		return vector<std::uint16_t, 8>(_mm_xor_si128(v.m_vec, _mm_set1_epi32(-1)));
+	}
+
+	vector<std::uint16_t, 8> operator&(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::uint16_t, 8> operator|(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::uint16_t, 8> operator^(vector<std::uint16_t, 8> v1, const vector<std::uint16_t, 8> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::uint16_t, 8> operator<<(const vector<std::uint16_t, 8> &v, int bits) {
+		return vector<std::uint16_t, 8>(_mm_sll_epi16(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::uint16_t, 8> operator>>(const vector<std::uint16_t, 8> &v, int bits) {
+		return vector<std::uint16_t, 8>(_mm_srl_epi16(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::uint16_t, 8> operator==(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		return vector<std::uint16_t, 8>(_mm_cmpeq_epi16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 8> operator!=(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint16_t, 8>(_mm_xor_si128(_mm_cmpeq_epi16(v1.m_vec, v2.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	vector<std::uint16_t, 8> operator>(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		return vector<std::uint16_t, 8>(detail::cmpgt_epu16(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint16_t, 8> operator>=(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		// Saturating subtraction leaves zero exactly if v1 >= v2
+		return vector<std::uint16_t, 8>(_mm_cmpeq_epi16(_mm_subs_epu16(v2.m_vec, v1.m_vec), _mm_setzero_si128()));
+	}
+
+	vector<std::uint16_t, 8> operator<(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		// Note the switched operands!
+		return vector<std::uint16_t, 8>(detail::cmpgt_epu16(v2.m_vec, v1.m_vec));
+	}
+
+	vector<std::uint16_t, 8> operator<=(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+		return vector<std::uint16_t, 8>(_mm_cmpeq_epi16(_mm_subs_epu16(v1.m_vec, v2.m_vec), _mm_setzero_si128()));
+	}
+
+	vector<std::uint16_t, 8> min(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint16_t, 8>(_mm_min_epu16(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// v1 - max(v1 - v2, 0)
+		return vector<std::uint16_t, 8>(_mm_sub_epi16(v1.m_vec, _mm_subs_epu16(v1.m_vec, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<std::uint16_t, 8> max(const vector<std::uint16_t, 8> &v1, const vector<std::uint16_t, 8> &v2) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint16_t, 8>(_mm_max_epu16(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// v2 + max(v1 - v2, 0)
+		return vector<std::uint16_t, 8>(_mm_add_epi16(v2.m_vec, _mm_subs_epu16(v1.m_vec, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<std::uint16_t, 8> select(const vector<std::uint16_t, 8> &v, const vector<std::uint16_t, 8> &alt, const mask<std::uint16_t, 8> &condition) {
+		// Only the sign bits count, so spread them over both bytes of their lanes
+		const auto sign = _mm_srai_epi16(condition.native(), 15);
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint16_t, 8>(_mm_blendv_epi8(alt.m_vec, v.m_vec, sign));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint16_t, 8>(_mm_or_si128(_mm_and_si128(v.m_vec, sign), _mm_andnot_si128(sign, alt.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::uint16_t, 8> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::uint16_t, 8> operator==(const mask<std::uint16_t, 8> & v1, const mask<std::uint16_t, 8> & v2) {
+		return mask<std::uint16_t, 8>(_mm_cmpeq_epi16(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint16_t, 8> operator!=(const mask<std::uint16_t, 8> & v1, const mask<std::uint16_t, 8> & v2) {
+		return mask<std::uint16_t, 8>(_mm_xor_si128(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint16_t, 8> & mask<std::uint16_t, 8>::operator&=(const mask<std::uint16_t, 8> & v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint16_t, 8> & mask<std::uint16_t, 8>::operator|=(const mask<std::uint16_t, 8> & v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint16_t, 8> & mask<std::uint16_t, 8>::operator^=(const mask<std::uint16_t, 8> & v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint16_t, 8> operator~(const mask<std::uint16_t, 8> & v) {
+		return mask<std::uint16_t, 8>(_mm_xor_si128(v.m_vec, _mm_set1_epi32(-1)));
+	}
+
+	mask<std::uint16_t, 8> operator&(mask<std::uint16_t, 8> v1, const mask<std::uint16_t, 8> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::uint16_t, 8> operator|(mask<std::uint16_t, 8> v1, const mask<std::uint16_t, 8> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::uint16_t, 8> operator^(mask<std::uint16_t, 8> v1, const mask<std::uint16_t, 8> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::uint16_t, 8> andnot(const mask<std::uint16_t, 8> & v1, const mask<std::uint16_t, 8> & v2) {
+		return mask<std::uint16_t, 8>(_mm_andnot_si128(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint16_t, 8> mask<std::uint16_t, 8>::first_n(size_t count) {
+		const short n = static_cast<short>(count < width ? count : width);
+		return mask<std::uint16_t, 8>(_mm_cmpgt_epi16(_mm_set1_epi16(n), _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7)));
+	}
+
+	int mask<std::uint16_t, 8>::get_mask() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint16_t, 8>::all() const {
+		return _mm_movemask_epi8(m_vec) == 0xFFFF;
+	}
+
+	bool mask<std::uint16_t, 8>::any() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint16_t, 8>::none() const {
+		return !_mm_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
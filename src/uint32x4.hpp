@@ -0,0 +1,450 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	namespace detail {
+		// SSE only compares signed lanes, flipping the sign bits maps the unsigned order onto the signed one
+		inline __m128i cmpgt_epu32(__m128i a, __m128i b) {
+			auto flip = _mm_set1_epi32(INT32_MIN);
+			return _mm_cmpgt_epi32(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+		}
+	} // namespace detail
+
+	template <>
+	class vector<std::uint32_t, 4> : public vector_base<std::uint32_t, 4> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm_set1_epi32(f)) {}
+		explicit vector(type f1, type f2, type f3, type f4) : vector_base(_mm_set_epi32(f4, f3, f2, f1)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm_set_epi32(arr[3], arr[2], arr[1], arr[0])) {}
+#if SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_lddqu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#else // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#endif // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals, aligned_load) : vector_base(_mm_load_si128(reinterpret_cast<const native_type *>(vals))) {}
+		explicit SIMD_FORCEINLINE vector(const vector<float, 4> &v);
+		explicit SIMD_FORCEINLINE vector(const vector<double, 2> &v);
+#if SIMD_SUPPORTS(SIMD_AVX)
+		explicit SIMD_FORCEINLINE vector(const vector<double, 4> &v);
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &operator+=(const vector<std::uint32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &operator-=(const vector<std::uint32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &operator*=(const vector<std::uint32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &operator/=(const vector<std::uint32_t, 4> &v);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator+(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator-(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator*(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator/(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+		// High 32 bits of the 64 bit products
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> mulhi(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+		// Full 64 bit products of the even and the odd lanes respectively, see conversion.hpp
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> mul_even(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> mul_odd(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &operator&=(const vector<std::uint32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &operator|=(const vector<std::uint32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &operator^=(const vector<std::uint32_t, 4> &v);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator~(const vector<std::uint32_t, 4> &v);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator&(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator|(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator^(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator<<(const vector<std::uint32_t, 4> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator>>(const vector<std::uint32_t, 4> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator==(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator!=(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator>(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator>=(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator<(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> operator<=(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &hadd(const vector<std::uint32_t, 4> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 4> &hsub(const vector<std::uint32_t, 4> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> hadd(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> hsub(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> min(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> max(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 4> select(const vector<std::uint32_t, 4> &v, const vector<std::uint32_t, 4> &alt, const mask<std::uint32_t, 4> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::uint32_t, 4> &v);
+	};
+
+	template <>
+	class mask<std::uint32_t, 4> : public vector_base<std::uint32_t, 4> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_set1_epi32(-static_cast<int>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4) : vector_base(_mm_set_epi32(
+			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3]) {}
+		explicit SIMD_FORCEINLINE mask(const vector<std::uint32_t, 4> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::uint32_t, 4> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 4> operator==(const mask<std::uint32_t, 4> & v1, const mask<std::uint32_t, 4> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 4> operator!=(const mask<std::uint32_t, 4> & v1, const mask<std::uint32_t, 4> & v2);
+
+		SIMD_FORCEINLINE mask<std::uint32_t, 4> & operator&=(const mask<std::uint32_t, 4> & v);
+		SIMD_FORCEINLINE mask<std::uint32_t, 4> & operator|=(const mask<std::uint32_t, 4> & v);
+		SIMD_FORCEINLINE mask<std::uint32_t, 4> & operator^=(const mask<std::uint32_t, 4> & v);
+
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 4> operator~(const mask<std::uint32_t, 4> & v);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 4> operator&(mask<std::uint32_t, 4> v1, const mask<std::uint32_t, 4> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 4> operator|(mask<std::uint32_t, 4> v1, const mask<std::uint32_t, 4> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 4> operator^(mask<std::uint32_t, 4> v1, const mask<std::uint32_t, 4> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 4> andnot(const mask<std::uint32_t, 4> & v1, const mask<std::uint32_t, 4> & v2);
+
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	void vector<std::uint32_t, 4>::store(type *vals) const {
+		_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint32_t, 4>::store(type *vals, aligned_store) const {
+		_mm_store_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint32_t, 4>::stream(type *vals) const {
+		_mm_stream_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint32_t, 4>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		switch(count) {
+		case 4:
+			_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+			break;
+		case 3:
+			vals[2] = _mm_cvtsi128_si32(_mm_shuffle_epi32(m_vec, 0b00000010));
+			[[fallthrough]];
+		case 2:
+			_mm_storel_epi64(reinterpret_cast<native_type *>(vals), m_vec);
+			break;
+		case 1:
+			vals[0] = _mm_cvtsi128_si32(m_vec);
+			break;
+		}
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::operator+=(const vector<std::uint32_t, 4> &v) {
+		m_vec = _mm_add_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::operator-=(const vector<std::uint32_t, 4> &v) {
+		m_vec = _mm_sub_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::operator*=(const vector<std::uint32_t, 4> &v) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		m_vec = _mm_mullo_epi32(m_vec, v.m_vec);
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// Multiply the even and the odd lanes into 64 bit and keep the low halves
+		auto even = _mm_mul_epu32(m_vec, v.m_vec);
+		auto odd = _mm_mul_epu32(_mm_srli_epi64(m_vec, 32), _mm_srli_epi64(v.m_vec, 32));
+		m_vec = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0b00001000), _mm_shuffle_epi32(odd, 0b00001000));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return *this;
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::operator/=(const vector<std::uint32_t, 4> &v) {
+		// Divide exactly in double as for the signed lanes, the operands are converted with flipped sign bits
+		// and 2^31 added back. Only a divisor of one yields quotients beyond the signed range, those keep the dividend.
+		auto flip = _mm_set1_epi32(INT32_MIN);
+		auto a = _mm_xor_si128(m_vec, flip);
+		auto b = _mm_xor_si128(v.m_vec, flip);
+#if SIMD_SUPPORTS(SIMD_AVX)
+		auto bias = _mm256_set1_pd(2147483648.0);
+		auto quotient = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_add_pd(_mm256_cvtepi32_pd(a), bias), _mm256_add_pd(_mm256_cvtepi32_pd(b), bias)));
+#else // SIMD_SUPPORTS(SIMD_AVX)
+		auto bias = _mm_set1_pd(2147483648.0);
+		auto lo = _mm_div_pd(_mm_add_pd(_mm_cvtepi32_pd(a), bias), _mm_add_pd(_mm_cvtepi32_pd(b), bias));
+		auto hi = _mm_div_pd(_mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(a, 0b00001110)), bias),
+							 _mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(b, 0b00001110)), bias));
+		auto quotient = _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+		auto one = _mm_cmpeq_epi32(v.m_vec, _mm_set1_epi32(1));
+		m_vec = _mm_or_si128(_mm_and_si128(one, m_vec), _mm_andnot_si128(one, quotient));
+		return *this;
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::hadd(const vector<std::uint32_t, 4> &v) {
+#if SIMD_SUPPORTS(SIMD_SSSE3)
+		m_vec = _mm_hadd_epi32(m_vec, v.m_vec);
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
+		// Gather the even and odd lanes of both vectors and combine them
+		auto even = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(m_vec), _mm_castsi128_ps(v.m_vec), 0b10001000));
+		auto odd = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(m_vec), _mm_castsi128_ps(v.m_vec), 0b11011101));
+		m_vec = _mm_add_epi32(even, odd);
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
+		return *this;
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::hsub(const vector<std::uint32_t, 4> &v) {
+#if SIMD_SUPPORTS(SIMD_SSSE3)
+		m_vec = _mm_hsub_epi32(m_vec, v.m_vec);
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
+		auto even = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(m_vec), _mm_castsi128_ps(v.m_vec), 0b10001000));
+		auto odd = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(m_vec), _mm_castsi128_ps(v.m_vec), 0b11011101));
+		m_vec = _mm_sub_epi32(even, odd);
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
+		return *this;
+	}
+
+	std::uint32_t vector<std::uint32_t, 4>::hadd() const {
+#if SIMD_SUPPORTS(SIMD_SSSE3)
+		auto t1 = _mm_hadd_epi32(m_vec, m_vec);
+		return _mm_cvtsi128_si32(_mm_hadd_epi32(t1, t1));
+#else // SIMD_SUPPORTS(SIMD_SSSE3)
+		// Compute A1+A3, A2+A4, ...
+		auto t1 = _mm_add_epi32(m_vec, _mm_shuffle_epi32(m_vec, 0b00001011));
+		// Compute A1+A2 w. shuffle
+		auto t2 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, 0b00000001));
+		return _mm_cvtsi128_si32(t2);
+#endif // SIMD_SUPPORTS(SIMD_SSSE3)
+	}
+
+	std::uint32_t vector<std::uint32_t, 4>::hsub() const {
+		// (A1-A2)-(A3-A4) == A1-A2-A3+A4, so negate A2 and A3 and sum up
+		auto negate = _mm_set_epi32(0, -1, -1, 0);
+		return vector<std::uint32_t, 4>(_mm_sub_epi32(_mm_xor_si128(m_vec, negate), negate)).hadd();
+	}
+
+	vector<std::uint32_t, 4> hadd(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return v1.hadd(v2);
+	}
+
+	vector<std::uint32_t, 4> hsub(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return v1.hsub(v2);
+	}
+
+	vector<std::uint32_t, 4> operator+(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::uint32_t, 4> operator-(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::uint32_t, 4> operator*(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::uint32_t, 4> operator/(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::uint32_t, 4> mulhi(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		auto even = _mm_mul_epu32(v1.m_vec, v2.m_vec);
+		auto odd = _mm_mul_epu32(_mm_srli_epi64(v1.m_vec, 32), _mm_srli_epi64(v2.m_vec, 32));
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint32_t, 4>(_mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0b11001100));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint32_t, 4>(_mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0b00001101), _mm_shuffle_epi32(odd, 0b00001101)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::operator&=(const vector<std::uint32_t, 4> &v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::operator|=(const vector<std::uint32_t, 4> &v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 4> &vector<std::uint32_t, 4>::operator^=(const vector<std::uint32_t, 4> &v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 4> operator~(const vector<std::uint32_t, 4> &v) {
+		return vector<std::uint32_t, 4>(_mm_xor_si128(v.m_vec, _mm_set1_epi32(-1)));
+	}
+
+	vector<std::uint32_t, 4> operator&(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::uint32_t, 4> operator|(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::uint32_t, 4> operator^(vector<std::uint32_t, 4> v1, const vector<std::uint32_t, 4> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::uint32_t, 4> operator<<(const vector<std::uint32_t, 4> &v, int bits) {
+		return vector<std::uint32_t, 4>(_mm_slli_epi32(v.m_vec, bits));
+	}
+
+	vector<std::uint32_t, 4> operator>>(const vector<std::uint32_t, 4> &v, int bits) {
+		return vector<std::uint32_t, 4>(_mm_srl_epi32(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::uint32_t, 4> operator==(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		return vector<std::uint32_t, 4>(_mm_cmpeq_epi32(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint32_t, 4> operator!=(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint32_t, 4>(_mm_xor_si128(_mm_cmpeq_epi32(v1.m_vec, v2.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	vector<std::uint32_t, 4> operator>(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		return vector<std::uint32_t, 4>(detail::cmpgt_epu32(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint32_t, 4> operator>=(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		// Invert because SSE doesn't have instruction for it (also note the switched operands!)
+		return vector<std::uint32_t, 4>(_mm_xor_si128(detail::cmpgt_epu32(v2.m_vec, v1.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	vector<std::uint32_t, 4> operator<(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		// Note the switched operands!
+		return vector<std::uint32_t, 4>(detail::cmpgt_epu32(v2.m_vec, v1.m_vec));
+	}
+
+	vector<std::uint32_t, 4> operator<=(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint32_t, 4>(_mm_xor_si128(detail::cmpgt_epu32(v1.m_vec, v2.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	vector<std::uint32_t, 4> min(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint32_t, 4>(_mm_min_epu32(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		auto gt = detail::cmpgt_epu32(v1.m_vec, v2.m_vec);
+		return vector<std::uint32_t, 4>(_mm_or_si128(_mm_and_si128(gt, v2.m_vec), _mm_andnot_si128(gt, v1.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<std::uint32_t, 4> max(const vector<std::uint32_t, 4> &v1, const vector<std::uint32_t, 4> &v2) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint32_t, 4>(_mm_max_epu32(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		auto gt = detail::cmpgt_epu32(v1.m_vec, v2.m_vec);
+		return vector<std::uint32_t, 4>(_mm_or_si128(_mm_and_si128(gt, v1.m_vec), _mm_andnot_si128(gt, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	vector<std::uint32_t, 4> select(const vector<std::uint32_t, 4> &v, const vector<std::uint32_t, 4> &alt, const mask<std::uint32_t, 4> &condition) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		// The float blend picks whole lanes by their sign bits, unlike the byte-wise integer blend
+		return vector<std::uint32_t, 4>(_mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(alt.m_vec), _mm_castsi128_ps(v.m_vec), _mm_castsi128_ps(condition.native()))));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// Only the sign bits count like for blendv, so spread them over their lanes
+		const auto sign = _mm_srai_epi32(condition.native(), 31);
+		return vector<std::uint32_t, 4>(_mm_or_si128(_mm_and_si128(v.m_vec, sign), _mm_andnot_si128(sign, alt.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::uint32_t, 4> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::uint32_t, 4> operator==(const mask<std::uint32_t, 4> & v1, const mask<std::uint32_t, 4> & v2) {
+		return mask<std::uint32_t, 4>(_mm_cmpeq_epi32(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint32_t, 4> operator!=(const mask<std::uint32_t, 4> & v1, const mask<std::uint32_t, 4> & v2) {
+		// Invert because SSE doesn't have instruction for it
+		return mask<std::uint32_t, 4>(_mm_xor_si128(_mm_cmpeq_epi32(v1.m_vec, v2.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	mask<std::uint32_t, 4> & mask<std::uint32_t, 4>::operator&=(const mask<std::uint32_t, 4> & v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint32_t, 4> & mask<std::uint32_t, 4>::operator|=(const mask<std::uint32_t, 4> & v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint32_t, 4> & mask<std::uint32_t, 4>::operator^=(const mask<std::uint32_t, 4> & v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint32_t, 4> operator~(const mask<std::uint32_t, 4> & v) {
+		return mask<std::uint32_t, 4>(_mm_xor_si128(v.m_vec, _mm_set1_epi32(-1)));
+	}
+
+	mask<std::uint32_t, 4> operator&(mask<std::uint32_t, 4> v1, const mask<std::uint32_t, 4> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::uint32_t, 4> operator|(mask<std::uint32_t, 4> v1, const mask<std::uint32_t, 4> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::uint32_t, 4> operator^(mask<std::uint32_t, 4> v1, const mask<std::uint32_t, 4> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::uint32_t, 4> andnot(const mask<std::uint32_t, 4> & v1, const mask<std::uint32_t, 4> & v2) {
+		return mask<std::uint32_t, 4>(_mm_andnot_si128(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint32_t, 4> mask<std::uint32_t, 4>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<std::uint32_t, 4>(_mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 1, 2, 3)));
+	}
+
+	int mask<std::uint32_t, 4>::get_mask() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint32_t, 4>::all() const {
+		return _mm_movemask_epi8(m_vec) == 0b1111111111111111;
+	}
+
+	bool mask<std::uint32_t, 4>::any() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint32_t, 4>::none() const {
+		return !_mm_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,390 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+// Theoretically there is some support for this in AVX, but all the useful operations like +/- are in AVX2 only
+#if SIMD_SUPPORTS(SIMD_AVX2)
+	namespace detail {
+		inline __m256i cmpgt_epu32(__m256i a, __m256i b) {
+			auto flip = _mm256_set1_epi32(INT32_MIN);
+			return _mm256_cmpgt_epi32(_mm256_xor_si256(a, flip), _mm256_xor_si256(b, flip));
+		}
+	} // namespace detail
+
+	template <>
+	class vector<std::uint32_t, 8> : public vector_base<std::uint32_t, 8> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+	public:
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm256_set1_epi32(f)) {}
+		explicit vector(type f1, type f2, type f3, type f4,
+						type f5, type f6, type f7, type f8) : vector_base(_mm256_set_epi32(f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm256_set_epi32(arr[7], arr[6], arr[5], arr[4],
+																						   arr[3], arr[2], arr[1], arr[0])) {}
+		explicit vector(const type *vals) : vector_base(_mm256_lddqu_si256(reinterpret_cast<const native_type *>(vals))) {}
+		explicit vector(const type *vals, aligned_load) : vector_base(_mm256_load_si256(reinterpret_cast<const native_type *>(vals))) {}
+		explicit SIMD_FORCEINLINE vector(const vector<float, 8> &v);
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &operator+=(const vector<std::uint32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &operator-=(const vector<std::uint32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &operator*=(const vector<std::uint32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &operator/=(const vector<std::uint32_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator+(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator-(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator*(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator/(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+		// High 32 bits of the 64 bit products
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> mulhi(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+		// Full 64 bit products of the even and the odd lanes respectively, see conversion.hpp
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> mul_even(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> mul_odd(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &operator&=(const vector<std::uint32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &operator|=(const vector<std::uint32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &operator^=(const vector<std::uint32_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator~(const vector<std::uint32_t, 8> &v);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator&(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator|(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator^(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator<<(const vector<std::uint32_t, 8> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator>>(const vector<std::uint32_t, 8> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator==(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator!=(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator>(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator>=(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator<(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> operator<=(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &hadd(const vector<std::uint32_t, 8> &v);
+		SIMD_FORCEINLINE vector<std::uint32_t, 8> &hsub(const vector<std::uint32_t, 8> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> hadd(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> hsub(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> min(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> max(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint32_t, 8> select(const vector<std::uint32_t, 8> &v, const vector<std::uint32_t, 8> &alt, const mask<std::uint32_t, 8> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::uint32_t, 8> &v);
+	};
+
+	template <>
+	class mask<std::uint32_t, 8> : public vector_base<std::uint32_t, 8> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm256_set1_epi32(-static_cast<int>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4, bool b5, bool b6, bool b7, bool b8) : vector_base(_mm256_set_epi32(
+			-static_cast<int>(b8), -static_cast<int>(b7), -static_cast<int>(b6), -static_cast<int>(b5),
+			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3], arr[4], arr[5], arr[6], arr[7]) {}
+		explicit SIMD_FORCEINLINE mask(const vector<std::uint32_t, 8> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::uint32_t, 8> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 8> operator==(const mask<std::uint32_t, 8> & v1, const mask<std::uint32_t, 8> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 8> operator!=(const mask<std::uint32_t, 8> & v1, const mask<std::uint32_t, 8> & v2);
+
+		SIMD_FORCEINLINE mask<std::uint32_t, 8> & operator&=(const mask<std::uint32_t, 8> & v);
+		SIMD_FORCEINLINE mask<std::uint32_t, 8> & operator|=(const mask<std::uint32_t, 8> & v);
+		SIMD_FORCEINLINE mask<std::uint32_t, 8> & operator^=(const mask<std::uint32_t, 8> & v);
+
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 8> operator~(const mask<std::uint32_t, 8> & v);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 8> operator&(mask<std::uint32_t, 8> v1, const mask<std::uint32_t, 8> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 8> operator|(mask<std::uint32_t, 8> v1, const mask<std::uint32_t, 8> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 8> operator^(mask<std::uint32_t, 8> v1, const mask<std::uint32_t, 8> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint32_t, 8> andnot(const mask<std::uint32_t, 8> & v1, const mask<std::uint32_t, 8> & v2);
+
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	void vector<std::uint32_t, 8>::store(type *vals) const {
+		_mm256_storeu_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint32_t, 8>::store(type *vals, aligned_store) const {
+		_mm256_store_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint32_t, 8>::stream(type *vals) const {
+		_mm256_stream_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint32_t, 8>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		const auto tail = _mm256_loadu_si256(reinterpret_cast<const native_type *>(detail::tail_mask_table + 8 - count));
+		_mm256_maskstore_epi32(reinterpret_cast<int *>(vals), tail, m_vec);
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::operator+=(const vector<std::uint32_t, 8> &v) {
+		m_vec = _mm256_add_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::operator-=(const vector<std::uint32_t, 8> &v) {
+		m_vec = _mm256_sub_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::operator*=(const vector<std::uint32_t, 8> &v) {
+		m_vec = _mm256_mullo_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::operator/=(const vector<std::uint32_t, 8> &v) {
+		// Same as for four lanes: exact in double with flipped sign bits, quotients beyond the signed range need a divisor of one
+		auto flip = _mm256_set1_epi32(INT32_MIN);
+		auto bias = _mm256_set1_pd(2147483648.0);
+		auto a = _mm256_xor_si256(m_vec, flip);
+		auto b = _mm256_xor_si256(v.m_vec, flip);
+		auto lo = _mm256_div_pd(_mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(a)), bias),
+								_mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(b)), bias));
+		auto hi = _mm256_div_pd(_mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(a, 1)), bias),
+								_mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(b, 1)), bias));
+		auto quotient = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(lo)), _mm256_cvttpd_epi32(hi), 1);
+		m_vec = _mm256_blendv_epi8(quotient, m_vec, _mm256_cmpeq_epi32(v.m_vec, _mm256_set1_epi32(1)));
+		return *this;
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::hadd(const vector<std::uint32_t, 8> &v) {
+		m_vec = _mm256_hadd_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::hsub(const vector<std::uint32_t, 8> &v) {
+		m_vec = _mm256_hsub_epi32(m_vec, v.m_vec);
+		return *this;
+	}
+
+	std::uint32_t vector<std::uint32_t, 8>::hadd() const {
+		// Results in A1+A2, A3+A4, ..., ..., A5+A6, A7+A8
+		auto t1 = _mm256_hadd_epi32(m_vec, m_vec);
+		// Permute to get A5+A6, A7+A8, ....
+		auto t2 = _mm256_permute2x128_si256(t1, t1, 0b000001);
+		// Compute (A1+A2)+(A5+A6), (A3+A4)+(A7+A8), ...
+		auto t3 = _mm256_add_epi32(t1, t2);
+		// Compute entire sum
+		auto t4 = _mm256_hadd_epi32(t3, t3);
+
+		// Grab the sum from the first entry
+		return static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm256_castsi256_si128(t4)));
+	}
+
+	std::uint32_t vector<std::uint32_t, 8>::hsub() const {
+		// Results in A1-A2, A3-A4, ..., ..., A5-A6, A7-A8
+		auto t1 = _mm256_hsub_epi32(m_vec, m_vec);
+		// (A1-A2)-(A3-A4) and (A5-A6)-(A7-A8) in the first entry of each half
+		auto t2 = _mm256_hsub_epi32(t1, t1);
+		return _mm_cvtsi128_si32(_mm_sub_epi32(_mm256_castsi256_si128(t2), _mm256_extracti128_si256(t2, 1)));
+	}
+
+	vector<std::uint32_t, 8> hadd(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return v1.hadd(v2);
+	}
+
+	vector<std::uint32_t, 8> hsub(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return v1.hsub(v2);
+	}
+
+	vector<std::uint32_t, 8> operator+(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::uint32_t, 8> operator-(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::uint32_t, 8> operator*(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::uint32_t, 8> operator/(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::uint32_t, 8> mulhi(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		auto even = _mm256_mul_epu32(v1.m_vec, v2.m_vec);
+		auto odd = _mm256_mul_epu32(_mm256_srli_epi64(v1.m_vec, 32), _mm256_srli_epi64(v2.m_vec, 32));
+		return vector<std::uint32_t, 8>(_mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010));
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::operator&=(const vector<std::uint32_t, 8> &v) {
+		m_vec = _mm256_and_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::operator|=(const vector<std::uint32_t, 8> &v) {
+		m_vec = _mm256_or_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 8> &vector<std::uint32_t, 8>::operator^=(const vector<std::uint32_t, 8> &v) {
+		m_vec = _mm256_xor_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint32_t, 8> operator~(const vector<std::uint32_t, 8> &v) {
+		return vector<std::uint32_t, 8>(_mm256_xor_si256(v.m_vec, _mm256_set1_epi32(-1)));
+	}
+
+	vector<std::uint32_t, 8> operator&(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::uint32_t, 8> operator|(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::uint32_t, 8> operator^(vector<std::uint32_t, 8> v1, const vector<std::uint32_t, 8> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::uint32_t, 8> operator<<(const vector<std::uint32_t, 8> &v, int bits) {
+		return vector<std::uint32_t, 8>(_mm256_slli_epi32(v.m_vec, bits));
+	}
+
+	vector<std::uint32_t, 8> operator>>(const vector<std::uint32_t, 8> &v, int bits) {
+		return vector<std::uint32_t, 8>(_mm256_srl_epi32(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::uint32_t, 8> operator==(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		return vector<std::uint32_t, 8>(_mm256_cmpeq_epi32(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint32_t, 8> operator!=(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint32_t, 8>(_mm256_xor_si256(_mm256_cmpeq_epi32(v1.m_vec, v2.m_vec), _mm256_set1_epi32(-1)));
+	}
+
+	vector<std::uint32_t, 8> operator>(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		return vector<std::uint32_t, 8>(detail::cmpgt_epu32(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint32_t, 8> operator>=(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		// v1 is the maximum exactly if v1 >= v2
+		return vector<std::uint32_t, 8>(_mm256_cmpeq_epi32(_mm256_max_epu32(v1.m_vec, v2.m_vec), v1.m_vec));
+	}
+
+	vector<std::uint32_t, 8> operator<(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		// Note the switched operands!
+		return vector<std::uint32_t, 8>(detail::cmpgt_epu32(v2.m_vec, v1.m_vec));
+	}
+
+	vector<std::uint32_t, 8> operator<=(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		return vector<std::uint32_t, 8>(_mm256_cmpeq_epi32(_mm256_min_epu32(v1.m_vec, v2.m_vec), v1.m_vec));
+	}
+
+	vector<std::uint32_t, 8> min(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		return vector<std::uint32_t, 8>(_mm256_min_epu32(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint32_t, 8> max(const vector<std::uint32_t, 8> &v1, const vector<std::uint32_t, 8> &v2) {
+		return vector<std::uint32_t, 8>(_mm256_max_epu32(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint32_t, 8> select(const vector<std::uint32_t, 8> &v, const vector<std::uint32_t, 8> &alt, const mask<std::uint32_t, 8> &condition) {
+		// The float blend picks whole lanes by their sign bits, unlike the byte-wise integer blend
+		return vector<std::uint32_t, 8>(_mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(alt.m_vec), _mm256_castsi256_ps(v.m_vec), _mm256_castsi256_ps(condition.native()))));
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::uint32_t, 8> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::uint32_t, 8> operator==(const mask<std::uint32_t, 8> & v1, const mask<std::uint32_t, 8> & v2) {
+		return mask<std::uint32_t, 8>(_mm256_cmpeq_epi32(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint32_t, 8> operator!=(const mask<std::uint32_t, 8> & v1, const mask<std::uint32_t, 8> & v2) {
+		// Invert because SSE doesn't have instruction for it
+		return mask<std::uint32_t, 8>(_mm256_xor_si256(_mm256_cmpeq_epi32(v1.m_vec, v2.m_vec), _mm256_set1_epi32(-1)));
+	}
+
+	mask<std::uint32_t, 8> & mask<std::uint32_t, 8>::operator&=(const mask<std::uint32_t, 8> & v) {
+		m_vec = _mm256_and_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint32_t, 8> & mask<std::uint32_t, 8>::operator|=(const mask<std::uint32_t, 8> & v) {
+		m_vec = _mm256_or_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint32_t, 8> & mask<std::uint32_t, 8>::operator^=(const mask<std::uint32_t, 8> & v) {
+		m_vec = _mm256_xor_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint32_t, 8> operator~(const mask<std::uint32_t, 8> & v) {
+		return mask<std::uint32_t, 8>(_mm256_xor_si256(v.m_vec, _mm256_set1_epi32(-1)));
+	}
+
+	mask<std::uint32_t, 8> operator&(mask<std::uint32_t, 8> v1, const mask<std::uint32_t, 8> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::uint32_t, 8> operator|(mask<std::uint32_t, 8> v1, const mask<std::uint32_t, 8> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::uint32_t, 8> operator^(mask<std::uint32_t, 8> v1, const mask<std::uint32_t, 8> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::uint32_t, 8> andnot(const mask<std::uint32_t, 8> & v1, const mask<std::uint32_t, 8> & v2) {
+		return mask<std::uint32_t, 8>(_mm256_andnot_si256(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint32_t, 8> mask<std::uint32_t, 8>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<std::uint32_t, 8>(_mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+	}
+
+	int mask<std::uint32_t, 8>::get_mask() const {
+		return _mm256_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint32_t, 8>::all() const {
+		return _mm256_movemask_epi8(m_vec) == -1;
+	}
+
+	bool mask<std::uint32_t, 8>::any() const {
+		return _mm256_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint32_t, 8>::none() const {
+		return !_mm256_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
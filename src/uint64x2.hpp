@@ -0,0 +1,398 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	namespace detail {
+		// Flipping the sign bits maps the unsigned order onto the signed one
+		inline __m128i cmpgt_epu64(__m128i a, __m128i b) {
+			auto flip = _mm_set1_epi64x(INT64_MIN);
+			return cmpgt_epi64(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+		}
+	} // namespace detail
+
+	template <>
+	class vector<std::uint64_t, 2> : public vector_base<std::uint64_t, 2> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm_set1_epi64x(f)) {}
+		explicit vector(type f1, type f2) : vector_base(_mm_set_epi64x(f2, f1)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm_set_epi64x(arr[1], arr[0])) {}
+#if SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_lddqu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#else // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#endif // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals, aligned_load) : vector_base(_mm_load_si128(reinterpret_cast<const native_type *>(vals))) {}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &operator+=(const vector<std::uint64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &operator-=(const vector<std::uint64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &operator*=(const vector<std::uint64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &operator/=(const vector<std::uint64_t, 2> &v);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator+(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator-(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator*(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator/(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+		// High 64 bits of the 128 bit products
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> mulhi(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &operator&=(const vector<std::uint64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &operator|=(const vector<std::uint64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &operator^=(const vector<std::uint64_t, 2> &v);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator~(const vector<std::uint64_t, 2> &v);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator&(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator|(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator^(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator<<(const vector<std::uint64_t, 2> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator>>(const vector<std::uint64_t, 2> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator==(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator!=(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator>(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator>=(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator<(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> operator<=(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &hadd(const vector<std::uint64_t, 2> &v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 2> &hsub(const vector<std::uint64_t, 2> &v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> hadd(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> hsub(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> min(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> max(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 2> select(const vector<std::uint64_t, 2> &v, const vector<std::uint64_t, 2> &alt, const mask<std::uint64_t, 2> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::uint64_t, 2> &v);
+	};
+
+	template <>
+	class mask<std::uint64_t, 2> : public vector_base<std::uint64_t, 2> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_set1_epi64x(-static_cast<int>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2) : vector_base(_mm_set_epi64x(-static_cast<int>(b2), -static_cast<int>(b1))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1]) {}
+		explicit SIMD_FORCEINLINE mask(const vector<std::uint64_t, 2> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::uint64_t, 2> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 2> operator==(const mask<std::uint64_t, 2> & v1, const mask<std::uint64_t, 2> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 2> operator!=(const mask<std::uint64_t, 2> & v1, const mask<std::uint64_t, 2> & v2);
+
+		SIMD_FORCEINLINE mask<std::uint64_t, 2> & operator&=(const mask<std::uint64_t, 2> & v);
+		SIMD_FORCEINLINE mask<std::uint64_t, 2> & operator|=(const mask<std::uint64_t, 2> & v);
+		SIMD_FORCEINLINE mask<std::uint64_t, 2> & operator^=(const mask<std::uint64_t, 2> & v);
+
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 2> operator~(const mask<std::uint64_t, 2> & v);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 2> operator&(mask<std::uint64_t, 2> v1, const mask<std::uint64_t, 2> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 2> operator|(mask<std::uint64_t, 2> v1, const mask<std::uint64_t, 2> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 2> operator^(mask<std::uint64_t, 2> v1, const mask<std::uint64_t, 2> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 2> andnot(const mask<std::uint64_t, 2> & v1, const mask<std::uint64_t, 2> & v2);
+
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	void vector<std::uint64_t, 2>::store(type *vals) const {
+		_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint64_t, 2>::store(type *vals, aligned_store) const {
+		_mm_store_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint64_t, 2>::stream(type *vals) const {
+		_mm_stream_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint64_t, 2>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		switch(count) {
+		case 2:
+			_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+			break;
+		case 1:
+			_mm_storel_epi64(reinterpret_cast<native_type *>(vals), m_vec);
+			break;
+		}
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::operator+=(const vector<std::uint64_t, 2> &v) {
+		m_vec = _mm_add_epi64(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::operator-=(const vector<std::uint64_t, 2> &v) {
+		m_vec = _mm_sub_epi64(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::operator*=(const vector<std::uint64_t, 2> &v) {
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		m_vec = _mm_mullo_epi64(m_vec, v.m_vec);
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		// Low 64 bits of the product: lo*lo + ((lo*hi + hi*lo) << 32)
+		auto lo = _mm_mul_epu32(m_vec, v.m_vec);
+		auto cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(m_vec, 32), v.m_vec),
+								   _mm_mul_epu32(m_vec, _mm_srli_epi64(v.m_vec, 32)));
+		m_vec = _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		return *this;
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::operator/=(const vector<std::uint64_t, 2> &v) {
+		// There is no 64 bit integer division instruction and doubles cannot represent every operand exactly
+		for(size_t i = 0; i < width; ++i)
+			m_array[i] /= v.m_array[i];
+		return *this;
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::hadd(const vector<std::uint64_t, 2> &v) {
+		m_vec = _mm_add_epi64(_mm_unpacklo_epi64(m_vec, v.m_vec), _mm_unpackhi_epi64(m_vec, v.m_vec));
+		return *this;
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::hsub(const vector<std::uint64_t, 2> &v) {
+		m_vec = _mm_sub_epi64(_mm_unpacklo_epi64(m_vec, v.m_vec), _mm_unpackhi_epi64(m_vec, v.m_vec));
+		return *this;
+	}
+
+	std::uint64_t vector<std::uint64_t, 2>::hadd() const {
+		return _mm_cvtsi128_si64(_mm_add_epi64(m_vec, _mm_unpackhi_epi64(m_vec, m_vec)));
+	}
+
+	std::uint64_t vector<std::uint64_t, 2>::hsub() const {
+		return _mm_cvtsi128_si64(_mm_sub_epi64(m_vec, _mm_unpackhi_epi64(m_vec, m_vec)));
+	}
+
+	vector<std::uint64_t, 2> hadd(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return v1.hadd(v2);
+	}
+
+	vector<std::uint64_t, 2> hsub(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return v1.hsub(v2);
+	}
+
+	vector<std::uint64_t, 2> operator+(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::uint64_t, 2> operator-(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::uint64_t, 2> operator*(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::uint64_t, 2> operator/(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::uint64_t, 2> mulhi(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+		// Sum up the 32 bit partial products, carrying the overflow of the middle ones into the high half
+		auto hi1 = _mm_srli_epi64(v1.m_vec, 32);
+		auto hi2 = _mm_srli_epi64(v2.m_vec, 32);
+		auto lo_lo = _mm_mul_epu32(v1.m_vec, v2.m_vec);
+		auto t = _mm_add_epi64(_mm_mul_epu32(hi1, v2.m_vec), _mm_srli_epi64(lo_lo, 32));
+		auto w = _mm_add_epi64(_mm_mul_epu32(v1.m_vec, hi2), _mm_and_si128(t, _mm_set1_epi64x(0xFFFFFFFF)));
+		return vector<std::uint64_t, 2>(_mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(hi1, hi2), _mm_srli_epi64(t, 32)), _mm_srli_epi64(w, 32)));
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::operator&=(const vector<std::uint64_t, 2> &v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::operator|=(const vector<std::uint64_t, 2> &v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 2> &vector<std::uint64_t, 2>::operator^=(const vector<std::uint64_t, 2> &v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 2> operator~(const vector<std::uint64_t, 2> &v) {
+		return vector<std::uint64_t, 2>(_mm_xor_si128(v.m_vec, _mm_set1_epi64x(-1)));
+	}
+
+	vector<std::uint64_t, 2> operator&(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::uint64_t, 2> operator|(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::uint64_t, 2> operator^(vector<std::uint64_t, 2> v1, const vector<std::uint64_t, 2> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::uint64_t, 2> operator<<(const vector<std::uint64_t, 2> &v, int bits) {
+		return vector<std::uint64_t, 2>(_mm_slli_epi64(v.m_vec, bits));
+	}
+
+	vector<std::uint64_t, 2> operator>>(const vector<std::uint64_t, 2> &v, int bits) {
+		return vector<std::uint64_t, 2>(_mm_srl_epi64(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::uint64_t, 2> operator==(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+		return vector<std::uint64_t, 2>(detail::cmpeq_epi64(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint64_t, 2> operator!=(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint64_t, 2>(_mm_xor_si128(detail::cmpeq_epi64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
+	}
+
+	vector<std::uint64_t, 2> operator>(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+		return vector<std::uint64_t, 2>(detail::cmpgt_epu64(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint64_t, 2> operator>=(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+		// Invert because SSE doesn't have instruction for it (also note the switched operands!)
+		return vector<std::uint64_t, 2>(_mm_xor_si128(detail::cmpgt_epu64(v2.m_vec, v1.m_vec), _mm_set1_epi64x(-1)));
+	}
+
+	vector<std::uint64_t, 2> operator<(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+		// Note the switched operands!
+		return vector<std::uint64_t, 2>(detail::cmpgt_epu64(v2.m_vec, v1.m_vec));
+	}
+
+	vector<std::uint64_t, 2> operator<=(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint64_t, 2>(_mm_xor_si128(detail::cmpgt_epu64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
+	}
+
+	vector<std::uint64_t, 2> min(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::uint64_t, 2>(_mm_min_epu64(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		auto gt = detail::cmpgt_epu64(v1.m_vec, v2.m_vec);
+		return vector<std::uint64_t, 2>(_mm_or_si128(_mm_and_si128(gt, v2.m_vec), _mm_andnot_si128(gt, v1.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+	}
+
+	vector<std::uint64_t, 2> max(const vector<std::uint64_t, 2> &v1, const vector<std::uint64_t, 2> &v2) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::uint64_t, 2>(_mm_max_epu64(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		auto gt = detail::cmpgt_epu64(v1.m_vec, v2.m_vec);
+		return vector<std::uint64_t, 2>(_mm_or_si128(_mm_and_si128(gt, v1.m_vec), _mm_andnot_si128(gt, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+	}
+
+	vector<std::uint64_t, 2> select(const vector<std::uint64_t, 2> &v, const vector<std::uint64_t, 2> &alt, const mask<std::uint64_t, 2> &condition) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		// The float blend picks whole lanes by their sign bits, unlike the byte-wise integer blend
+		return vector<std::uint64_t, 2>(_mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(alt.m_vec), _mm_castsi128_pd(v.m_vec), _mm_castsi128_pd(condition.native()))));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// Only the sign bits count like for blendv, so spread them over their lanes
+		const auto sign = _mm_shuffle_epi32(_mm_srai_epi32(condition.native(), 31), _MM_SHUFFLE(3, 3, 1, 1));
+		return vector<std::uint64_t, 2>(_mm_or_si128(_mm_and_si128(v.m_vec, sign), _mm_andnot_si128(sign, alt.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::uint64_t, 2> &v) {
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::uint64_t, 2> operator==(const mask<std::uint64_t, 2> & v1, const mask<std::uint64_t, 2> & v2) {
+		return mask<std::uint64_t, 2>(detail::cmpeq_epi64(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint64_t, 2> operator!=(const mask<std::uint64_t, 2> & v1, const mask<std::uint64_t, 2> & v2) {
+		// Invert because SSE doesn't have instruction for it
+		return mask<std::uint64_t, 2>(_mm_xor_si128(detail::cmpeq_epi64(v1.m_vec, v2.m_vec), _mm_set1_epi64x(-1)));
+	}
+
+	mask<std::uint64_t, 2> & mask<std::uint64_t, 2>::operator&=(const mask<std::uint64_t, 2> & v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint64_t, 2> & mask<std::uint64_t, 2>::operator|=(const mask<std::uint64_t, 2> & v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint64_t, 2> & mask<std::uint64_t, 2>::operator^=(const mask<std::uint64_t, 2> & v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint64_t, 2> operator~(const mask<std::uint64_t, 2> & v) {
+		return mask<std::uint64_t, 2>(_mm_xor_si128(v.m_vec, _mm_set1_epi64x(-1)));
+	}
+
+	mask<std::uint64_t, 2> operator&(mask<std::uint64_t, 2> v1, const mask<std::uint64_t, 2> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::uint64_t, 2> operator|(mask<std::uint64_t, 2> v1, const mask<std::uint64_t, 2> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::uint64_t, 2> operator^(mask<std::uint64_t, 2> v1, const mask<std::uint64_t, 2> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::uint64_t, 2> andnot(const mask<std::uint64_t, 2> & v1, const mask<std::uint64_t, 2> & v2) {
+		return mask<std::uint64_t, 2>(_mm_andnot_si128(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint64_t, 2> mask<std::uint64_t, 2>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<std::uint64_t, 2>(_mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 0, 1, 1)));
+	}
+
+	int mask<std::uint64_t, 2>::get_mask() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint64_t, 2>::all() const {
+		return _mm_movemask_epi8(m_vec) == 0b1111111111111111;
+	}
+
+	bool mask<std::uint64_t, 2>::any() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint64_t, 2>::none() const {
+		return !_mm_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,386 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+	namespace detail {
+		inline __m256i cmpgt_epu64(__m256i a, __m256i b) {
+			auto flip = _mm256_set1_epi64x(INT64_MIN);
+			return _mm256_cmpgt_epi64(_mm256_xor_si256(a, flip), _mm256_xor_si256(b, flip));
+		}
+	} // namespace detail
+
+	template <>
+	class vector<std::uint64_t, 4> : public vector_base<std::uint64_t, 4> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm256_set1_epi64x(f)) {}
+		explicit vector(type f1, type f2, type f3, type f4) : vector_base(_mm256_set_epi64x(f4, f3, f2, f1)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm256_set_epi64x(arr[3], arr[2], arr[1], arr[0])) {}
+		explicit vector(const type* vals) : vector_base(_mm256_lddqu_si256(reinterpret_cast<const native_type*>(vals))) {}
+		explicit vector(const type* vals, aligned_load) : vector_base(_mm256_load_si256(reinterpret_cast<const native_type*>(vals))) {}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & operator+=(const vector<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & operator-=(const vector<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & operator*=(const vector<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & operator/=(const vector<std::uint64_t, 4> & v);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator+(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator-(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator*(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator/(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+		// High 64 bits of the 128 bit products
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> mulhi(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & operator&=(const vector<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & operator|=(const vector<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & operator^=(const vector<std::uint64_t, 4> & v);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator~(const vector<std::uint64_t, 4> & v);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator&(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator|(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator^(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator<<(const vector<std::uint64_t, 4> & v, int bits);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator>>(const vector<std::uint64_t, 4> & v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator==(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator!=(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator>(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator>=(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator<(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> operator<=(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & hadd(const vector<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE vector<std::uint64_t, 4> & hsub(const vector<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE type hadd() const;
+		SIMD_FORCEINLINE type hsub() const;
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> hadd(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> hsub(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> min(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> max(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint64_t, 4> select(const vector<std::uint64_t, 4> & v, const vector<std::uint64_t, 4> & alt, const mask<std::uint64_t, 4> & condition);
+
+		friend inline std::ostream& operator<<(std::ostream& stream, const vector<std::uint64_t, 4> & v);
+	};
+
+	template <>
+	class mask<std::uint64_t, 4> : public vector_base<std::uint64_t, 4> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm256_set1_epi64x(-static_cast<int>(b))) {}
+		explicit SIMD_FORCEINLINE mask(bool b1, bool b2, bool b3, bool b4) : vector_base(_mm256_set_epi64x(
+			-static_cast<int>(b4), -static_cast<int>(b3), -static_cast<int>(b2), -static_cast<int>(b1))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr) : mask(arr[0], arr[1], arr[2], arr[3]) {}
+		explicit SIMD_FORCEINLINE mask(const vector<std::uint64_t, 4> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::uint64_t, 4> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 4> operator==(const mask<std::uint64_t, 4> & v1, const mask<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 4> operator!=(const mask<std::uint64_t, 4> & v1, const mask<std::uint64_t, 4> & v2);
+
+		SIMD_FORCEINLINE mask<std::uint64_t, 4> & operator&=(const mask<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE mask<std::uint64_t, 4> & operator|=(const mask<std::uint64_t, 4> & v);
+		SIMD_FORCEINLINE mask<std::uint64_t, 4> & operator^=(const mask<std::uint64_t, 4> & v);
+
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 4> operator~(const mask<std::uint64_t, 4> & v);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 4> operator&(mask<std::uint64_t, 4> v1, const mask<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 4> operator|(mask<std::uint64_t, 4> v1, const mask<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 4> operator^(mask<std::uint64_t, 4> v1, const mask<std::uint64_t, 4> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint64_t, 4> andnot(const mask<std::uint64_t, 4> & v1, const mask<std::uint64_t, 4> & v2);
+
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	void vector<std::uint64_t, 4>::store(type *vals) const {
+		_mm256_storeu_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint64_t, 4>::store(type *vals, aligned_store) const {
+		_mm256_store_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint64_t, 4>::stream(type *vals) const {
+		_mm256_stream_si256(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint64_t, 4>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		// Two 32 bit mask entries per 64 bit lane
+		const auto tail = _mm256_loadu_si256(reinterpret_cast<const native_type *>(detail::tail_mask_table + 8 - 2 * count));
+		_mm256_maskstore_epi64(reinterpret_cast<long long *>(vals), tail, m_vec);
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::operator+=(const vector<std::uint64_t, 4> & v) {
+		m_vec = _mm256_add_epi64(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::operator-=(const vector<std::uint64_t, 4> & v) {
+		m_vec = _mm256_sub_epi64(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::operator*=(const vector<std::uint64_t, 4> & v) {
+#if SIMD_SUPPORTS(SIMD_AVX512DQ)
+		m_vec = _mm256_mullo_epi64(m_vec, v.m_vec);
+#else // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		// Low 64 bits of the product: lo*lo + ((lo*hi + hi*lo) << 32)
+		auto lo = _mm256_mul_epu32(m_vec, v.m_vec);
+		auto cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(m_vec, 32), v.m_vec),
+									  _mm256_mul_epu32(m_vec, _mm256_srli_epi64(v.m_vec, 32)));
+		m_vec = _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+#endif // SIMD_SUPPORTS(SIMD_AVX512DQ)
+		return *this;
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::operator/=(const vector<std::uint64_t, 4> & v) {
+		// There is no 64 bit integer division instruction and doubles cannot represent every operand exactly
+		for(size_t i = 0; i < width; ++i)
+			m_array[i] /= v.m_array[i];
+		return *this;
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::hadd(const vector<std::uint64_t, 4> & v) {
+		// Same lane layout as _mm256_hadd_pd: A1+A2, B1+B2, A3+A4, B3+B4
+		m_vec = _mm256_add_epi64(_mm256_unpacklo_epi64(m_vec, v.m_vec), _mm256_unpackhi_epi64(m_vec, v.m_vec));
+		return *this;
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::hsub(const vector<std::uint64_t, 4> & v) {
+		m_vec = _mm256_sub_epi64(_mm256_unpacklo_epi64(m_vec, v.m_vec), _mm256_unpackhi_epi64(m_vec, v.m_vec));
+		return *this;
+	}
+
+	std::uint64_t vector<std::uint64_t, 4>::hadd() const {
+		// Results in A1+A2, ..., A3+A4, ...
+		auto t1 = _mm256_add_epi64(m_vec, _mm256_shuffle_epi32(m_vec, 0b01001110));
+		return _mm_cvtsi128_si64(_mm_add_epi64(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1)));
+	}
+
+	std::uint64_t vector<std::uint64_t, 4>::hsub() const {
+		// Results in A1-A2, ..., A3-A4, ...
+		auto t1 = _mm256_sub_epi64(m_vec, _mm256_shuffle_epi32(m_vec, 0b01001110));
+		return _mm_cvtsi128_si64(_mm_sub_epi64(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1)));
+	}
+
+	vector<std::uint64_t, 4> hadd(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return v1.hadd(v2);
+	}
+
+	vector<std::uint64_t, 4> hsub(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return v1.hsub(v2);
+	}
+
+	vector<std::uint64_t, 4> operator+(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::uint64_t, 4> operator-(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::uint64_t, 4> operator*(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::uint64_t, 4> operator/(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::uint64_t, 4> mulhi(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+		// Sum up the 32 bit partial products, carrying the overflow of the middle ones into the high half
+		auto hi1 = _mm256_srli_epi64(v1.m_vec, 32);
+		auto hi2 = _mm256_srli_epi64(v2.m_vec, 32);
+		auto lo_lo = _mm256_mul_epu32(v1.m_vec, v2.m_vec);
+		auto t = _mm256_add_epi64(_mm256_mul_epu32(hi1, v2.m_vec), _mm256_srli_epi64(lo_lo, 32));
+		auto w = _mm256_add_epi64(_mm256_mul_epu32(v1.m_vec, hi2), _mm256_and_si256(t, _mm256_set1_epi64x(0xFFFFFFFF)));
+		return vector<std::uint64_t, 4>(_mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(hi1, hi2), _mm256_srli_epi64(t, 32)), _mm256_srli_epi64(w, 32)));
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::operator&=(const vector<std::uint64_t, 4> & v) {
+		m_vec = _mm256_and_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::operator|=(const vector<std::uint64_t, 4> & v) {
+		m_vec = _mm256_or_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 4> & vector<std::uint64_t, 4>::operator^=(const vector<std::uint64_t, 4> & v) {
+		m_vec = _mm256_xor_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint64_t, 4> operator~(const vector<std::uint64_t, 4> & v) {
+		return vector<std::uint64_t, 4>(_mm256_xor_si256(v.m_vec, _mm256_set1_epi64x(-1)));
+	}
+
+	vector<std::uint64_t, 4> operator&(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::uint64_t, 4> operator|(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::uint64_t, 4> operator^(vector<std::uint64_t, 4> v1, const vector<std::uint64_t, 4> & v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::uint64_t, 4> operator<<(const vector<std::uint64_t, 4> & v, int bits) {
+		return vector<std::uint64_t, 4>(_mm256_slli_epi64(v.m_vec, bits));
+	}
+
+	vector<std::uint64_t, 4> operator>>(const vector<std::uint64_t, 4> & v, int bits) {
+		return vector<std::uint64_t, 4>(_mm256_srl_epi64(v.m_vec, _mm_cvtsi32_si128(bits)));
+	}
+
+	vector<std::uint64_t, 4> operator==(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+		return vector<std::uint64_t, 4>(_mm256_cmpeq_epi64(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint64_t, 4> operator!=(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint64_t, 4>(_mm256_xor_si256(_mm256_cmpeq_epi64(v1.m_vec, v2.m_vec), _mm256_set1_epi64x(-1)));
+	}
+
+	vector<std::uint64_t, 4> operator>(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+		return vector<std::uint64_t, 4>(detail::cmpgt_epu64(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint64_t, 4> operator>=(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+		// Invert because SSE doesn't have instruction for it (also note the switched operands!)
+		return vector<std::uint64_t, 4>(_mm256_xor_si256(detail::cmpgt_epu64(v2.m_vec, v1.m_vec), _mm256_set1_epi64x(-1)));
+	}
+
+	vector<std::uint64_t, 4> operator<(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+		// Note the switched operands!
+		return vector<std::uint64_t, 4>(detail::cmpgt_epu64(v2.m_vec, v1.m_vec));
+	}
+
+	vector<std::uint64_t, 4> operator<=(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint64_t, 4>(_mm256_xor_si256(detail::cmpgt_epu64(v1.m_vec, v2.m_vec), _mm256_set1_epi64x(-1)));
+	}
+
+	vector<std::uint64_t, 4> min(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::uint64_t, 4>(_mm256_min_epu64(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::uint64_t, 4>(_mm256_blendv_epi8(v1.m_vec, v2.m_vec, detail::cmpgt_epu64(v1.m_vec, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+	}
+
+	vector<std::uint64_t, 4> max(const vector<std::uint64_t, 4> & v1, const vector<std::uint64_t, 4> & v2) {
+#if SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::uint64_t, 4>(_mm256_max_epu64(v1.m_vec, v2.m_vec));
+#else // SIMD_SUPPORTS(SIMD_AVX512BW)
+		return vector<std::uint64_t, 4>(_mm256_blendv_epi8(v2.m_vec, v1.m_vec, detail::cmpgt_epu64(v1.m_vec, v2.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_AVX512BW)
+	}
+
+	vector<std::uint64_t, 4> select(const vector<std::uint64_t, 4> & v, const vector<std::uint64_t, 4> & alt, const mask<std::uint64_t, 4> & condition) {
+		// The float blend picks whole lanes by their sign bits, unlike the byte-wise integer blend
+		return vector<std::uint64_t, 4>(_mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(alt.m_vec), _mm256_castsi256_pd(v.m_vec), _mm256_castsi256_pd(condition.native()))));
+	}
+
+	std::ostream& operator<<(std::ostream& stream, const vector<std::uint64_t, 4> & v) {
+		stream << '(';
+		for(size_t i = 0; i < v.width - 1; ++i) {
+			stream << v.m_array[i] << ' ';
+		}
+		stream << v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::uint64_t, 4> operator==(const mask<std::uint64_t, 4> & v1, const mask<std::uint64_t, 4> & v2) {
+		return mask<std::uint64_t, 4>(_mm256_cmpeq_epi64(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint64_t, 4> operator!=(const mask<std::uint64_t, 4> & v1, const mask<std::uint64_t, 4> & v2) {
+		// Invert because SSE doesn't have instruction for it
+		return mask<std::uint64_t, 4>(_mm256_xor_si256(_mm256_cmpeq_epi64(v1.m_vec, v2.m_vec), _mm256_set1_epi64x(-1)));
+	}
+
+	mask<std::uint64_t, 4> & mask<std::uint64_t, 4>::operator&=(const mask<std::uint64_t, 4> & v) {
+		m_vec = _mm256_and_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint64_t, 4> & mask<std::uint64_t, 4>::operator|=(const mask<std::uint64_t, 4> & v) {
+		m_vec = _mm256_or_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint64_t, 4> & mask<std::uint64_t, 4>::operator^=(const mask<std::uint64_t, 4> & v) {
+		m_vec = _mm256_xor_si256(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint64_t, 4> operator~(const mask<std::uint64_t, 4> & v) {
+		return mask<std::uint64_t, 4>(_mm256_xor_si256(v.m_vec, _mm256_set1_epi64x(-1)));
+	}
+
+	mask<std::uint64_t, 4> operator&(mask<std::uint64_t, 4> v1, const mask<std::uint64_t, 4> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::uint64_t, 4> operator|(mask<std::uint64_t, 4> v1, const mask<std::uint64_t, 4> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::uint64_t, 4> operator^(mask<std::uint64_t, 4> v1, const mask<std::uint64_t, 4> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::uint64_t, 4> andnot(const mask<std::uint64_t, 4> & v1, const mask<std::uint64_t, 4> & v2) {
+		return mask<std::uint64_t, 4>(_mm256_andnot_si256(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint64_t, 4> mask<std::uint64_t, 4>::first_n(size_t count) {
+		const int n = static_cast<int>(count < width ? count : width);
+		return mask<std::uint64_t, 4>(_mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3)));
+	}
+
+	int mask<std::uint64_t, 4>::get_mask() const {
+		return _mm256_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint64_t, 4>::all() const {
+		return _mm256_movemask_epi8(m_vec) == -1;
+	}
+
+	bool mask<std::uint64_t, 4>::any() const {
+		return _mm256_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint64_t, 4>::none() const {
+		return !_mm256_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "base_types.hpp"
+#include "simd.hpp"
+
+namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	// x86 has no byte multiplies, shifts or divisions, those go through 16 bit lanes (int16x8.hpp)
+	template <>
+	class vector<std::uint8_t, 16> : public vector_base<std::uint8_t, 16> {
+	public:
+		static constexpr int required_version = native_vector<type, width>::required_version;
+
+		vector() : vector_base() {}
+		explicit vector(native_type v) : vector_base(v) {}
+		explicit vector(type f) : vector_base(_mm_set1_epi8(f)) {}
+		explicit vector(type f1, type f2, type f3, type f4, type f5, type f6, type f7, type f8,
+						type f9, type f10, type f11, type f12, type f13, type f14, type f15, type f16) :
+			vector_base(_mm_set_epi8(f16, f15, f14, f13, f12, f11, f10, f9, f8, f7, f6, f5, f4, f3, f2, f1)) {}
+		explicit vector(const std::array<type, width>& arr) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(arr.data()))) {}
+#if SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_lddqu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#else // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals) : vector_base(_mm_loadu_si128(reinterpret_cast<const native_type *>(vals))) {}
+#endif // SIMD_SUPPORTS(SIMD_SSE3)
+		explicit vector(const type *vals, aligned_load) : vector_base(_mm_load_si128(reinterpret_cast<const native_type *>(vals))) {}
+
+		SIMD_FORCEINLINE void store(type *vals) const;
+		SIMD_FORCEINLINE void store(type *vals, aligned_store) const;
+		// Non-temporal store bypassing the cache; vals must be aligned
+		SIMD_FORCEINLINE void stream(type *vals) const;
+		// Stores only the first count lanes
+		SIMD_FORCEINLINE void store_n(type *vals, size_t count) const;
+
+		SIMD_FORCEINLINE vector<std::uint8_t, 16> &operator+=(const vector<std::uint8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint8_t, 16> &operator-=(const vector<std::uint8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint8_t, 16> &operator*=(const vector<std::uint8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint8_t, 16> &operator/=(const vector<std::uint8_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator+(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator-(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2);
+		// Low 8 bits of the products
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator*(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator/(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2);
+		// Sums and differences clamped to the range of the lanes instead of wrapping around
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> add_sat(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> sub_sat(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+		// High 8 bits of the 16 bit products
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> mulhi(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+
+		SIMD_FORCEINLINE vector<std::uint8_t, 16> &operator&=(const vector<std::uint8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint8_t, 16> &operator|=(const vector<std::uint8_t, 16> &v);
+		SIMD_FORCEINLINE vector<std::uint8_t, 16> &operator^=(const vector<std::uint8_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator~(const vector<std::uint8_t, 16> &v);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator&(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator|(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator^(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator<<(const vector<std::uint8_t, 16> &v, int bits);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator>>(const vector<std::uint8_t, 16> &v, int bits);
+
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator==(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator!=(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator>(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator>=(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator<(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> operator<=(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> min(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> max(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2);
+
+		friend SIMD_FORCEINLINE vector<std::uint8_t, 16> select(const vector<std::uint8_t, 16> &v, const vector<std::uint8_t, 16> &alt, const mask<std::uint8_t, 16> &condition);
+
+		friend inline std::ostream &operator<<(std::ostream &stream, const vector<std::uint8_t, 16> &v);
+	};
+
+	template <>
+	class mask<std::uint8_t, 16> : public vector_base<std::uint8_t, 16> {
+	public:
+		SIMD_FORCEINLINE mask() : vector_base() {}
+		explicit SIMD_FORCEINLINE mask(native_type v) : vector_base(v) {}
+		explicit SIMD_FORCEINLINE mask(bool b) : vector_base(_mm_set1_epi8(-static_cast<char>(b))) {}
+		explicit SIMD_FORCEINLINE mask(const std::array<bool, width>& arr);
+		explicit SIMD_FORCEINLINE mask(const vector<std::uint8_t, 16> & v) : vector_base(v) {}
+		static SIMD_FORCEINLINE mask<std::uint8_t, 16> first_n(size_t count);
+
+		friend SIMD_FORCEINLINE mask<std::uint8_t, 16> operator==(const mask<std::uint8_t, 16> & v1, const mask<std::uint8_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint8_t, 16> operator!=(const mask<std::uint8_t, 16> & v1, const mask<std::uint8_t, 16> & v2);
+
+		SIMD_FORCEINLINE mask<std::uint8_t, 16> & operator&=(const mask<std::uint8_t, 16> & v);
+		SIMD_FORCEINLINE mask<std::uint8_t, 16> & operator|=(const mask<std::uint8_t, 16> & v);
+		SIMD_FORCEINLINE mask<std::uint8_t, 16> & operator^=(const mask<std::uint8_t, 16> & v);
+
+		friend SIMD_FORCEINLINE mask<std::uint8_t, 16> operator~(const mask<std::uint8_t, 16> & v);
+		friend SIMD_FORCEINLINE mask<std::uint8_t, 16> operator&(mask<std::uint8_t, 16> v1, const mask<std::uint8_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint8_t, 16> operator|(mask<std::uint8_t, 16> v1, const mask<std::uint8_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint8_t, 16> operator^(mask<std::uint8_t, 16> v1, const mask<std::uint8_t, 16> & v2);
+		friend SIMD_FORCEINLINE mask<std::uint8_t, 16> andnot(const mask<std::uint8_t, 16> & v1, const mask<std::uint8_t, 16> & v2);
+
+		// Byte movemask, one bit per lane
+		SIMD_FORCEINLINE int get_mask() const;
+		SIMD_FORCEINLINE bool all() const;
+		SIMD_FORCEINLINE bool any() const;
+		SIMD_FORCEINLINE bool none() const;
+	};
+
+	namespace detail {
+
+		// Zero extended 16 bit halves of 8 bit lanes
+		SIMD_FORCEINLINE __m128i widen_lo_epu8(__m128i v) {
+			return _mm_unpacklo_epi8(v, _mm_setzero_si128());
+		}
+
+		SIMD_FORCEINLINE __m128i widen_hi_epu8(__m128i v) {
+			return _mm_unpackhi_epi8(v, _mm_setzero_si128());
+		}
+
+		SIMD_FORCEINLINE __m128i cmpgt_epu8(__m128i a, __m128i b) {
+			auto flip = _mm_set1_epi8(INT8_MIN);
+			return _mm_cmpgt_epi8(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+		}
+
+	} // namespace detail
+
+	void vector<std::uint8_t, 16>::store(type *vals) const {
+		_mm_storeu_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint8_t, 16>::store(type *vals, aligned_store) const {
+		_mm_store_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint8_t, 16>::stream(type *vals) const {
+		_mm_stream_si128(reinterpret_cast<native_type *>(vals), m_vec);
+	}
+
+	void vector<std::uint8_t, 16>::store_n(type *vals, size_t count) const {
+		assert(count <= width);
+		std::memcpy(vals, m_array.data(), count * sizeof(type));
+	}
+
+	vector<std::uint8_t, 16> &vector<std::uint8_t, 16>::operator+=(const vector<std::uint8_t, 16> &v) {
+		m_vec = _mm_add_epi8(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint8_t, 16> &vector<std::uint8_t, 16>::operator-=(const vector<std::uint8_t, 16> &v) {
+		m_vec = _mm_sub_epi8(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint8_t, 16> &vector<std::uint8_t, 16>::operator*=(const vector<std::uint8_t, 16> &v) {
+		// The low byte of a 16 bit product only depends on the low bytes of the factors
+		auto even = _mm_mullo_epi16(m_vec, v.m_vec);
+		auto odd = _mm_mullo_epi16(_mm_srli_epi16(m_vec, 8), _mm_srli_epi16(v.m_vec, 8));
+		m_vec = _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0x00FF)), _mm_slli_epi16(odd, 8));
+		return *this;
+	}
+
+	vector<std::uint8_t, 16> &vector<std::uint8_t, 16>::operator/=(const vector<std::uint8_t, 16> &v) {
+		auto lo = vector<std::uint16_t, 8>(detail::widen_lo_epu8(m_vec)) / vector<std::uint16_t, 8>(detail::widen_lo_epu8(v.m_vec));
+		auto hi = vector<std::uint16_t, 8>(detail::widen_hi_epu8(m_vec)) / vector<std::uint16_t, 8>(detail::widen_hi_epu8(v.m_vec));
+		m_vec = detail::narrow_epi16(lo.native(), hi.native());
+		return *this;
+	}
+
+	vector<std::uint8_t, 16> operator+(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2) {
+		return (v1 += v2);
+	}
+
+	vector<std::uint8_t, 16> operator-(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2) {
+		return (v1 -= v2);
+	}
+
+	vector<std::uint8_t, 16> operator*(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2) {
+		return (v1 *= v2);
+	}
+
+	vector<std::uint8_t, 16> operator/(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2) {
+		return (v1 /= v2);
+	}
+
+	vector<std::uint8_t, 16> add_sat(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		return vector<std::uint8_t, 16>(_mm_adds_epu8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint8_t, 16> sub_sat(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		return vector<std::uint8_t, 16>(_mm_subs_epu8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint8_t, 16> mulhi(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		// The high bytes of the products fit into 8 bits, so the saturating pack keeps them
+		auto lo = _mm_srli_epi16(_mm_mullo_epi16(detail::widen_lo_epu8(v1.m_vec), detail::widen_lo_epu8(v2.m_vec)), 8);
+		auto hi = _mm_srli_epi16(_mm_mullo_epi16(detail::widen_hi_epu8(v1.m_vec), detail::widen_hi_epu8(v2.m_vec)), 8);
+		return vector<std::uint8_t, 16>(_mm_packus_epi16(lo, hi));
+	}
+
+	vector<std::uint8_t, 16> &vector<std::uint8_t, 16>::operator&=(const vector<std::uint8_t, 16> &v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint8_t, 16> &vector<std::uint8_t, 16>::operator|=(const vector<std::uint8_t, 16> &v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint8_t, 16> &vector<std::uint8_t, 16>::operator^=(const vector<std::uint8_t, 16> &v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	vector<std::uint8_t, 16> operator~(const vector<std::uint8_t, 16> &v) {
+		return vector<std::uint8_t, 16>(_mm_xor_si128(v.m_vec, _mm_set1_epi32(-1)));
+	}
+
+	vector<std::uint8_t, 16> operator&(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2) {
+		return v1 &= v2;
+	}
+
+	vector<std::uint8_t, 16> operator|(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2) {
+		return v1 |= v2;
+	}
+
+	vector<std::uint8_t, 16> operator^(vector<std::uint8_t, 16> v1, const vector<std::uint8_t, 16> &v2) {
+		return v1 ^= v2;
+	}
+
+	vector<std::uint8_t, 16> operator<<(const vector<std::uint8_t, 16> &v, int bits) {
+		// Shift 16 bit lanes and clear the bits moved in from the neighbouring byte
+		const auto count = _mm_cvtsi32_si128(bits);
+		const auto keep = _mm_set1_epi8(static_cast<char>(0xFF << bits));
+		return vector<std::uint8_t, 16>(_mm_and_si128(_mm_sll_epi16(v.m_vec, count), keep));
+	}
+
+	vector<std::uint8_t, 16> operator>>(const vector<std::uint8_t, 16> &v, int bits) {
+		// Shift 16 bit lanes and clear the bits moved in from the neighbouring byte
+		const auto count = _mm_cvtsi32_si128(bits);
+		const auto keep = _mm_set1_epi8(static_cast<char>(0xFF >> bits));
+		return vector<std::uint8_t, 16>(_mm_and_si128(_mm_srl_epi16(v.m_vec, count), keep));
+	}
+
+	vector<std::uint8_t, 16> operator==(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		return vector<std::uint8_t, 16>(_mm_cmpeq_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint8_t, 16> operator!=(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		// Invert because SSE doesn't have instruction for it
+		return vector<std::uint8_t, 16>(_mm_xor_si128(_mm_cmpeq_epi8(v1.m_vec, v2.m_vec), _mm_set1_epi32(-1)));
+	}
+
+	vector<std::uint8_t, 16> operator>(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		return vector<std::uint8_t, 16>(detail::cmpgt_epu8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint8_t, 16> operator>=(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		// v1 is the maximum exactly if v1 >= v2
+		return vector<std::uint8_t, 16>(_mm_cmpeq_epi8(_mm_max_epu8(v1.m_vec, v2.m_vec), v1.m_vec));
+	}
+
+	vector<std::uint8_t, 16> operator<(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		// Note the switched operands!
+		return vector<std::uint8_t, 16>(detail::cmpgt_epu8(v2.m_vec, v1.m_vec));
+	}
+
+	vector<std::uint8_t, 16> operator<=(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		return vector<std::uint8_t, 16>(_mm_cmpeq_epi8(_mm_min_epu8(v1.m_vec, v2.m_vec), v1.m_vec));
+	}
+
+	vector<std::uint8_t, 16> min(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		return vector<std::uint8_t, 16>(_mm_min_epu8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint8_t, 16> max(const vector<std::uint8_t, 16> &v1, const vector<std::uint8_t, 16> &v2) {
+		return vector<std::uint8_t, 16>(_mm_max_epu8(v1.m_vec, v2.m_vec));
+	}
+
+	vector<std::uint8_t, 16> select(const vector<std::uint8_t, 16> &v, const vector<std::uint8_t, 16> &alt, const mask<std::uint8_t, 16> &condition) {
+#if SIMD_SUPPORTS(SIMD_SSE4_1)
+		return vector<std::uint8_t, 16>(_mm_blendv_epi8(alt.m_vec, v.m_vec, condition.native()));
+#else // SIMD_SUPPORTS(SIMD_SSE4_1)
+		// Only the sign bits count like for blendv, so spread them over their lanes
+		const auto sign = _mm_cmplt_epi8(condition.native(), _mm_setzero_si128());
+		return vector<std::uint8_t, 16>(_mm_or_si128(_mm_and_si128(v.m_vec, sign), _mm_andnot_si128(sign, alt.m_vec)));
+#endif // SIMD_SUPPORTS(SIMD_SSE4_1)
+	}
+
+	std::ostream &operator<<(std::ostream &stream, const vector<std::uint8_t, 16> &v) {
+		// Promoted, characters would be printed otherwise
+		stream << '(';
+		for (size_t i = 0; i < v.width - 1; ++i) {
+			stream << +v.m_array[i] << ' ';
+		}
+		stream << +v.m_array[v.width - 1] << ')';
+		return stream;
+	}
+
+	mask<std::uint8_t, 16>::mask(const std::array<bool, width>& arr) {
+		std::array<type, width> lanes;
+		for(size_t i = 0; i < width; ++i)
+			lanes[i] = -static_cast<type>(arr[i]);
+		m_vec = _mm_loadu_si128(reinterpret_cast<const native_type *>(lanes.data()));
+	}
+
+	mask<std::uint8_t, 16> operator==(const mask<std::uint8_t, 16> & v1, const mask<std::uint8_t, 16> & v2) {
+		return mask<std::uint8_t, 16>(_mm_cmpeq_epi8(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint8_t, 16> operator!=(const mask<std::uint8_t, 16> & v1, const mask<std::uint8_t, 16> & v2) {
+		return mask<std::uint8_t, 16>(_mm_xor_si128(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint8_t, 16> & mask<std::uint8_t, 16>::operator&=(const mask<std::uint8_t, 16> & v) {
+		m_vec = _mm_and_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint8_t, 16> & mask<std::uint8_t, 16>::operator|=(const mask<std::uint8_t, 16> & v) {
+		m_vec = _mm_or_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint8_t, 16> & mask<std::uint8_t, 16>::operator^=(const mask<std::uint8_t, 16> & v) {
+		m_vec = _mm_xor_si128(m_vec, v.m_vec);
+		return *this;
+	}
+
+	mask<std::uint8_t, 16> operator~(const mask<std::uint8_t, 16> & v) {
+		return mask<std::uint8_t, 16>(_mm_xor_si128(v.m_vec, _mm_set1_epi32(-1)));
+	}
+
+	mask<std::uint8_t, 16> operator&(mask<std::uint8_t, 16> v1, const mask<std::uint8_t, 16> & v2) {
+		return v1 &= v2;
+	}
+
+	mask<std::uint8_t, 16> operator|(mask<std::uint8_t, 16> v1, const mask<std::uint8_t, 16> & v2) {
+		return v1 |= v2;
+	}
+
+	mask<std::uint8_t, 16> operator^(mask<std::uint8_t, 16> v1, const mask<std::uint8_t, 16> & v2) {
+		return v1 ^= v2;
+	}
+
+	mask<std::uint8_t, 16> andnot(const mask<std::uint8_t, 16> & v1, const mask<std::uint8_t, 16> & v2) {
+		return mask<std::uint8_t, 16>(_mm_andnot_si128(v1.m_vec, v2.m_vec));
+	}
+
+	mask<std::uint8_t, 16> mask<std::uint8_t, 16>::first_n(size_t count) {
+		const char n = static_cast<char>(count < width ? count : width);
+		return mask<std::uint8_t, 16>(_mm_cmpgt_epi8(_mm_set1_epi8(n), _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+	}
+
+	int mask<std::uint8_t, 16>::get_mask() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint8_t, 16>::all() const {
+		return _mm_movemask_epi8(m_vec) == 0xFFFF;
+	}
+
+	bool mask<std::uint8_t, 16>::any() const {
+		return _mm_movemask_epi8(m_vec);
+	}
+
+	bool mask<std::uint8_t, 16>::none() const {
+		return !_mm_movemask_epi8(m_vec);
+	}
+
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace simd
\ No newline at end of file
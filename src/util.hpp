@@ -11,7 +11,7 @@ namespace simd {
 	template < size_t A, class T >
 	bool is_aligned(const T *ptr) {
 		// Perform faster check for power-of-2 alignments
-		if constexpr (A % 2) {
+		if constexpr ((A & (A - 1)) == 0) {
 			return (reinterpret_cast<uintptr_t>(ptr) & (A - 1)) == 0;
 		}
 		else {
@@ -23,7 +23,7 @@ namespace simd {
 	bool is_aligned(const T *ptr) {
 		// Perform faster check for power-of-2 alignments
 		constexpr size_t alignment = alignof(A);
-		if constexpr (alignment % 2) {
+		if constexpr ((alignment & (alignment - 1)) == 0) {
 			return (reinterpret_cast<uintptr_t>(ptr) & (alignment - 1)) == 0;
 		}
 		else {
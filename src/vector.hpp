@@ -3,13 +3,26 @@
 #include <array>
 #include <cassert>
 #include <ostream>
+#include <type_traits>
 #include "base_types.hpp"
 #include "util.hpp"
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 	struct aligned_load {};
 	struct unaligned_load {};
+	struct aligned_store {};
+
+	namespace detail {
+
+		// Loading eight 32 bit values starting at (tail_mask_table + 8 - n) yields a mask with the first n lanes set
+		alignas(64) inline constexpr std::int32_t tail_mask_table[16] = {
+			-1, -1, -1, -1, -1, -1, -1, -1,
+			0, 0, 0, 0, 0, 0, 0, 0
+		};
+
+	} // namespace detail
 
 	template < class T, size_t W >
 	class vector_base {
@@ -62,5 +75,115 @@ namespace simd {
 	template < class T, size_t W >
 	class mask;
 
-
+	// The native specializations have to be declared before anything could instantiate the
+	// composite primary template (composite.hpp) for their width
+#if SIMD_SUPPORTS(SIMD_SSE)
+	template <> class vector<float, 4>;
+	template <> class mask<float, 4>;
+#endif // SIMD_SUPPORTS(SIMD_SSE)
+
+#if SIMD_SUPPORTS(SIMD_SSE2)
+	template <> class vector<double, 2>;
+	template <> class mask<double, 2>;
+	template <> class vector<std::int32_t, 4>;
+	template <> class mask<std::int32_t, 4>;
+	template <> class vector<std::int64_t, 2>;
+	template <> class mask<std::int64_t, 2>;
+	template <> class vector<std::int8_t, 16>;
+	template <> class mask<std::int8_t, 16>;
+	template <> class vector<std::int16_t, 8>;
+	template <> class mask<std::int16_t, 8>;
+	template <> class vector<std::uint32_t, 4>;
+	template <> class mask<std::uint32_t, 4>;
+	template <> class vector<std::uint64_t, 2>;
+	template <> class mask<std::uint64_t, 2>;
+	template <> class vector<std::uint8_t, 16>;
+	template <> class mask<std::uint8_t, 16>;
+	template <> class vector<std::uint16_t, 8>;
+	template <> class mask<std::uint16_t, 8>;
+#endif // SIMD_SUPPORTS(SIMD_SSE2)
+
+#if SIMD_SUPPORTS(SIMD_AVX)
+	template <> class vector<float, 8>;
+	template <> class mask<float, 8>;
+	template <> class vector<double, 4>;
+	template <> class mask<double, 4>;
+#endif // SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_AVX2)
+	template <> class vector<std::int32_t, 8>;
+	template <> class mask<std::int32_t, 8>;
+	template <> class vector<std::int64_t, 4>;
+	template <> class mask<std::int64_t, 4>;
+	template <> class vector<std::int8_t, 32>;
+	template <> class mask<std::int8_t, 32>;
+	template <> class vector<std::int16_t, 16>;
+	template <> class mask<std::int16_t, 16>;
+	template <> class vector<std::uint32_t, 8>;
+	template <> class mask<std::uint32_t, 8>;
+	template <> class vector<std::uint64_t, 4>;
+	template <> class mask<std::uint64_t, 4>;
+	template <> class vector<std::uint8_t, 32>;
+	template <> class mask<std::uint8_t, 32>;
+	template <> class vector<std::uint16_t, 16>;
+	template <> class mask<std::uint16_t, 16>;
+#endif // SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	template <> class vector<float, 16>;
+	template <> class mask<float, 16>;
+	template <> class vector<double, 8>;
+	template <> class mask<double, 8>;
+	template <> class vector<std::int32_t, 16>;
+	template <> class mask<std::int32_t, 16>;
+	template <> class vector<std::int64_t, 8>;
+	template <> class mask<std::int64_t, 8>;
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+	// Whether fmadd() and friends of the vector type V round only once (a real FMA instruction)
+	// instead of multiplying and adding separately
+	template < class V, class = void >
+	struct is_fma_fused : std::false_type {};
+
+	template < class V >
+	struct is_fma_fused<V, std::void_t<decltype(V::fused_multiply_add)>> : std::bool_constant<V::fused_multiply_add> {};
+
+	template < class V >
+	inline constexpr bool is_fma_fused_v = is_fma_fused<V>::value;
+
+	// Widths without a native register of the current instruction set are composed of several
+	// smaller registers, see composite.hpp
+	using float32x4 = vector<float, 4>;
+	using float32x8 = vector<float, 8>;
+	using float32x16 = vector<float, 16>;
+	using float64x2 = vector<double, 2>;
+	using float64x4 = vector<double, 4>;
+	using float64x8 = vector<double, 8>;
+	using int32x4 = vector<std::int32_t, 4>;
+	using int32x8 = vector<std::int32_t, 8>;
+	using int32x16 = vector<std::int32_t, 16>;
+	using int64x2 = vector<std::int64_t, 2>;
+	using int64x4 = vector<std::int64_t, 4>;
+	using int64x8 = vector<std::int64_t, 8>;
+	using int8x16 = vector<std::int8_t, 16>;
+	using int8x32 = vector<std::int8_t, 32>;
+	using int8x64 = vector<std::int8_t, 64>;
+	using int16x8 = vector<std::int16_t, 8>;
+	using int16x16 = vector<std::int16_t, 16>;
+	using int16x32 = vector<std::int16_t, 32>;
+	using uint8x16 = vector<std::uint8_t, 16>;
+	using uint8x32 = vector<std::uint8_t, 32>;
+	using uint8x64 = vector<std::uint8_t, 64>;
+	using uint16x8 = vector<std::uint16_t, 8>;
+	using uint16x16 = vector<std::uint16_t, 16>;
+	using uint16x32 = vector<std::uint16_t, 32>;
+	using uint32x4 = vector<std::uint32_t, 4>;
+	using uint32x8 = vector<std::uint32_t, 8>;
+	using uint32x16 = vector<std::uint32_t, 16>;
+	using uint64x2 = vector<std::uint64_t, 2>;
+	using uint64x4 = vector<std::uint64_t, 4>;
+	using uint64x8 = vector<std::uint64_t, 8>;
+
+
+} // namespace SIMD_ISA_NAMESPACE
 } // namespace simd
\ No newline at end of file
@@ -12,10 +12,28 @@
 #define SIMD_AVX 50
 #define SIMD_FMA3 51
 #define SIMD_AVX2 60
+// The AVX-512 levels are cumulative: SIMD_AVX512BW also implies VL, SIMD_AVX512DQ implies BW and VL
+#define SIMD_AVX512F 70
+#define SIMD_AVX512BW 71
+#define SIMD_AVX512DQ 72
 
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64) || defined(_M_AMD64)
+	#define SIMD_X86
+#endif
+
+// Defining SIMD_FORCE_SCALAR selects the portable scalar implementation even on x86, e.g. for sanitizer
+// builds or as the baseline to measure the SIMD implementations against
 #ifdef _MSC_VER
 #include <intrin.h>
-#if defined(__AVX2__)
+#if defined(SIMD_FORCE_SCALAR) || !defined(SIMD_X86)
+	#define SIMD_SSE_VERSION SIMD_NONE
+#elif defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(__AVX512DQ__)
+	#define SIMD_SSE_VERSION SIMD_AVX512DQ
+#elif defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	#define SIMD_SSE_VERSION SIMD_AVX512BW
+#elif defined(__AVX512F__)
+	#define SIMD_SSE_VERSION SIMD_AVX512F
+#elif defined(__AVX2__)
 	#define SIMD_SSE_VERSION SIMD_AVX2
 #elif defined(__AVX__)
 	#define SIMD_SSE_VERSION SIMD_AVX
@@ -27,9 +45,19 @@
 	#define SIMD_SSE_VERSION SIMD_NONE
 #endif
 #else // _MSVC_VER
+#ifdef SIMD_X86
 #include <x86intrin.h>
 #include <cpuid.h>
-#if defined(__AVX2__)
+#endif // SIMD_X86
+#if defined(SIMD_FORCE_SCALAR) || !defined(SIMD_X86)
+	#define SIMD_SSE_VERSION SIMD_NONE
+#elif defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(__AVX512DQ__)
+	#define SIMD_SSE_VERSION SIMD_AVX512DQ
+#elif defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+	#define SIMD_SSE_VERSION SIMD_AVX512BW
+#elif defined(__AVX512F__)
+	#define SIMD_SSE_VERSION SIMD_AVX512F
+#elif defined(__AVX2__)
 	#define SIMD_SSE_VERSION SIMD_AVX2
 #elif defined(__FMA__)
 	#define SIMD_SSE_VERSION SIMD_FMA3
@@ -52,9 +80,78 @@
 #endif
 #endif // _MSVC_VER
 
-#define SIMD_SUPPORTS(ver) SIMD_SSE_VERSION >= ver
+#define SIMD_SUPPORTS(ver) (SIMD_SSE_VERSION >= (ver))
+
+// FMA3 on 128 and 256 bit vectors is detected apart from the levels, as the levels above SIMD_FMA3 do not
+// require it. Every AVX2 CPU has it, but GCC and Clang enable it separately (-mfma, not implied by -mavx2
+// or -mavx512f) and MSVC has no macro for it, so /arch:AVX2 stands for it there. The 512 bit fmadd is AVX-512F.
+#if SIMD_SUPPORTS(SIMD_AVX) && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+	#define SIMD_FMA 1
+#else
+	#define SIMD_FMA 0
+#endif
+
+// F16C (half precision conversions) is not part of the levels above either. Every AVX2 CPU has it, but GCC and
+// Clang enable it separately (-mf16c) and MSVC has no macro for it, so /arch:AVX2 stands for it there
+#if SIMD_SUPPORTS(SIMD_AVX) && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+	#define SIMD_F16C 1
+#else
+	#define SIMD_F16C 0
+#endif
+
+// Everything that depends on the compile-time instruction set lives in an inline namespace named after it.
+// This way translation units compiled for different instruction sets (see dispatch.hpp) can be linked together
+// without their inline functions colliding. The extensions detected apart from the levels are part of the name
+// where they can differ: AVX2 and AVX-512 builds without FMA3 or F16C get a _nofma or _nof16c suffix, AVX and
+// FMA3 builds with F16C an _f16c one.
+#if SIMD_SSE_VERSION == SIMD_AVX512DQ
+	#define SIMD_ISA_LEVEL_NAMESPACE avx512dq
+#elif SIMD_SSE_VERSION == SIMD_AVX512BW
+	#define SIMD_ISA_LEVEL_NAMESPACE avx512bw
+#elif SIMD_SSE_VERSION == SIMD_AVX512F
+	#define SIMD_ISA_LEVEL_NAMESPACE avx512f
+#elif SIMD_SSE_VERSION == SIMD_AVX2
+	#define SIMD_ISA_LEVEL_NAMESPACE avx2
+#elif SIMD_SSE_VERSION == SIMD_FMA3
+	#define SIMD_ISA_LEVEL_NAMESPACE fma3
+#elif SIMD_SSE_VERSION == SIMD_AVX
+	#define SIMD_ISA_LEVEL_NAMESPACE avx
+#elif SIMD_SSE_VERSION == SIMD_SSE4_2
+	#define SIMD_ISA_LEVEL_NAMESPACE sse4_2
+#elif SIMD_SSE_VERSION == SIMD_SSE4_1
+	#define SIMD_ISA_LEVEL_NAMESPACE sse4_1
+#elif SIMD_SSE_VERSION == SIMD_SSSE3
+	#define SIMD_ISA_LEVEL_NAMESPACE ssse3
+#elif SIMD_SSE_VERSION == SIMD_SSE3
+	#define SIMD_ISA_LEVEL_NAMESPACE sse3
+#elif SIMD_SSE_VERSION == SIMD_SSE2
+	#define SIMD_ISA_LEVEL_NAMESPACE sse2
+#elif SIMD_SSE_VERSION == SIMD_SSE
+	#define SIMD_ISA_LEVEL_NAMESPACE sse
+#else
+	#define SIMD_ISA_LEVEL_NAMESPACE scalar
+#endif
+
+#if SIMD_SUPPORTS(SIMD_AVX2) && !SIMD_FMA
+	#define SIMD_ISA_FMA_SUFFIX _nofma
+#else
+	#define SIMD_ISA_FMA_SUFFIX
+#endif
+
+#if SIMD_SUPPORTS(SIMD_AVX2) && !SIMD_F16C
+	#define SIMD_ISA_F16C_SUFFIX _nof16c
+#elif !SIMD_SUPPORTS(SIMD_AVX2) && SIMD_F16C
+	#define SIMD_ISA_F16C_SUFFIX _f16c
+#else
+	#define SIMD_ISA_F16C_SUFFIX
+#endif
+
+#define SIMD_ISA_CONCAT_(level, fma, f16c) level##fma##f16c
+#define SIMD_ISA_CONCAT(level, fma, f16c) SIMD_ISA_CONCAT_(level, fma, f16c)
+#define SIMD_ISA_NAMESPACE SIMD_ISA_CONCAT(SIMD_ISA_LEVEL_NAMESPACE, SIMD_ISA_FMA_SUFFIX, SIMD_ISA_F16C_SUFFIX)
 
 namespace simd {
+inline namespace SIMD_ISA_NAMESPACE {
 
 	constexpr bool supports(int version) {
 		return SIMD_SUPPORTS(version);
@@ -64,22 +161,61 @@ namespace simd {
 		return SIMD_SSE_VERSION;
 	}
 
-	int sse_runtime_version() {
-	#ifdef _MSC_VER
+	constexpr bool fma_compile_support() {
+		return SIMD_FMA;
+	}
+
+	constexpr bool f16c_compile_support() {
+		return SIMD_F16C;
+	}
+
+} // namespace SIMD_ISA_NAMESPACE
+
+	inline int sse_runtime_version() {
+	#if !defined(SIMD_X86)
+		// Nothing to probe for
+	#elif defined(_MSC_VER)
 		int cpuInfo[4];
 		__cpuid(cpuInfo, 0);
 		int id_count = cpuInfo[0];
+		// AVX state has to be enabled by the OS as well, otherwise using ymm registers faults
+		bool os_avx = false;
+		bool os_avx512 = false;
+		bool fma = false;
+		bool f16c = false;
+		if(id_count >= 1) {
+			__cpuid(cpuInfo, 1);
+			fma = cpuInfo[2] & (1 << 12);
+			f16c = cpuInfo[2] & (1 << 29);
+			if((cpuInfo[2] & (1 << 27)) && (cpuInfo[2] & (1 << 28))) {
+				const auto xcr0 = _xgetbv(0);
+				os_avx = (xcr0 & 0b110) == 0b110;
+				// Opmask and both halves of the upper ZMM state
+				os_avx512 = (xcr0 & 0b11100110) == 0b11100110;
+			}
+		}
 		
-		if(id_count >= 7) {
-			__cpuid(cpuInfo, 7);
+		// F16C is implied by the higher levels
+		if(id_count >= 7 && os_avx && f16c) {
+			__cpuidex(cpuInfo, 7, 0);
+			if(os_avx512 && (cpuInfo[1] & (1 << 16))) {
+				const bool dq = cpuInfo[1] & (1 << 17);
+				const bool bw = cpuInfo[1] & (1 << 30);
+				const bool vl = cpuInfo[1] & (1 << 31);
+				if(bw && vl && dq)
+					return SIMD_AVX512DQ;
+				if(bw && vl)
+					return SIMD_AVX512BW;
+				return SIMD_AVX512F;
+			}
 			if(cpuInfo[1] & (1 << 5))
 				return SIMD_AVX2;
 		}
 		if(id_count >= 1) {
 			__cpuid(cpuInfo, 1);
-			if(cpuInfo[2] & (1 << 12))
+			if(os_avx && fma)
 				return SIMD_FMA3;
-			if(cpuInfo[2] & (1 << 28))
+			if(os_avx)
 				return SIMD_AVX;
 			if(cpuInfo[2] & (1 << 20))
 				return SIMD_SSE4_2;
@@ -97,24 +233,45 @@ namespace simd {
 	#else // _MSC_VER
 		unsigned int eax, ebx, ecx, edx;
 		unsigned int id_count = __get_cpuid_max(0, nullptr);
+		// AVX state has to be enabled by the OS as well, otherwise using ymm registers faults
+		bool os_avx = false;
+		bool os_avx512 = false;
+		bool fma = false;
+		bool f16c = false;
+		if(id_count >= 1) {
+			__cpuid(1, eax, ebx, ecx, edx);
+			fma = ecx & bit_FMA;
+			f16c = ecx & bit_F16C;
+			if((ecx & bit_OSXSAVE) && (ecx & bit_AVX)) {
+				unsigned int xcr0_lo, xcr0_hi;
+				__asm__ ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+				os_avx = (xcr0_lo & 0b110) == 0b110;
+				// Opmask and both halves of the upper ZMM state
+				os_avx512 = (xcr0_lo & 0b11100110) == 0b11100110;
+			}
+		}
 		
-		if(id_count >= 7) {
-			__asm__ ("mov $0, %%ecx\n\t"
-				"cpuid\n\t"
-				: "=b"(ebx)
-				: "0"(7)
-				: "eax", "ecx", "edx");
+		// F16C is implied by the higher levels
+		if(id_count >= 7 && os_avx && f16c) {
+			__cpuid_count(7, 0, eax, ebx, ecx, edx);
+			if(os_avx512 && (ebx & bit_AVX512F)) {
+				const bool dq = ebx & bit_AVX512DQ;
+				const bool bw = ebx & bit_AVX512BW;
+				const bool vl = ebx & bit_AVX512VL;
+				if(bw && vl && dq)
+					return SIMD_AVX512DQ;
+				if(bw && vl)
+					return SIMD_AVX512BW;
+				return SIMD_AVX512F;
+			}
 			if(ebx & bit_AVX2)
 				return SIMD_AVX2;
 		}
 		if(id_count >= 1) {
-			__asm__ ("cpuid\n\t"
-				: "=c"(ecx), "=d"(edx)
-				: "0"(7)
-				: "eax", "ebx");
-			if(ecx & bit_FMA)
+			__cpuid(1, eax, ebx, ecx, edx);
+			if(os_avx && fma)
 				return SIMD_FMA3;
-			if(ecx & bit_AVX)
+			if(os_avx)
 				return SIMD_AVX;
 			if(ecx & bit_SSE4_2)
 				return SIMD_SSE4_2;
@@ -129,10 +286,50 @@ namespace simd {
 			if(edx & bit_SSE)
 				return SIMD_SSE;
 		}
-	#endif // _MSC_VER
+	#endif // SIMD_X86
 		return SIMD_NONE;
 	}
 
+	// Whether the CPU has FMA3, which no level but SIMD_FMA3 implies
+	inline bool fma_runtime_support() {
+	#if !defined(SIMD_X86)
+		return false;
+	#elif defined(_MSC_VER)
+		int cpuInfo[4];
+		__cpuid(cpuInfo, 0);
+		if(cpuInfo[0] < 1)
+			return false;
+		__cpuid(cpuInfo, 1);
+		return (cpuInfo[2] & (1 << 12)) && sse_runtime_version() >= SIMD_AVX;
+	#else // _MSC_VER
+		unsigned int eax, ebx, ecx, edx;
+		if(__get_cpuid_max(0, nullptr) < 1)
+			return false;
+		__cpuid(1, eax, ebx, ecx, edx);
+		return (ecx & bit_FMA) && sse_runtime_version() >= SIMD_AVX;
+	#endif // SIMD_X86
+	}
+
+	// Whether the CPU has F16C, which levels below SIMD_AVX2 do not imply
+	inline bool f16c_runtime_support() {
+	#if !defined(SIMD_X86)
+		return false;
+	#elif defined(_MSC_VER)
+		int cpuInfo[4];
+		__cpuid(cpuInfo, 0);
+		if(cpuInfo[0] < 1)
+			return false;
+		__cpuid(cpuInfo, 1);
+		return (cpuInfo[2] & (1 << 29)) && sse_runtime_version() >= SIMD_AVX;
+	#else // _MSC_VER
+		unsigned int eax, ebx, ecx, edx;
+		if(__get_cpuid_max(0, nullptr) < 1)
+			return false;
+		__cpuid(1, eax, ebx, ecx, edx);
+		return (ecx & bit_F16C) && sse_runtime_version() >= SIMD_AVX;
+	#endif // SIMD_X86
+	}
+
 	constexpr const char *version_name(int version) {
 		switch(version) {
 		case SIMD_SSE: return "SSE";
@@ -144,6 +341,9 @@ namespace simd {
 		case SIMD_AVX: return "AVX";
 		case SIMD_AVX2: return "AVX2";
 		case SIMD_FMA3: return "FMA3";
+		case SIMD_AVX512F: return "AVX512F";
+		case SIMD_AVX512BW: return "AVX512BW";
+		case SIMD_AVX512DQ: return "AVX512DQ";
 		default: return "none";
 		}
 	}
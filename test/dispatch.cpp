@@ -0,0 +1,35 @@
+#include "simd.hpp"
+
+// Compiled once per instruction set level, see simdwrapper_add_dispatch_sources
+namespace dispatch_test {
+namespace SIMD_ISA_NAMESPACE {
+
+int compiled_version() {
+	return simd::sse_compile_version();
+}
+
+float sum(const float *vals, std::size_t count) {
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	using vector_type = simd::float32x16;
+#elif SIMD_SUPPORTS(SIMD_AVX)
+	using vector_type = simd::float32x8;
+#else // SIMD_SUPPORTS(SIMD_AVX512F)
+	using vector_type = simd::float32x4;
+#endif // SIMD_SUPPORTS(SIMD_AVX512F)
+
+	vector_type acc(0.f);
+	std::size_t i = 0u;
+	for(; i + vector_type::width <= count; i += vector_type::width)
+		acc += vector_type(vals + i);
+	float lanes[vector_type::width];
+	acc.store(lanes);
+	float res = 0.f;
+	for(float lane : lanes)
+		res += lane;
+	for(; i < count; ++i)
+		res += vals[i];
+	return res;
+}
+
+} // namespace SIMD_ISA_NAMESPACE
+} // namespace dispatch_test
\ No newline at end of file
@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <vector>
 #include "simd.hpp"
 
 namespace simd {
@@ -13,9 +18,43 @@ namespace simd {
 		else																						\
 			std::cerr << #operation << " : FAILED (" << res << " != " << expct << ")" << std::endl;	\
 	} catch(const std::runtime_error&) {															\
-		std::cout << #operation << " : NOT IMPLEMENTED" << std::endl;								\
+		std::cerr << #operation << " : FAILED (threw std::runtime_error)" << std::endl;				\
 	}
 
+// Largest difference of the lanes in units in the last place of the expected value
+template < class V >
+double max_ulp_error(const V &res, const V &expct) {
+	using T = typename V::type;
+	double worst = 0.;
+	for(std::size_t i = 0u; i < V::width; ++i) {
+		if(res[i] == expct[i] || (std::isnan(res[i]) && std::isnan(expct[i])))
+			continue;
+		const T ulp = std::nextafter(std::abs(expct[i]), std::numeric_limits<T>::infinity()) - std::abs(expct[i]);
+		worst = std::max(worst, static_cast<double>(std::abs(res[i] - expct[i]) / ulp));
+	}
+	return worst;
+}
+
+#define TEST_CHECK_ULP(operation, expected, max_ulp)												\
+	if(const auto res = (operation), expct = (expected); max_ulp_error(res, expct) <= (max_ulp))	\
+		std::cout << #operation << " : PASSED" << std::endl;										\
+	else																							\
+		std::cerr << #operation << " : FAILED (" << res << " != " << expct << ")" << std::endl;
+
+template < class V, class F >
+V apply_lanes(V v, F f) {
+	for(std::size_t i = 0u; i < V::width; ++i)
+		v[i] = f(v[i]);
+	return v;
+}
+
+template < class V, class F >
+V apply_lanes(V v1, const V &v2, F f) {
+	for(std::size_t i = 0u; i < V::width; ++i)
+		v1[i] = f(v1[i], v2[i]);
+	return v1;
+}
+
 template < class V >
 inline V set_all_bits() {
 	V v;
@@ -64,6 +103,33 @@ std::array<T, N> operator/(const std::array<T, N>& l, const std::array<T, N>& r)
 	return res;
 }
 
+template < class V >
+V store_partial(const V &v, std::size_t count) {
+	std::array<typename V::type, V::width> mem{};
+	v.store_n(mem.data(), count);
+	return V{ mem };
+}
+
+template < class V >
+V store_aligned(const V &v) {
+	alignas(sizeof(V)) std::array<typename V::type, V::width> mem;
+	v.store(mem.data(), aligned_store{});
+	return V{ mem };
+}
+
+template < class V >
+V store_streaming(const V &v) {
+	alignas(sizeof(V)) std::array<typename V::type, V::width> mem;
+	v.stream(mem.data());
+	return V{ mem };
+}
+
+template < class T, std::size_t N >
+std::array<T, N> truncate(std::array<T, N> arr, std::size_t count) {
+	for(std::size_t i = count; i < N; ++i) arr[i] = T(0);
+	return arr;
+}
+
 enum class Comparator {
 	EQ, NEQ, LT, LE, GT, GE
 };
@@ -93,31 +159,845 @@ std::array<T, N> cmp(const std::array<T, N>& l, const std::array<T, N>& r, Compa
 	return res;
 }
 
+// Comparisons yield vectors for SSE/AVX types and k-register masks for AVX-512 types
+template < class R, class T, std::size_t N, std::size_t M >
+R expected_cmp(const std::array<double, M>& l, const std::array<double, M>& r, Comparator c) {
+	const auto res = convert<T, N>(cmp(l, r, c));
+	if constexpr(std::is_same_v<R, vector<T, N>>) {
+		return R{ res };
+	} else {
+		std::array<bool, N> bits;
+		for(std::size_t i = 0u; i < N; ++i)
+			bits[i] = res[i] != T(0);
+		return R{ bits };
+	}
+}
+
+// Lanes of a followed by those of b at the given indices
+template < class V >
+V lanes_at(const V &a, const V &b, const std::array<int, V::width> &index) {
+	V res;
+	for(std::size_t i = 0u; i < V::width; ++i)
+		res[i] = index[i] < static_cast<int>(V::width) ? a[index[i]] : b[index[i] - V::width];
+	return res;
+}
+
+template < class V, std::size_t... I >
+void test_shuffle(const V &a, const V &b, std::index_sequence<I...>) {
+	using T = typename V::type;
+	constexpr int n = static_cast<int>(V::width);
+	constexpr int g = n < 4 ? n : 4;
+	TEST_CHECK(reverse(a), lanes_at(a, b, { { (n - 1 - static_cast<int>(I))... } }));
+	TEST_CHECK(shuffle<(static_cast<int>(I) ^ 1)...>(a), lanes_at(a, b, { { (static_cast<int>(I) ^ 1)... } }));
+	TEST_CHECK(shuffle<(static_cast<int>(I) / g * g + g - 1 - static_cast<int>(I) % g)...>(a),
+			   lanes_at(a, b, { { (static_cast<int>(I) / g * g + g - 1 - static_cast<int>(I) % g)... } }));
+	TEST_CHECK(shuffle<((3 * static_cast<int>(I) + 1) % n)...>(a), lanes_at(a, b, { { ((3 * static_cast<int>(I) + 1) % n)... } }));
+	TEST_CHECK(shuffle<((static_cast<int>(I) + n / 2) % n)...>(a), lanes_at(a, b, { { ((static_cast<int>(I) + n / 2) % n)... } }));
+	// Runs of consecutive lanes that do not start at a multiple of their length
+	TEST_CHECK(shuffle<((static_cast<int>(I) + 1 - static_cast<int>(I) / 2) % n)...>(a),
+			   lanes_at(a, b, { { ((static_cast<int>(I) + 1 - static_cast<int>(I) / 2) % n)... } }));
+	TEST_CHECK(shuffle<(static_cast<int>(I) % (n / 2) + 1)...>(a), lanes_at(a, b, { { (static_cast<int>(I) % (n / 2) + 1)... } }));
+	TEST_CHECK(shuffle<(static_cast<int>(I) < n / 2 ? static_cast<int>(I) + 1 : static_cast<int>(I) + n / 2 + 1)...>(a, b),
+			   lanes_at(a, b, { { (static_cast<int>(I) < n / 2 ? static_cast<int>(I) + 1 : static_cast<int>(I) + n / 2 + 1)... } }));
+	TEST_CHECK(broadcast<0>(a), V(a[0]));
+	TEST_CHECK(broadcast<V::width - 1>(a), V(a[V::width - 1]));
+	TEST_CHECK(rotate_lanes<1>(a), lanes_at(a, b, { { ((static_cast<int>(I) + 1) % n)... } }));
+	TEST_CHECK(rotate_lanes<-1>(a), lanes_at(a, b, { { ((static_cast<int>(I) + n - 1) % n)... } }));
+	TEST_CHECK(shuffle<(static_cast<int>(I) % 2 ? n + static_cast<int>(I) / 2 : static_cast<int>(I) / 2)...>(a, b),
+			   lanes_at(a, b, { { (static_cast<int>(I) % 2 ? n + static_cast<int>(I) / 2 : static_cast<int>(I) / 2)... } }));
+	TEST_CHECK(shuffle<(static_cast<int>(I) < n / 2 ? static_cast<int>(I) : static_cast<int>(I) + n / 2)...>(a, b),
+			   lanes_at(a, b, { { (static_cast<int>(I) < n / 2 ? static_cast<int>(I) : static_cast<int>(I) + n / 2)... } }));
+	TEST_CHECK(shuffle<(static_cast<int>(I) % 4 < 2 ? static_cast<int>(I) ^ 1 : n + static_cast<int>(I))...>(a, b),
+			   lanes_at(a, b, { { (static_cast<int>(I) % 4 < 2 ? static_cast<int>(I) ^ 1 : n + static_cast<int>(I))... } }));
+	TEST_CHECK(shuffle<((5 * static_cast<int>(I) + 3) % (2 * n))...>(a, b), lanes_at(a, b, { { ((5 * static_cast<int>(I) + 3) % (2 * n))... } }));
+	TEST_CHECK(blend<(0x5555555555555555ull >> (64 - n))>(a, b), lanes_at(a, b, { { (static_cast<int>(I) % 2 ? static_cast<int>(I) : n + static_cast<int>(I))... } }));
+	TEST_CHECK(insert<V::width - 1>(a, T(42)), lanes_at(a, V(T(42)), { { (static_cast<int>(I) < n - 1 ? static_cast<int>(I) : n + static_cast<int>(I))... } }));
+	TEST_CHECK(V(extract<V::width - 1>(a)), V(a[V::width - 1]));
+}
+
+template < class V >
+void test_gather(const V &a, const V &b) {
+	using T = typename V::type;
+	using index_type = vector<std::int32_t, V::width>;
+	constexpr int n = static_cast<int>(V::width);
+	std::array<T, 2 * V::width> table;
+	std::array<int, V::width> lanes;
+	std::array<std::int32_t, V::width> offsets;
+	std::array<bool, V::width> selected;
+	a.store(table.data());
+	b.store(table.data() + n);
+	for(int i = 0; i < n; ++i) {
+		lanes[i] = offsets[i] = (5 * i + 3) % (2 * n);
+		selected[i] = a[i] < b[i];
+	}
+	const index_type index{ offsets };
+	const mask<T, V::width> condition(a < b);
+	V masked = a, scattered = a;
+	for(int i = 0; i < n; ++i)
+		if(selected[i]) {
+			masked[i] = lanes_at(a, b, lanes)[i];
+			scattered[i] = b[i];
+		}
+	TEST_CHECK(gather(table.data(), index), lanes_at(a, b, lanes));
+	TEST_CHECK(gather(table.data(), index, a, condition), masked);
+
+	std::array<T, 2 * V::width> out{};
+	scatter(out.data(), index, a);
+	TEST_CHECK(gather(out.data(), index), V(a));
+	scatter(out.data(), index, b, condition);
+	TEST_CHECK(gather(out.data(), index), scattered);
+}
+
+// Lazy expressions evaluate to the eager results, fused multiply-adds up to rounding
+template < class V >
+void test_expression(const V &a, const V &b) {
+	using T = typename V::type;
+	using mask_type = mask<T, V::width>;
+	if constexpr(std::is_floating_point_v<T>) {
+		TEST_CHECK(V(lazy(a) * b + a), fmadd(a, b, a));
+		TEST_CHECK(V(a - lazy(a) * b), fnmadd(a, b, a));
+	} else {
+		TEST_CHECK(V(lazy(a) * b + a), a * b + a);
+		TEST_CHECK(V(a - lazy(a) * b), a - a * b);
+	}
+	TEST_CHECK(V(~lazy(a) & b), ~a & b);
+	TEST_CHECK(V((b & ~lazy(a) & lazy(a)) | b), (~a & b & a) | b);
+	const mask_type m = (lazy(a) < b) & (lazy(b) != a) & ~(lazy(a) == b);
+	TEST_CHECK(select(a, b, m), select(a, b, mask_type(a < b) & mask_type(b != a)));
+}
+
+// Row i holds i * W, i * W + 1, ..., so row i of the transpose holds i, W + i, 2 * W + i, ...
+template < class V, std::size_t... I >
+void test_transpose(std::index_sequence<I...>) {
+	using T = typename V::type;
+	using scalar_type = vector<T, 1>;
+	constexpr std::size_t n = V::width;
+	std::array<V, n> rows, original;
+	for(std::size_t i = 0u; i < n; ++i)
+		rows[i] = original[i] = V(std::array<T, n>{ { static_cast<T>(i * n + I)... } });
+	transpose(rows);
+	T wrong = 0;
+	for(std::size_t i = 0u; i < n; ++i)
+		wrong += !mask<T, n>(rows[i] == V(std::array<T, n>{ { static_cast<T>(I * n + i)... } })).all();
+	TEST_CHECK(scalar_type(wrong), scalar_type(T(0)));
+
+	// Transposing the rows one by one restores them
+	std::apply([](auto &... r) { transpose(r...); }, rows);
+	wrong = 0;
+	for(std::size_t i = 0u; i < n; ++i)
+		wrong += !mask<T, n>(rows[i] == original[i]).all();
+	TEST_CHECK(scalar_type(wrong), scalar_type(T(0)));
+}
+
+// Matrices across several tiles with remainders of rows and columns
+template < class T >
+void test_matrix_transpose() {
+	using scalar_type = vector<T, 1>;
+	for(const auto &[rows, cols] : { std::pair<std::size_t, std::size_t>(1u, 1u), { 3u, 5u }, { 8u, 8u }, { 17u, 9u }, { 70u, 130u }, { 67u, 64u } }) {
+		std::vector<T> in(rows * cols), out(rows * cols);
+		for(std::size_t i = 0u; i < in.size(); ++i)
+			in[i] = static_cast<T>(i);
+		transpose(in.data(), rows, cols, out.data());
+		T wrong = 0;
+		for(std::size_t i = 0u; i < rows; ++i)
+			for(std::size_t j = 0u; j < cols; ++j)
+				wrong += out[j * rows + i] != in[i * cols + j];
+		TEST_CHECK(scalar_type(wrong), scalar_type(T(0)));
+	}
+}
+
+template < class T >
+void test_algorithms() {
+	using scalar_type = vector<T, 1>;
+	// Offsets and counts around the vector width go through the masked head and tail
+	std::vector<T> in(256), out(256);
+	for(std::size_t i = 0u; i < in.size(); ++i)
+		in[i] = static_cast<T>(static_cast<int>(i % 17) - 8);
+	for(const std::size_t offset : { 0u, 1u, 3u }) {
+		for(const std::size_t count : { std::size_t(0), std::size_t(1), native_width<T> - 1, native_width<T> + 3, std::size_t(37), std::size_t(250) }) {
+			const T *first = in.data() + offset;
+			T sum = 0, dot = 0, transformed = 0;
+			std::size_t negative = 0;
+			for(std::size_t i = 0u; i < count; ++i) {
+				sum += first[i];
+				dot += first[i] * first[i];
+				negative += first[i] < T(0);
+			}
+			std::fill(out.begin(), out.end(), T(1));
+			transform(first, count, out.data() + offset, [](const auto &v) { return v + v; });
+			for(std::size_t i = 0u; i < out.size(); ++i)
+				transformed += out[i] - (i >= offset && i < offset + count ? first[i - offset] + first[i - offset] : T(1));
+			TEST_CHECK(scalar_type(transformed), scalar_type(T(0)));
+			TEST_CHECK(scalar_type(reduce(first, count, T(5), [](const auto &a, const auto &b) { return a + b; })), scalar_type(T(sum + 5)));
+			TEST_CHECK(scalar_type(transform_reduce(first, first, count, T(0), [](const auto &a, const auto &b) { return a + b; },
+													[](const auto &a, const auto &b) { return a * b; })),
+					   scalar_type(dot));
+			TEST_CHECK(scalar_type(T(count_if(first, count, [](const auto &v) { return v < std::decay_t<decltype(v)>(T(0)); }))), scalar_type(T(negative)));
+		}
+	}
+}
+
+// Half precision loads and stores against the scalar conversions and a few known bit patterns
+template < std::size_t N >
+void test_float16() {
+	using vector_type = vector<float, N>;
+	using bits_type = vector<std::uint16_t, N>;
+	// 1, the largest finite value, the smallest subnormal, -2, infinity, a tie, 65520 rounding to infinity and 0.1
+	constexpr float known[8] = { 1.f, 65504.f, 5.9604645e-8f, -2.f, std::numeric_limits<float>::infinity(), 1.00048828125f, 65520.f, 0.1f };
+	constexpr std::uint16_t known_bits[8] = { 0x3C00, 0x7BFF, 0x0001, 0xC000, 0x7C00, 0x3C00, 0x7C00, 0x2E66 };
+	constexpr std::uint16_t loaded_bits[8] = { 0x3C00, 0x7BFF, 0x0001, 0xC000, 0x7C00, 0x8000, 0x03FF, 0x3555 };
+	constexpr float loaded[8] = { 1.f, 65504.f, 5.9604645e-8f, -2.f, std::numeric_limits<float>::infinity(), -0.f, 6.0975552e-5f, 0.333251953125f };
+	std::array<float, N> vals, widened;
+	std::array<std::uint16_t, N> nearest;
+	std::array<float16, N> halves;
+	for(std::size_t i = 0u; i < N; ++i) {
+		vals[i] = i < 8 ? known[i] : static_cast<float>(i % 2 ? -1 : 1) * std::ldexp(1234.567f * static_cast<float>(i), 6 - static_cast<int>(i));
+		nearest[i] = i < 8 ? known_bits[i] : detail::half_from_float(vals[i], rounding::nearest);
+		halves[i].bits = i < 8 ? loaded_bits[i] : nearest[i];
+		widened[i] = i < 8 ? loaded[i] : detail::half_to_float(halves[i].bits);
+	}
+	const vector_type v{ vals };
+	TEST_CHECK(load_float16<N>(halves.data()), vector_type{ widened });
+	const auto check_rounding = [&](auto mode) {
+		constexpr rounding R = decltype(mode)::value;
+		std::array<float16, N> stored;
+		std::array<std::uint16_t, N> stored_bits, expected;
+		store_float16<R>(stored.data(), v);
+		for(std::size_t i = 0u; i < N; ++i) {
+			stored_bits[i] = stored[i].bits;
+			expected[i] = R == rounding::nearest ? nearest[i] : detail::half_from_float(vals[i], R);
+		}
+		TEST_CHECK(bits_type{ stored_bits }, bits_type{ expected });
+	};
+	check_rounding(std::integral_constant<rounding, rounding::nearest>());
+	check_rounding(std::integral_constant<rounding, rounding::down>());
+	check_rounding(std::integral_constant<rounding, rounding::up>());
+	check_rounding(std::integral_constant<rounding, rounding::toward_zero>());
+
+	// Signalling NaNs are quieted like by vcvtph2ps, quiet ones keep their payload
+	std::array<float16, N> nans;
+	std::array<float, N> nan_vals;
+	std::array<std::uint32_t, N> nan_bits, quiet_bits;
+	for(std::size_t i = 0u; i < N; ++i) {
+		nans[i].bits = i % 2 ? 0xFD00 : 0x7C01;
+		quiet_bits[i] = i % 2 ? 0xFFE00000 : 0x7FC02000;
+	}
+	load_float16<N>(nans.data()).store(nan_vals.data());
+	std::memcpy(nan_bits.data(), nan_vals.data(), sizeof(nan_bits));
+	TEST_CHECK((vector<std::uint32_t, N>{ nan_bits }), (vector<std::uint32_t, N>{ quiet_bits }));
+
+	// Whole arrays with a tail, every float16 value that is not a NaN converts back to itself
+	std::vector<float16> all(2 * N + 3), round_trip(all.size());
+	std::vector<float> wide(all.size());
+	std::size_t mismatches = 0;
+	for(std::uint32_t h = 0; h < 0x10000; h += static_cast<std::uint32_t>(all.size())) {
+		for(std::size_t i = 0u; i < all.size(); ++i)
+			all[i].bits = static_cast<std::uint16_t>(std::min<std::uint32_t>(h + static_cast<std::uint32_t>(i), 0x7C00));
+		float16_to_float(all.data(), wide.data(), all.size());
+		float_to_float16(wide.data(), round_trip.data(), all.size());
+		for(std::size_t i = 0u; i < all.size(); ++i)
+			mismatches += round_trip[i].bits != all[i].bits || wide[i] != detail::half_to_float(all[i].bits);
+	}
+	TEST_CHECK((vector<std::int32_t, 1>(static_cast<std::int32_t>(mismatches))), (vector<std::int32_t, 1>(0)));
+}
+
+template < std::size_t N >
+void test_bfloat16() {
+	using vector_type = vector<float, N>;
+	using bits_type = vector<std::uint16_t, N>;
+	// 1, a tie rounding down to even, a tie rounding up to even, a value above a tie, -3.5, the largest float, a NaN and 0.1
+	const float known[8] = { 1.f, 1.00390625f, 1.01171875f, 1.0039064f, -3.5f, std::numeric_limits<float>::max(), std::numeric_limits<float>::quiet_NaN(), 0.1f };
+	constexpr std::uint16_t known_bits[8] = { 0x3F80, 0x3F80, 0x3F82, 0x3F81, 0xC060, 0x7F80, 0x7FC0, 0x3DCD };
+	std::array<float, N> vals, widened;
+	std::array<std::uint16_t, N> expected, stored_bits;
+	std::array<bfloat16, N> halves, stored;
+	for(std::size_t i = 0u; i < N; ++i) {
+		vals[i] = i < 8 ? known[i] : static_cast<float>(i % 2 ? -1 : 1) * std::ldexp(1234.567f * static_cast<float>(i), 6 - static_cast<int>(i));
+		expected[i] = i < 8 ? known_bits[i] : detail::bf16_from_float(vals[i]);
+		halves[i].bits = expected[i] == 0x7FC0 ? 0x3F80 : expected[i];
+		widened[i] = detail::bf16_to_float(halves[i].bits);
+	}
+	TEST_CHECK(load_bfloat16<N>(halves.data()), vector_type{ widened });
+	store_bfloat16<N>(stored.data(), vector_type{ vals });
+	for(std::size_t i = 0u; i < N; ++i)
+		stored_bits[i] = stored[i].bits;
+	TEST_CHECK(bits_type{ stored_bits }, bits_type{ expected });
+
+	// Whole arrays with a tail, small integers keep every sum of the dot product exact
+	std::vector<float> wide(2 * N + 3), back(wide.size());
+	std::vector<bfloat16> a(wide.size()), b(wide.size());
+	float dot = 0.f;
+	for(std::size_t i = 0u; i < wide.size(); ++i) {
+		wide[i] = static_cast<float>(static_cast<int>(i % 7) - 3);
+		b[i].bits = detail::bf16_from_float(static_cast<float>(i % 5));
+		dot += wide[i] * static_cast<float>(i % 5);
+	}
+	float_to_bfloat16(wide.data(), a.data(), wide.size());
+	bfloat16_to_float(a.data(), back.data(), back.size());
+	TEST_CHECK(vector_type(back.data() + N + 3), vector_type(wide.data() + N + 3));
+	TEST_CHECK((vector<float, 1>(dot_bfloat16(a.data(), b.data(), a.size()))), (vector<float, 1>(dot)));
+}
+
+template < class T, std::size_t >
+using field = T;
+
+// Records of K fields as std::array<T, K>, through the in-register transposes and the scalar remainder
+template < class T, std::size_t... J >
+void test_soa(std::index_sequence<J...>) {
+	using scalar_type = vector<T, 1>;
+	constexpr std::size_t K = sizeof...(J);
+	std::vector<std::array<T, K>> aos(37), back(37);
+	for(std::size_t i = 0u; i < aos.size(); ++i)
+		for(std::size_t j = 0u; j < K; ++j)
+			aos[i][j] = static_cast<T>(i * K + j);
+	soa<field<T, J>...> columns;
+	columns.assign_aos(aos.data(), aos.size());
+	T wrong = 0;
+	for(std::size_t i = 0u; i < aos.size(); ++i)
+		wrong += ((columns.template get<J>(i) != aos[i][J]) + ...);
+	TEST_CHECK(scalar_type(wrong), scalar_type(T(0)));
+
+	columns.template for_each<native_width<T>>([](auto &... f) { ((f += f), ...); });
+	columns.store_aos(back.data());
+	wrong = 0;
+	for(std::size_t i = 0u; i < aos.size(); ++i)
+		wrong += ((back[i][J] != aos[i][J] + aos[i][J]) + ...);
+	TEST_CHECK(scalar_type(wrong), scalar_type(T(0)));
+}
+
+template < class F >
+void for_each_field_count(F f) {
+	f(std::make_index_sequence<2>());
+	f(std::make_index_sequence<3>());
+	f(std::make_index_sequence<4>());
+	f(std::make_index_sequence<8>());
+}
+
+// Shifts by a count per lane, including counts beyond the lane width, and bit rotates
+template < class T, std::size_t N >
+void test_shift(const std::array<T, N> &l) {
+	using vector_type = vector<T, N>;
+	using U = std::make_unsigned_t<T>;
+	constexpr int digits = 8 * sizeof(T);
+	std::array<T, N> counts, left, right, rot_left, rot_right, left5, right5, rot5;
+	for(std::size_t i = 0u; i < N; ++i) {
+		const int n = static_cast<int>((i * 7 + 3) % (digits + 4)), r = n % digits;
+		const U x = static_cast<U>(l[i]);
+		counts[i] = static_cast<T>(n);
+		left[i] = n < digits ? static_cast<T>(static_cast<U>(x << n)) : T(0);
+		right[i] = std::is_signed_v<T> ? static_cast<T>(l[i] >> std::min(n, digits - 1)) : n < digits ? static_cast<T>(x >> n) : T(0);
+		rot_left[i] = static_cast<T>(static_cast<U>(x << r) | static_cast<U>(x >> (digits - r) % digits));
+		rot_right[i] = static_cast<T>(static_cast<U>(x >> r) | static_cast<U>(x << (digits - r) % digits));
+		left5[i] = static_cast<T>(static_cast<U>(x << 5));
+		right5[i] = static_cast<T>(l[i] >> 5);
+		rot5[i] = static_cast<T>(static_cast<U>(x << 5) | static_cast<U>(x >> (digits - 5)));
+	}
+	const vector_type a{ l }, c{ counts };
+	TEST_CHECK(a << c, vector_type{ left });
+	TEST_CHECK(a >> c, vector_type{ right });
+	TEST_CHECK(rotl(a, c), vector_type{ rot_left });
+	TEST_CHECK(rotr(a, c), vector_type{ rot_right });
+	TEST_CHECK(rotl(a, 5), vector_type{ rot5 });
+	TEST_CHECK(rotr(a, digits - 5), vector_type{ rot5 });
+	TEST_CHECK(rotl(a, digits), a);
+	TEST_CHECK(rotl<5>(a), vector_type{ rot5 });
+	TEST_CHECK(shift_left<5>(a), vector_type{ left5 });
+	TEST_CHECK(shift_right<5>(a), vector_type{ right5 });
+}
+
+// Wrapping sums and the extremes of the 8 and 16 bit and the unsigned lanes
+template < class T, std::size_t N >
+void test_integer_reduce(const std::array<T, N> &l) {
+	using vector_type = vector<T, N>;
+	T sum = 0;
+	for(const T x : l)
+		sum = static_cast<T>(sum + x);
+	const auto min_at = std::min_element(l.begin(), l.end()) - l.begin(), max_at = std::max_element(l.begin(), l.end()) - l.begin();
+	const vector_type a{ l };
+	TEST_CHECK(vector_type(reduce_add(a)), vector_type(sum));
+	TEST_CHECK(vector_type(reduce_min(a)), vector_type(l[min_at]));
+	TEST_CHECK(vector_type(reduce_max(a)), vector_type(l[max_at]));
+	TEST_CHECK(vector_type(T(reduce_min_index(a))), vector_type(T(min_at)));
+	TEST_CHECK(vector_type(T(reduce_max_index(a))), vector_type(T(max_at)));
+}
+
+// 8 and 16 bit lanes: wrapping and saturating arithmetic against the scalar definitions
+template < class T, std::size_t N >
+void test_small_int() {
+	using vector_type = vector<T, N>;
+	constexpr int lowest = std::numeric_limits<T>::min(), highest = std::numeric_limits<T>::max();
+	constexpr int scale = sizeof(T) == 1 ? 1 : 257;
+	const auto wrap = [](int v) { return static_cast<T>(v); };
+	const auto clamp = [&](int v) { return static_cast<T>(std::min(std::max(v, lowest), highest)); };
+	std::array<T, N> l, r, sum, diff, prod, quot, hi, sat_sum, sat_diff, lo_lane, hi_lane, absolute, left, right, less;
+	for(std::size_t i = 0u; i < N; ++i) {
+		const int a = i == 0 ? lowest : i == 1 ? highest : wrap((static_cast<int>(i) * 73 + 5) * scale);
+		const int b = i == 2 ? lowest : wrap((static_cast<int>(i) * 29 - 100) * scale) | 1;
+		l[i] = wrap(a);
+		r[i] = wrap(b);
+		sum[i] = wrap(a + b);
+		diff[i] = wrap(a - b);
+		prod[i] = wrap(a * b);
+		quot[i] = wrap(a / b);
+		hi[i] = wrap((a * b) >> (8 * sizeof(T)));
+		sat_sum[i] = clamp(a + b);
+		sat_diff[i] = clamp(a - b);
+		lo_lane[i] = wrap(std::min(a, b));
+		hi_lane[i] = wrap(std::max(a, b));
+		absolute[i] = wrap(a < 0 ? -a : a);
+		left[i] = wrap(a * 8);
+		right[i] = wrap(a >> 3);
+		less[i] = a < b ? l[i] : r[i];
+	}
+	const vector_type a{ l }, b{ r };
+	TEST_CHECK(a + b, vector_type{ sum });
+	TEST_CHECK(a - b, vector_type{ diff });
+	TEST_CHECK(a * b, vector_type{ prod });
+	TEST_CHECK(a / b, vector_type{ quot });
+	TEST_CHECK(mulhi(a, b), vector_type{ hi });
+	TEST_CHECK(add_sat(a, b), vector_type{ sat_sum });
+	TEST_CHECK(sub_sat(a, b), vector_type{ sat_diff });
+	TEST_CHECK(min(a, b), vector_type{ lo_lane });
+	TEST_CHECK(max(a, b), vector_type{ hi_lane });
+	TEST_CHECK(abs(a), vector_type{ absolute });
+	TEST_CHECK(a << 3, vector_type{ left });
+	TEST_CHECK(a >> 3, vector_type{ right });
+	TEST_CHECK(select(a, b, mask_type(a < b)), vector_type{ less });
+	TEST_CHECK(select(a, b, mask_type(b > a)), vector_type{ less });
+	TEST_CHECK(select(b, a, mask_type(a >= b)), vector_type{ less });
+	TEST_CHECK(select(b, a, mask_type(b <= a)), vector_type{ less });
+	TEST_CHECK(select(a, b, mask_type::first_n(N - 1)), (vector_type{ truncate(l, N - 1) + r - truncate(r, N - 1) }));
+	TEST_CHECK(vector_type(T(mask_type(a == a).all() + mask_type(a >= a).all() + mask_type(a != a).none())), vector_type(T(3)));
+	TEST_CHECK(store_partial(a, N - 1), (vector_type{ truncate(l, N - 1) }));
+	test_shift(l);
+	test_shuffle(a, b, std::make_index_sequence<N>());
+	test_integer_reduce(l);
+}
+
+// Unsigned lanes, with operands on both sides of the sign bit of the signed instructions
+template < class T, std::size_t N >
+void test_unsigned() {
+	using vector_type = vector<T, N>;
+	constexpr std::uint64_t highest = std::numeric_limits<T>::max();
+	std::array<T, N> l, r, sum, diff, prod, quot, hi, sat_sum, sat_diff, lo_lane, hi_lane, left, right, less;
+	for(std::size_t i = 0u; i < N; ++i) {
+		const std::uint64_t a = i == 0 ? 0 : i == 1 ? highest : static_cast<T>(i * 0x9E3779B97F4A7C15ull + 5);
+		const std::uint64_t b = i == 2 ? highest : i == 3 ? 1 : static_cast<T>((i + 3) * 0xC2B2AE3D27D4EB4Full) | 1;
+		l[i] = static_cast<T>(a);
+		r[i] = static_cast<T>(b);
+		sum[i] = static_cast<T>(a + b);
+		diff[i] = static_cast<T>(a - b);
+		prod[i] = static_cast<T>(a * b);
+		quot[i] = static_cast<T>(a / b);
+		if constexpr(sizeof(T) < 8)
+			hi[i] = static_cast<T>((a * b) >> (8 * sizeof(T)));
+		sat_sum[i] = static_cast<T>(std::min(a + b, highest));
+		sat_diff[i] = static_cast<T>(a > b ? a - b : 0);
+		lo_lane[i] = static_cast<T>(std::min(a, b));
+		hi_lane[i] = static_cast<T>(std::max(a, b));
+		left[i] = static_cast<T>(a << 3);
+		right[i] = static_cast<T>(a >> 3);
+		less[i] = a < b ? l[i] : r[i];
+	}
+	const vector_type a{ l }, b{ r };
+	TEST_CHECK(a + b, vector_type{ sum });
+	TEST_CHECK(a - b, vector_type{ diff });
+	TEST_CHECK(a * b, vector_type{ prod });
+	TEST_CHECK(a / b, vector_type{ quot });
+	if constexpr(sizeof(T) < 8)
+		TEST_CHECK(mulhi(a, b), vector_type{ hi });
+	if constexpr(sizeof(T) <= 2) {
+		TEST_CHECK(add_sat(a, b), vector_type{ sat_sum });
+		TEST_CHECK(sub_sat(a, b), vector_type{ sat_diff });
+	}
+	TEST_CHECK(min(a, b), vector_type{ lo_lane });
+	TEST_CHECK(max(a, b), vector_type{ hi_lane });
+	TEST_CHECK(a << 3, vector_type{ left });
+	TEST_CHECK(a >> 3, vector_type{ right });
+	TEST_CHECK(select(a, b, mask_type(a < b)), vector_type{ less });
+	TEST_CHECK(select(a, b, mask_type(b > a)), vector_type{ less });
+	TEST_CHECK(select(b, a, mask_type(a >= b)), vector_type{ less });
+	TEST_CHECK(select(b, a, mask_type(b <= a)), vector_type{ less });
+	TEST_CHECK(vector_type(T(mask_type(a == a).all() + mask_type(a >= a).all() + mask_type(a != a).none())), vector_type(T(3)));
+	{
+		// Only the sign bits count, so lanes with just the top or just the lower bits set pick whole lanes
+		std::array<T, N> signs, picked;
+		for(std::size_t i = 0u; i < N; ++i) {
+			signs[i] = i % 2 ? T(highest >> 1) : T(highest / 2 + 1);
+			picked[i] = i % 2 ? r[i] : l[i];
+		}
+		TEST_CHECK(select(a, b, mask_type(vector_type{ signs })), vector_type{ picked });
+	}
+	test_shift(l);
+	test_shuffle(a, b, std::make_index_sequence<N>());
+	test_integer_reduce(l);
+
+	if constexpr(sizeof(T) >= 4) {
+		for(const T d : { T(1), T(3), T(7), T(16), T(641), T(1000000007), T(highest / 3), T(highest / 2 + 1), T(highest / 2 + 3), T(highest) }) {
+			for(std::size_t i = 0u; i < N; ++i)
+				quot[i] = l[i] / d;
+			TEST_CHECK(a / divider<T>(d), vector_type{ quot });
+		}
+	}
+
+	if constexpr(sizeof(T) == 4) {
+		// Values with at most 24 significant bits convert exactly in both directions
+		std::array<T, N> exact;
+		std::array<float, N> as_float;
+		std::array<double, N> as_double;
+		std::array<std::uint64_t, N / 2> even, odd;
+		for(std::size_t i = 0u; i < N; ++i) {
+			exact[i] = l[i] >> 8 << 8;
+			as_float[i] = static_cast<float>(l[i]);
+			as_double[i] = static_cast<double>(l[i]);
+			(i % 2 ? odd : even)[i / 2] = static_cast<std::uint64_t>(l[i]) * r[i];
+		}
+		// Native float registers only convert from the native unsigned widths
+		if constexpr(std::is_constructible_v<vector<float, N>, vector_type>) {
+			TEST_CHECK((vector<float, N>(a)), (vector<float, N>{ as_float }));
+			TEST_CHECK((vector_type(vector<float, N>(vector_type{ exact }))), vector_type{ exact });
+		}
+		if constexpr(std::is_constructible_v<vector<double, N>, vector_type>)
+			TEST_CHECK((vector<double, N>(a)), (vector<double, N>{ as_double }));
+		TEST_CHECK((mul_even(a, b)), (vector<std::uint64_t, N / 2>{ even }));
+		TEST_CHECK((mul_odd(a, b)), (vector<std::uint64_t, N / 2>{ odd }));
+	}
+}
+
+// The conversions of conversion.hpp, also between different widths, with integral values so that the
+// rounding of the native float to integer conversions does not matter
+void test_conversions() {
+#if SIMD_SUPPORTS(SIMD_SSE2) || !SIMD_SUPPORTS(SIMD_SSE)
+	const vector<int, 4> i4(1, -2, 3, -4);
+	const vector<double, 2> d2(5., -6.);
+	const vector<float, 4> f4(7.f, -8.f, 9.f, -10.f);
+	const vector<std::uint32_t, 4> u4(11u, 3000000000u, 13u, 14u);
+	TEST_CHECK((vector<float, 4>(i4)), (vector<float, 4>(1.f, -2.f, 3.f, -4.f)));
+	TEST_CHECK((vector<int, 4>(f4)), (vector<int, 4>(7, -8, 9, -10)));
+	TEST_CHECK((vector<double, 2>(i4)), (vector<double, 2>(1., -2.)));
+	TEST_CHECK((vector<double, 2>(f4)), (vector<double, 2>(7., -8.)));
+	TEST_CHECK((vector<double, 2>(u4)), (vector<double, 2>(11., 3000000000.)));
+	TEST_CHECK((vector<int, 4>(d2)), (vector<int, 4>(5, -6, 0, 0)));
+	TEST_CHECK((vector<float, 4>(d2)), (vector<float, 4>(5.f, -6.f, 0.f, 0.f)));
+	TEST_CHECK((vector<std::uint32_t, 4>(vector<double, 2>(3000000000., 15.))), (vector<std::uint32_t, 4>(3000000000u, 15u, 0u, 0u)));
+#endif // SIMD_SUPPORTS(SIMD_SSE2) || !SIMD_SUPPORTS(SIMD_SSE)
+
+#if SIMD_SUPPORTS(SIMD_AVX) || !SIMD_SUPPORTS(SIMD_SSE)
+	const vector<double, 4> d4(1., -2., 3., -4.);
+	TEST_CHECK((vector<float, 4>(d4)), (vector<float, 4>(1.f, -2.f, 3.f, -4.f)));
+	TEST_CHECK((vector<int, 4>(d4)), (vector<int, 4>(1, -2, 3, -4)));
+	TEST_CHECK((vector<double, 4>(vector<int, 4>(5, -6, 7, -8))), (vector<double, 4>(5., -6., 7., -8.)));
+	TEST_CHECK((vector<double, 4>(vector<float, 4>(5.f, -6.f, 7.f, -8.f))), (vector<double, 4>(5., -6., 7., -8.)));
+#endif // SIMD_SUPPORTS(SIMD_AVX) || !SIMD_SUPPORTS(SIMD_SSE)
+}
+
 template < class T, std::size_t N >
 void test() {
-	constexpr std::array<double, 8u> d1{ { 1., 5.25, -6.925, 7., 7., -10., 0., 3.2125 } };
-	constexpr std::array<double, 8u> d2{ { -2.5, -3.25, 2.875, -2.225, -2.275, -2.25, 4.15, -1.475 } };
+	constexpr std::array<double, 16u> d1{ { 1., 5.25, -6.925, 7., 7., -10., 0., 3.2125,
+											2.5, -1.75, 9., -4.5, 6.125, -0.5, 8., -3. } };
+	constexpr std::array<double, 16u> d2{ { -2.5, -3.25, 2.875, -2.225, -2.275, -2.25, 4.15, -1.475,
+											1.25, 4.5, -3., -4.5, 2., -7.25, 1.5, 6. } };
 	//constexpr std::array<double, 8u> d3{ { -3.8, -3.4, -6.6, 5.2, 1., 0.6, 3.7, -6. } };
 
 	using vector_type = vector<T, N>;
 
 	vector_type a1{ convert<T, N>(d1) };
 	vector_type a2{ convert<T, N>(d2) };
+	using cmp_type = decltype(a1 == a2);
 
 	TEST_CHECK(a1 + a2, (vector_type{ convert<T, N>(d1 + d2) }));
 	TEST_CHECK(a1 - a2, (vector_type{ convert<T, N>(d1 - d2) }));
 	TEST_CHECK(a1 * a2, (vector_type{ convert<T, N>(d1 * d2) }));
 	TEST_CHECK(a1 / a2, (vector_type{ convert<T, N>(d1 / d2) }));
-	TEST_CHECK(a1 == a2, (vector_type{ convert<T, N>(cmp(d1, d2, Comparator::EQ)) }));
-	TEST_CHECK(a1 != a2, (vector_type{ convert<T, N>(cmp(d1, d2, Comparator::NEQ)) }));
-	TEST_CHECK(a1 < a2, (vector_type{ convert<T, N>(cmp(d1, d2, Comparator::LT)) }));
-	TEST_CHECK(a1 <= a2, (vector_type{ convert<T, N>(cmp(d1, d2, Comparator::LE)) }));
-	TEST_CHECK(a1 > a2, (vector_type{ convert<T, N>(cmp(d1, d2, Comparator::GT)) }));
-	TEST_CHECK(a1 >= a2, (vector_type{ convert<T, N>(cmp(d1, d2, Comparator::GE)) }));
+	TEST_CHECK(a1 == a2, (expected_cmp<cmp_type, T, N>(d1, d2, Comparator::EQ)));
+	TEST_CHECK(a1 != a2, (expected_cmp<cmp_type, T, N>(d1, d2, Comparator::NEQ)));
+	TEST_CHECK(a1 < a2, (expected_cmp<cmp_type, T, N>(d1, d2, Comparator::LT)));
+	TEST_CHECK(a1 <= a2, (expected_cmp<cmp_type, T, N>(d1, d2, Comparator::LE)));
+	TEST_CHECK(a1 > a2, (expected_cmp<cmp_type, T, N>(d1, d2, Comparator::GT)));
+	TEST_CHECK(a1 >= a2, (expected_cmp<cmp_type, T, N>(d1, d2, Comparator::GE)));
+	TEST_CHECK(store_aligned(a1), a1);
+	TEST_CHECK(store_streaming(a1), a1);
+	TEST_CHECK(store_partial(a1, N), a1);
+	TEST_CHECK(store_partial(a1, N - 1), (vector_type{ truncate(convert<T, N>(d1), N - 1) }));
+	TEST_CHECK(store_partial(a1, 1), (vector_type{ truncate(convert<T, N>(d1), 1) }));
+	{
+		// Small integers keep sums and products exact in any order
+		const auto l = convert<T, N>(d1);
+		std::array<T, N> small, factors;
+		T sum = 0, prod = 1;
+		for(std::size_t i = 0u; i < N; ++i) {
+			small[i] = static_cast<T>(static_cast<int>(i * 7 % 11) - 5);
+			factors[i] = i % 3 ? T(1) : T(-2);
+			sum += small[i];
+			prod *= factors[i];
+		}
+		const vector_type s{ small };
+		const auto min_at = std::min_element(l.begin(), l.end()) - l.begin(), max_at = std::max_element(l.begin(), l.end()) - l.begin();
+		TEST_CHECK(vector_type(reduce_add(s)), vector_type(sum));
+		TEST_CHECK(vector_type(reduce_mul(vector_type{ factors })), vector_type(prod));
+		TEST_CHECK(vector_type(reduce_min(a1)), vector_type(l[min_at]));
+		TEST_CHECK(vector_type(reduce_max(a1)), vector_type(l[max_at]));
+		TEST_CHECK(vector_type(T(reduce_min_index(a1))), vector_type(T(min_at)));
+		TEST_CHECK(vector_type(T(reduce_max_index(a1))), vector_type(T(max_at)));
+		if constexpr(std::is_integral_v<T>) {
+			T all = ~T(0), any = 0;
+			for(const T v : small) {
+				all &= v;
+				any |= v;
+			}
+			TEST_CHECK(vector_type(reduce_and(s)), vector_type(all));
+			TEST_CHECK(vector_type(reduce_or(s)), vector_type(any));
+		} else {
+			// Magnitudes in [1, 2) share their exponent, so the combined bit patterns stay finite
+			using bits_type = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+			std::array<T, N> ones;
+			bits_type all = ~bits_type(0), any = 0;
+			for(std::size_t i = 0u; i < N; ++i) {
+				ones[i] = (i % 3 ? T(1) : T(-1)) * (T(1) + T(i % 8) / T(8));
+				bits_type bits;
+				std::memcpy(&bits, &ones[i], sizeof(T));
+				all &= bits;
+				any |= bits;
+			}
+			T all_val, any_val;
+			std::memcpy(&all_val, &all, sizeof(T));
+			std::memcpy(&any_val, &any, sizeof(T));
+			TEST_CHECK(vector_type(reduce_and(vector_type{ ones })), vector_type(all_val));
+			TEST_CHECK(vector_type(reduce_or(vector_type{ ones })), vector_type(any_val));
+		}
+	}
+	{
+		// The allocation is aligned and padded with zeros to whole vectors, so reading past size() is fine
+		const auto l = convert<T, N>(d1);
+		const aligned_vector<T> mem(l.begin(), l.end() - 1);
+		TEST_CHECK(vector_type(mem.data(), aligned_load{}), (vector_type{ truncate(l, N - 1) }));
+	}
+	for(const std::size_t count : { std::size_t(0), std::size_t(1), N - 1, N + 1 }) {
+		// The tail of a loop: only the first count lanes are read or written
+		const auto tail = mask<T, N>::first_n(count);
+		const auto l = convert<T, N>(d1), r = convert<T, N>(d2);
+		std::array<T, N> mem = r;
+		store(mem.data(), a1, tail);
+		TEST_CHECK(vector_type{ mem }, (vector_type{ truncate(l, count) + r - truncate(r, count) }));
+		TEST_CHECK(load(l.data(), tail), (vector_type{ truncate(l, count) }));
+		TEST_CHECK(select(a1, a2, tail), (vector_type{ truncate(l, count) + r - truncate(r, count) }));
+	}
+
+	{
+		// Small integers keep sums and differences exact in any order. Pairs are combined within each
+		// 128 bit block, those of the first operand before those of the second, like _mm256_hadd_ps
+		constexpr std::size_t block = std::min(N, 16 / sizeof(T));
+		std::array<T, N> l, r, sums, diffs;
+		T sum = 0, diff = 0;
+		for(std::size_t i = 0u; i < N; ++i) {
+			l[i] = static_cast<T>(static_cast<int>(i * 7 % 11) - 5);
+			r[i] = static_cast<T>(static_cast<int>(i * 5 % 13) - 6);
+			// Lanes with an odd number of set index bits end up negated in the difference tree
+			std::size_t bits = 0u;
+			for(std::size_t j = i; j != 0u; j &= j - 1u)
+				++bits;
+			sum += l[i];
+			diff += bits % 2 ? -l[i] : l[i];
+		}
+		for(std::size_t b = 0u; b < N; b += block) {
+			for(std::size_t i = 0u; i < block / 2; ++i) {
+				sums[b + i] = l[b + 2 * i] + l[b + 2 * i + 1];
+				sums[b + block / 2 + i] = r[b + 2 * i] + r[b + 2 * i + 1];
+				diffs[b + i] = l[b + 2 * i] - l[b + 2 * i + 1];
+				diffs[b + block / 2 + i] = r[b + 2 * i] - r[b + 2 * i + 1];
+			}
+		}
+		const vector_type h1{ l }, h2{ r };
+		TEST_CHECK(vector_type(h1.hadd()), vector_type(sum));
+		TEST_CHECK(vector_type(h1.hsub()), vector_type(diff));
+		TEST_CHECK(hadd(h1, h2), vector_type{ sums });
+		TEST_CHECK(hsub(h1, h2), vector_type{ diffs });
+	}
+	{
+		const auto l = convert<T, N>(d1), r = convert<T, N>(d2);
+		std::array<T, N> lo, hi, absolute;
+		for(std::size_t i = 0u; i < N; ++i) {
+			lo[i] = std::min(l[i], r[i]);
+			hi[i] = std::max(l[i], r[i]);
+			absolute[i] = l[i] < T(0) ? -l[i] : l[i];
+		}
+		TEST_CHECK(min(a1, a2), vector_type{ lo });
+		TEST_CHECK(max(a1, a2), vector_type{ hi });
+		TEST_CHECK(abs(a1), vector_type{ absolute });
+	}
+
+	if constexpr(sizeof(T) * N == 64 || std::is_floating_point_v<T>) {
+		// Only the sign bits count, like for the blendv and movemask based masks, so -0 is true and 1 false
+		const auto l = convert<T, N>(d1), r = convert<T, N>(d2);
+		std::array<T, N> signs, picked;
+		for(std::size_t i = 0u; i < N; ++i) {
+			signs[i] = i % 3 == 0 ? T(-1) : i % 3 == 1 ? T(1) : -T(0);
+			picked[i] = i % 3 == 0 || (i % 3 == 2 && std::is_floating_point_v<T>) ? l[i] : r[i];
+		}
+		TEST_CHECK(select(a1, a2, mask<T, N>(vector_type{ signs })), vector_type{ picked });
+		if constexpr(std::is_floating_point_v<T> && detail::has_native_vector<T, N>::value) {
+			TEST_CHECK(select(a1, a2, vector_type{ signs }), vector_type{ picked });
+		}
+	}
+
+	if constexpr(std::is_same_v<T, std::int32_t>) {
+		// Operands beyond 2^24, which float based shortcuts cannot represent
+		std::array<T, N> l, r, lo, hi, quot;
+		std::array<std::int64_t, N / 2> even, odd;
+		for(std::size_t i = 0u; i < N; ++i) {
+			l[i] = (i % 2 ? -1 : 1) * (2147483000 - 97654321 * static_cast<T>(i));
+			r[i] = (i % 3 ? 1 : -1) * (16777259 + 31337 * static_cast<T>(i));
+			const auto prod = static_cast<std::int64_t>(l[i]) * r[i];
+			lo[i] = static_cast<T>(static_cast<std::uint32_t>(prod));
+			hi[i] = static_cast<T>(prod >> 32);
+			quot[i] = l[i] / r[i];
+			(i % 2 ? odd : even)[i / 2] = prod;
+		}
+		const vector_type b1{ l }, b2{ r };
+		TEST_CHECK(b1 * b2, vector_type{ lo });
+		TEST_CHECK(b1 / b2, vector_type{ quot });
+		TEST_CHECK(mulhi(b1, b2), vector_type{ hi });
+		TEST_CHECK(mul_even(b1, b2), (vector<std::int64_t, N / 2>{ even }));
+		TEST_CHECK(mul_odd(b1, b2), (vector<std::int64_t, N / 2>{ odd }));
+	}
+
+	if constexpr(std::is_same_v<T, std::int64_t>) {
+		// Operands that only differ above the low 32 bits, which 32 bit shortcuts cannot tell apart
+		std::array<T, N> l, r, prod, lo, hi, absolute, less;
+		for(std::size_t i = 0u; i < N; ++i) {
+			l[i] = (i % 2 ? -1 : 1) * ((static_cast<T>(i) + 3) << 32 | 12345);
+			r[i] = (i % 3 ? 1 : -1) * ((5 - static_cast<T>(i)) << 32 | 12345);
+			prod[i] = static_cast<T>(static_cast<std::uint64_t>(l[i]) * static_cast<std::uint64_t>(r[i]));
+			lo[i] = std::min(l[i], r[i]);
+			hi[i] = std::max(l[i], r[i]);
+			absolute[i] = l[i] < 0 ? -l[i] : l[i];
+			less[i] = l[i] < r[i] ? l[i] : r[i];
+		}
+		const vector_type b1{ l }, b2{ r };
+		TEST_CHECK(b1 * b2, vector_type{ prod });
+		TEST_CHECK(min(b1, b2), vector_type{ lo });
+		TEST_CHECK(max(b1, b2), vector_type{ hi });
+		TEST_CHECK(abs(b1), vector_type{ absolute });
+		TEST_CHECK(select(b1, b2, mask<T, N>(b1 < b2)), vector_type{ less });
+		TEST_CHECK(select(b2, b1, mask<T, N>(b1 >= b2)), vector_type{ less });
+	}
+
+	if constexpr(std::is_floating_point_v<T>) {
+		// Doubling is exact, so the expected values do not depend on whether the product is rounded
+		const auto l = convert<T, N>(d1), r = convert<T, N>(d2), zero = l - l;
+		const vector_type two(T(2));
+		TEST_CHECK(fmadd(a1, two, a2), vector_type{ l + l + r });
+		TEST_CHECK(fmsub(a1, two, a2), vector_type{ l + l - r });
+		TEST_CHECK(fnmadd(a1, two, a2), vector_type{ r - (l + l) });
+		TEST_CHECK(fnmsub(a1, two, a2), vector_type{ zero - (l + l) - r });
+		// The rounding direction of _MM_FROUND_*, ties to even
+		const auto nearest = apply_lanes(a1, [](T v) { return std::nearbyint(v); }), down = apply_lanes(a1, [](T v) { return std::floor(v); });
+		const auto up = apply_lanes(a1, [](T v) { return std::ceil(v); }), toward_zero = apply_lanes(a1, [](T v) { return std::trunc(v); });
+		TEST_CHECK(round(a1, 0), nearest);
+		TEST_CHECK(round(a1, 1), down);
+		TEST_CHECK(round(a1, 2), up);
+		TEST_CHECK(round(a1, 3), toward_zero);
+		TEST_CHECK(floor(a1), down);
+		TEST_CHECK(ceil(a1), up);
+		// (1 + eps) * (1 - eps) - 1 is -eps^2 when rounded once, but 0 when the product is rounded first
+		constexpr T eps = std::numeric_limits<T>::epsilon();
+		const vector_type rounded = fmsub(vector_type(1 + eps), vector_type(1 - eps), vector_type(1));
+		TEST_CHECK(rounded, vector_type(is_fma_fused_v<vector_type> ? -eps * eps : T(0)));
+
+		// Tolerances are the documented error bounds of math.hpp plus one ulp for the reference
+		const vector_type pos = abs(a1);
+		TEST_CHECK_ULP(exp(a1), apply_lanes(a1, [](T v) { return std::exp(v); }), 2);
+		TEST_CHECK_ULP(log(pos), apply_lanes(pos, [](T v) { return std::log(v); }), 2);
+		TEST_CHECK_ULP(sin(a1), apply_lanes(a1, [](T v) { return std::sin(v); }), 3.5);
+		TEST_CHECK_ULP(cos(a1), apply_lanes(a1, [](T v) { return std::cos(v); }), 3.5);
+		TEST_CHECK_ULP(tan(a1), apply_lanes(a1, [](T v) { return std::tan(v); }), 5);
+		TEST_CHECK_ULP(atan(a1), apply_lanes(a1, [](T v) { return std::atan(v); }), 4);
+		TEST_CHECK_ULP(atan2(a1, a2), apply_lanes(a1, a2, [](T y, T x) { return std::atan2(y, x); }), 4);
+		TEST_CHECK_ULP(erf(a1), apply_lanes(a1, [](T v) { return std::erf(v); }), 4);
+		TEST_CHECK_ULP(pow(pos, vector_type(T(0.5))), apply_lanes(pos, [](T v) { return std::pow(v, T(0.5)); }), 4);
+		TEST_CHECK_ULP(pow(a1, vector_type(T(3))), apply_lanes(a1, [](T v) { return std::pow(v, T(3)); }), 16);
+		TEST_CHECK_ULP(fast::exp(a1), apply_lanes(a1, [](T v) { return std::exp(v); }), (std::is_same_v<T, float> ? 64 : 128));
+		TEST_CHECK_ULP(fast::log(pos + vector_type(T(1))), apply_lanes(pos, [](T v) { return std::log(v + T(1)); }), (std::is_same_v<T, float> ? 4 : 16384));
+	}
+
+	if constexpr(std::is_integral_v<T>) {
+		constexpr T max = std::numeric_limits<T>::max();
+		std::array<T, N> num;
+		for(std::size_t i = 0u; i < N; ++i)
+			num[i] = static_cast<T>((i % 2 ? -1 : 1) * (max / static_cast<T>(i + 1) - static_cast<T>(i)));
+		num[N - 1] = 0;
+		const vector_type n{ num };
+		for(const T d : { T(1), T(-1), T(7), T(-7), T(16), T(-1024), T(1000000007), max, std::numeric_limits<T>::min() }) {
+			std::array<T, N> quot;
+			for(std::size_t i = 0u; i < N; ++i)
+				quot[i] = num[i] / d;
+			TEST_CHECK(n / divider<T>(d), vector_type{ quot });
+		}
+		test_shift(num);
+	}
+
+	test_shuffle(a1, a2, std::make_index_sequence<N>());
+	test_gather(a1, a2);
+	test_transpose<vector_type>(std::make_index_sequence<N>());
+	test_expression(a1, a2);
 }
 
 } // namespace simd
 
+namespace dispatch_test {
+	namespace scalar {
+		int compiled_version();
+		float sum(const float *vals, std::size_t count);
+	} // namespace scalar
+	namespace sse2 {
+		int compiled_version();
+		float sum(const float *vals, std::size_t count);
+	} // namespace sse2
+	namespace avx {
+		int compiled_version();
+		float sum(const float *vals, std::size_t count);
+	} // namespace avx
+	namespace avx2 {
+		int compiled_version();
+		float sum(const float *vals, std::size_t count);
+	} // namespace avx2
+	namespace avx512dq {
+		int compiled_version();
+		float sum(const float *vals, std::size_t count);
+	} // namespace avx512dq
+
+	void test() {
+		static const simd::dispatcher<int()> compiled_version{
+			{ SIMD_NONE, &scalar::compiled_version },
+			{ SIMD_SSE2, &sse2::compiled_version },
+			{ SIMD_AVX, &avx::compiled_version },
+			{ SIMD_AVX2, &avx2::compiled_version },
+			{ SIMD_AVX512DQ, &avx512dq::compiled_version }
+		};
+		static const simd::dispatcher<float(const float *, std::size_t)> sum{
+			{ SIMD_NONE, &scalar::sum },
+			{ SIMD_SSE2, &sse2::sum },
+			{ SIMD_AVX, &avx::sum },
+			{ SIMD_AVX2, &avx2::sum },
+			{ SIMD_AVX512DQ, &avx512dq::sum }
+		};
+
+		std::cout << "Dispatched kernel version: " << simd::version_name(compiled_version()) << std::endl;
+		if(compiled_version() == compiled_version.version() && compiled_version.version() <= simd::runtime_version())
+			std::cout << "dispatcher selection : PASSED" << std::endl;
+		else
+			std::cerr << "dispatcher selection : FAILED" << std::endl;
+
+		float vals[19];
+		for(std::size_t i = 0u; i < 19u; ++i)
+			vals[i] = static_cast<float>(i);
+		if(const float res = sum(vals, 19u); res == 171.f)
+			std::cout << "dispatched sum : PASSED" << std::endl;
+		else
+			std::cerr << "dispatched sum : FAILED (" << res << " != 171)" << std::endl;
+	}
+} // namespace dispatch_test
+
 
 int main(void) {
 	using namespace simd;
@@ -155,5 +1035,115 @@ int main(void) {
 	test<std::int64_t, 4u>();
 #endif // if SIMD_SUPPORTS(SIMD_AVX2)
 
+#if SIMD_SUPPORTS(SIMD_AVX512F)
+	std::cout << std::endl << "--- float32x16 ---" << std::endl;
+	test<float, 16u>();
+	std::cout << std::endl << "--- float64x8 ---" << std::endl;
+	test<double, 8u>();
+	std::cout << std::endl << "--- int32x16 ---" << std::endl;
+	test<std::int32_t, 16u>();
+	std::cout << std::endl << "--- int64x8 ---" << std::endl;
+	test<std::int64_t, 8u>();
+#endif // if SIMD_SUPPORTS(SIMD_AVX512F)
+
+	// Widths beyond the native registers are composed of several smaller ones
+#if SIMD_SUPPORTS(SIMD_SSE2) && !SIMD_SUPPORTS(SIMD_AVX)
+	std::cout << std::endl << "--- float32x8 (composite) ---" << std::endl;
+	test<float, 8u>();
+	std::cout << std::endl << "--- float64x4 (composite) ---" << std::endl;
+	test<double, 4u>();
+#endif // if SIMD_SUPPORTS(SIMD_SSE2) && !SIMD_SUPPORTS(SIMD_AVX)
+
+#if SIMD_SUPPORTS(SIMD_SSE2) && !SIMD_SUPPORTS(SIMD_AVX2)
+	std::cout << std::endl << "--- int32x8 (composite) ---" << std::endl;
+	test<std::int32_t, 8u>();
+	std::cout << std::endl << "--- int64x4 (composite) ---" << std::endl;
+	test<std::int64_t, 4u>();
+#endif // if SIMD_SUPPORTS(SIMD_SSE2) && !SIMD_SUPPORTS(SIMD_AVX2)
+
+#if SIMD_SUPPORTS(SIMD_SSE2) && !SIMD_SUPPORTS(SIMD_AVX512F)
+	std::cout << std::endl << "--- float32x16 (composite) ---" << std::endl;
+	test<float, 16u>();
+	std::cout << std::endl << "--- float64x8 (composite) ---" << std::endl;
+	test<double, 8u>();
+	std::cout << std::endl << "--- int32x16 (composite) ---" << std::endl;
+	test<std::int32_t, 16u>();
+	std::cout << std::endl << "--- int64x8 (composite) ---" << std::endl;
+	test<std::int64_t, 8u>();
+#endif // if SIMD_SUPPORTS(SIMD_SSE2) && !SIMD_SUPPORTS(SIMD_AVX512F)
+
+	// Types without any native register fall back to scalar lanes
+#if !SIMD_SUPPORTS(SIMD_SSE)
+	std::cout << std::endl << "--- float32x4 (scalar) ---" << std::endl;
+	test<float, 4u>();
+	std::cout << std::endl << "--- float32x8 (scalar) ---" << std::endl;
+	test<float, 8u>();
+#endif // if !SIMD_SUPPORTS(SIMD_SSE)
+
+#if !SIMD_SUPPORTS(SIMD_SSE2)
+	std::cout << std::endl << "--- float64x2 (scalar) ---" << std::endl;
+	test<double, 2u>();
+	std::cout << std::endl << "--- int32x4 (scalar) ---" << std::endl;
+	test<std::int32_t, 4u>();
+	std::cout << std::endl << "--- int64x2 (scalar) ---" << std::endl;
+	test<std::int64_t, 2u>();
+#endif // if !SIMD_SUPPORTS(SIMD_SSE2)
+
+	// Native on SSE2 (x16, x8) and AVX2 (x32, x16), composite or scalar otherwise
+	std::cout << std::endl << "--- int8 / int16 / unsigned ---" << std::endl;
+	test_small_int<std::int8_t, 16u>();
+	test_small_int<std::int8_t, 32u>();
+	test_small_int<std::int8_t, 64u>();
+	test_small_int<std::int16_t, 8u>();
+	test_small_int<std::int16_t, 16u>();
+	test_small_int<std::int16_t, 32u>();
+	test_unsigned<std::uint8_t, 16u>();
+	test_unsigned<std::uint8_t, 32u>();
+	test_unsigned<std::uint8_t, 64u>();
+	test_unsigned<std::uint16_t, 8u>();
+	test_unsigned<std::uint16_t, 16u>();
+	test_unsigned<std::uint16_t, 32u>();
+	test_unsigned<std::uint32_t, 4u>();
+	test_unsigned<std::uint32_t, 8u>();
+	test_unsigned<std::uint32_t, 16u>();
+	test_unsigned<std::uint64_t, 2u>();
+	test_unsigned<std::uint64_t, 4u>();
+	test_unsigned<std::uint64_t, 8u>();
+
+	std::cout << std::endl << "--- conversions ---" << std::endl;
+	test_conversions();
+
+	std::cout << std::endl << "--- algorithms ---" << std::endl;
+	test_algorithms<float>();
+	test_algorithms<double>();
+	test_algorithms<std::int32_t>();
+	test_algorithms<std::int64_t>();
+
+	std::cout << std::endl << "--- transpose ---" << std::endl;
+	test_matrix_transpose<float>();
+	test_matrix_transpose<double>();
+	test_matrix_transpose<std::int32_t>();
+	test_matrix_transpose<std::int64_t>();
+
+	std::cout << std::endl << "--- soa ---" << std::endl;
+	for_each_field_count([](auto fields) {
+		test_soa<float>(fields);
+		test_soa<std::int32_t>(fields);
+	});
+	test_soa<double>(std::make_index_sequence<4>());
+
+	std::cout << std::endl << "--- float16 ---" << std::endl;
+	test_float16<4u>();
+	test_float16<8u>();
+	test_float16<16u>();
+
+	std::cout << std::endl << "--- bfloat16 ---" << std::endl;
+	test_bfloat16<4u>();
+	test_bfloat16<8u>();
+	test_bfloat16<16u>();
+
+	std::cout << std::endl << "--- dispatch ---" << std::endl;
+	dispatch_test::test();
+
 	return EXIT_SUCCESS;
 }
\ No newline at end of file